@@ -0,0 +1,230 @@
+/*
+ * cardenc.cc
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+// a driver measuring the encoders of cardenc/ on a grid of (n, k) pairs; for
+// every encoding and pair, it prints a JSON object on a separate line with
+// the number of clauses, literals and auxiliary variables as well as the best
+// encoding time (in nanoseconds) over a number of repetitions; the encodings
+// suffixed with "-cached" are instantiated from the template cache
+//
+// usage: cardenc [repetitions [n1,n2,... [k1,k2,...]]]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "card.hh"
+#include "itot.hh"
+
+using namespace std;
+
+// names of the encodings, as in pysat.card.EncType
+//=============================================================================
+static const char *enc_names[] = {
+	"pairwise", "seqcounter", "sortnetwrk", "cardnetwrk", "bitwise",
+	"ladder", "totalizer", "mtotalizer", "kmtotalizer"
+};
+
+// the result of encoding a constraint
+//=============================================================================
+typedef struct {
+	size_t clauses;
+	size_t lits;
+	int auxvars;
+	long long time_ns;
+} EncResult;
+
+//
+//=============================================================================
+static long long now_ns()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(
+			chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// a comma-separated list of positive integers
+//=============================================================================
+static bool parse_list(const char *str, vector<int>& vals)
+{
+	vals.clear();
+
+	while (*str) {
+		char *end;
+		long v = strtol(str, &end, 10);
+
+		if (end == str || v <= 0 || (*end != ',' && *end != '\0'))
+			return false;
+
+		vals.push_back((int)v);
+		str = *end ? end + 1 : end;
+	}
+
+	return !vals.empty();
+}
+
+// the pairwise, bitwise and ladder encodings support AtMost1 only
+//=============================================================================
+static bool supported(int enc, int k)
+{
+	return k == 1 || (enc != enc_exp && enc != enc_bitw && enc != enc_ladd);
+}
+
+// the best of several runs of _encode_atmost()
+//=============================================================================
+static EncResult bench_atmost(int enc, int n, int k, int reps)
+{
+	EncResult res = { 0, 0, 0, -1 };
+
+	for (int r = 0; r < reps; ++r) {
+		vector<int> lhs(n);
+		for (int i = 0; i < n; ++i)
+			lhs[i] = i + 1;
+
+		ClauseSet dest;
+		int top = n;
+
+		long long start = now_ns();
+		_encode_atmost(dest, lhs, k, top, enc);
+		long long time = now_ns() - start;
+
+		if (res.time_ns < 0 || time < res.time_ns)
+			res.time_ns = time;
+
+		res.clauses = dest.size();
+		res.lits    = dest.nof_lits();
+		res.auxvars = top - n;
+	}
+
+	return res;
+}
+
+// the same for a constraint instantiated from the template cache, which is
+// warmed up beforehand
+//=============================================================================
+static EncResult bench_cached(int enc, int n, int k, int reps)
+{
+	EncResult res = { 0, 0, 0, -1 };
+
+	ClauseSet warm;
+	vector<int> lhs(n);
+	int top = n;
+	_encode_atmost_cached(warm, lhs, k, top, enc);
+
+	for (int r = 0; r < reps; ++r) {
+		for (int i = 0; i < n; ++i)
+			lhs[i] = i + 1;
+
+		ClauseSet dest;
+		top = n;
+
+		long long start = now_ns();
+		_encode_atmost_cached(dest, lhs, k, top, enc);
+		long long time = now_ns() - start;
+
+		if (res.time_ns < 0 || time < res.time_ns)
+			res.time_ns = time;
+
+		res.clauses = dest.size();
+		res.lits    = dest.nof_lits();
+		res.auxvars = top - n;
+	}
+
+	return res;
+}
+
+// the best of several runs of the iterative totalizer, which is first built
+// for bound 1 and then increased to k
+//=============================================================================
+static EncResult bench_itot(int n, int k, int reps)
+{
+	EncResult res = { 0, 0, 0, -1 };
+
+	for (int r = 0; r < reps; ++r) {
+		vector<int> lhs(n);
+		for (int i = 0; i < n; ++i)
+			lhs[i] = i + 1;
+
+		ClauseSet dest;
+		int top = n;
+
+		long long start = now_ns();
+		TotTree *tree = itot_new(dest, lhs, 1, top);
+		if (k > 1)
+			itot_increase(tree, dest, k, top);
+		long long time = now_ns() - start;
+
+		itot_destroy(tree);
+
+		if (res.time_ns < 0 || time < res.time_ns)
+			res.time_ns = time;
+
+		res.clauses = dest.size();
+		res.lits    = dest.nof_lits();
+		res.auxvars = top - n;
+	}
+
+	return res;
+}
+
+//
+//=============================================================================
+static void report(const char *enc, int n, int k, EncResult& res)
+{
+	printf("{\"suite\": \"cardenc\", \"enc\": \"%s\", \"n\": %d, \"k\": %d, "
+			"\"clauses\": %zu, \"lits\": %zu, \"auxvars\": %d, "
+			"\"time_ns\": %lld}\n", enc, n, k, res.clauses, res.lits,
+			res.auxvars, res.time_ns);
+}
+
+//
+//=============================================================================
+int main(int argc, char *argv[])
+{
+	int reps = 5;
+	vector<int> ns, ks;
+
+	parse_list("16,64,256,1024", ns);
+	parse_list("1,2,8,32,128", ks);
+
+	if ((argc > 1 && (reps = atoi(argv[1])) <= 0) ||
+			(argc > 2 && !parse_list(argv[2], ns)) ||
+			(argc > 3 && !parse_list(argv[3], ks)) || argc > 4) {
+		fprintf(stderr, "usage: %s [repetitions [n1,n2,... [k1,k2,...]]]\n",
+				argv[0]);
+		return 1;
+	}
+
+	for (size_t i = 0; i < ns.size(); ++i) {
+		for (size_t j = 0; j < ks.size(); ++j) {
+			int n = ns[i], k = ks[j];
+
+			// the constraint is trivially satisfied otherwise
+			if (k >= n)
+				continue;
+
+			for (int enc = enc_exp; enc <= enc_kmtot; ++enc) {
+				if (!supported(enc, k))
+					continue;
+
+				EncResult res = bench_atmost(enc, n, k, reps);
+				report(enc_names[enc], n, k, res);
+
+				string name = string(enc_names[enc]) + "-cached";
+				res = bench_cached(enc, n, k, reps);
+				report(name.c_str(), n, k, res);
+			}
+
+			EncResult res = bench_itot(n, k, reps);
+			report("itotalizer", n, k, res);
+
+			fflush(stdout);
+		}
+	}
+
+	return 0;
+}
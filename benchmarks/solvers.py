@@ -0,0 +1,232 @@
+#!/usr/bin/env python
+#-*- coding:utf-8 -*-
+##
+## solvers.py
+##
+##  Created on: Oct 15, 2026
+##
+
+"""
+    Throughput of the solver bindings of :mod:`pysat.solvers`. For every
+    backend, a fixed random 3-CNF formula is loaded clause by clause with
+    :meth:`add_clause` and at once with :meth:`append_buffer`, solved, and its
+    model is fetched with :meth:`get_model` and :meth:`get_model_buffer`. The
+    best time of every operation over a number of repetitions is printed as a
+    JSON object on a separate line, e.g.
+
+    ::
+
+        $ python benchmarks/solvers.py -s g3,cd -v 1000
+        {"suite": "solvers", "solver": "g3", "op": "add_clause", ...}
+        ...
+
+    Unlike the search itself, the cost of :meth:`add_clause` and
+    :meth:`get_model` is mostly the translation between Python and C++, and
+    so a regression in the wrappers shows up directly in these numbers.
+"""
+
+#
+#==============================================================================
+from __future__ import print_function
+from array import array
+import getopt
+import json
+import os
+from pysat.solvers import Solver
+import random
+import sys
+from timeit import default_timer as timer
+
+
+#
+#==============================================================================
+solvers = ['cd', 'gc3', 'gc41', 'g3', 'g4', 'lgl', 'mcb', 'mcm', 'mpl', 'mg3',
+        'mc', 'm22', 'mgh']
+
+
+#
+#==============================================================================
+def random_cnf(nof_vars, ratio, seed):
+    """
+        A random 3-CNF formula, which is satisfiable with high probability
+        if the clause-to-variable ratio is well below the threshold.
+    """
+
+    rng = random.Random(seed)
+
+    clauses = []
+    for i in range(int(nof_vars * ratio)):
+        vs = rng.sample(range(1, nof_vars + 1), 3)
+        clauses.append([v if rng.random() < 0.5 else -v for v in vs])
+
+    return clauses
+
+
+#
+#==============================================================================
+def best_of(reps, prepare, run):
+    """
+        The best time (in nanoseconds) of ``run(prepare())`` over several
+        repetitions, and the result of its last call.
+    """
+
+    best, res = None, None
+
+    for r in range(reps):
+        obj = prepare()
+
+        start = timer()
+        res = run(obj)
+        time = int((timer() - start) * 1e9)
+
+        if best is None or time < best:
+            best = time
+
+    return best, res
+
+
+#
+#==============================================================================
+def bench_solver(name, clauses, reps, calls):
+    """
+        Measure a single backend and yield a record per operation.
+    """
+
+    buf = array('i', [l for cl in clauses for l in cl + [0]])
+    nof_lits = len(buf) - len(clauses)
+
+    def add_clauses(s):
+        for cl in clauses:
+            s.add_clause(cl)
+
+    def fresh():
+        return Solver(name=name)
+
+    def loaded():
+        s = Solver(name=name)
+        s.append_buffer(buf)
+        return s
+
+    def run(op):
+        def wrapped(s):
+            try:
+                return op(s)
+            finally:
+                s.delete()
+
+        return wrapped
+
+    time, _ = best_of(reps, fresh, run(add_clauses))
+    yield 'add_clause', len(clauses), nof_lits, time
+
+    time, _ = best_of(reps, fresh, run(lambda s: s.append_buffer(buf)))
+    yield 'append_buffer', 1, nof_lits, time
+
+    time, _ = best_of(reps, loaded, run(lambda s: s.solve()))
+    yield 'solve', 1, nof_lits, time
+
+    def solved():
+        s = loaded()
+        s.solve()
+        return s
+
+    def get_models(method):
+        def call(s):
+            model = None
+            for i in range(calls):
+                model = getattr(s, method)()
+            return model
+
+        return call
+
+    for method in ('get_model', 'get_model_buffer'):
+        time, model = best_of(reps, solved, run(get_models(method)))
+        if model is not None:
+            yield method, calls, len(model) * calls, time
+
+
+#
+#==============================================================================
+def parse_options():
+    """
+        Parses command-line options.
+    """
+
+    try:
+        opts, args = getopt.getopt(sys.argv[1:],
+                                   'c:hr:R:s:S:v:',
+                                   ['calls=',
+                                    'help',
+                                    'ratio=',
+                                    'reps=',
+                                    'seed=',
+                                    'solvers=',
+                                    'vars='])
+    except getopt.GetoptError as err:
+        sys.stderr.write(str(err).capitalize())
+        usage()
+        sys.exit(1)
+
+    calls = 100
+    ratio = 3.0
+    reps = 3
+    seed = 1
+    names = solvers
+    nof_vars = 20000
+
+    for opt, arg in opts:
+        if opt in ('-c', '--calls'):
+            calls = int(arg)
+        elif opt in ('-h', '--help'):
+            usage()
+            sys.exit(0)
+        elif opt in ('-r', '--ratio'):
+            ratio = float(arg)
+        elif opt in ('-R', '--reps'):
+            reps = int(arg)
+        elif opt in ('-s', '--solvers'):
+            names = str(arg).split(',')
+        elif opt in ('-S', '--seed'):
+            seed = int(arg)
+        elif opt in ('-v', '--vars'):
+            nof_vars = int(arg)
+        else:
+            assert False, 'Unhandled option: {0} {1}'.format(opt, arg)
+
+    return names, nof_vars, ratio, seed, reps, calls
+
+
+#
+#==============================================================================
+def usage():
+    """
+        Prints usage message.
+    """
+
+    print('Usage:', os.path.basename(sys.argv[0]), '[options]')
+    print('Options:')
+    print('        -c, --calls=<int>        Number of model calls to time (default: 100)')
+    print('        -h, --help               Show this message')
+    print('        -r, --ratio=<float>      Clause-to-variable ratio (default: 3.0)')
+    print('        -R, --reps=<int>         Number of repetitions (default: 3)')
+    print('        -s, --solvers=<list>     Comma-separated list of SAT solvers')
+    print('                                 Available values: cd, gc3, gc41, g3, g4, lgl, mcb, mcm, mpl, mg3, mc, m22, mgh (default: all)')
+    print('        -S, --seed=<int>         Random seed (default: 1)')
+    print('        -v, --vars=<int>         Number of variables (default: 20000)')
+
+
+#
+#==============================================================================
+if __name__ == '__main__':
+    names, nof_vars, ratio, seed, reps, calls = parse_options()
+
+    clauses = random_cnf(nof_vars, ratio, seed)
+
+    for name in names:
+        for op, nof_calls, items, time in bench_solver(name, clauses, reps,
+                calls):
+            print(json.dumps({'suite': 'solvers', 'solver': name, 'op': op,
+                'vars': nof_vars, 'clauses': len(clauses), 'calls': nof_calls,
+                'items': items, 'time_ns': time}))
+
+        sys.stdout.flush()
@@ -8,6 +8,11 @@
 #ifndef CARD_HH_
 #define CARD_HH_
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "bitwise.hh"
 #include "clset.hh"
 #include "ladder.hh"
@@ -83,4 +88,217 @@ static inline void _encode_atleast(
 	}
 }
 
+// an AtMostK constraint encoded once for a given shape, i.e. the number of
+// inputs n, the bound and the encoding: the inputs are variables 1 .. n and
+// the auxiliary variables are n + 1 .. top
+//=============================================================================
+typedef struct {
+	int n;
+	int top;
+	ClauseSet clauses;
+} CardTemplate;
+
+// the templates of the shapes encoded so far; the cache holds at most a given
+// number of literals overall and it stops growing once the limit is reached;
+// as it lives as long as the process, it is disabled until a limit is set
+//=============================================================================
+class CardCache {
+public:
+	CardCache() : max_lits(0), nof_lits(0) {}
+
+	bool enabled()
+	{
+		lock_guard<mutex> lock(mtx);
+		return max_lits > 0;
+	}
+
+	shared_ptr<CardTemplate> find(int n, int rhs, int enc)
+	{
+		lock_guard<mutex> lock(mtx);
+
+		map<Shape, shared_ptr<CardTemplate> >::iterator it =
+			templates.find(Shape(make_pair(n, rhs), enc));
+		return it != templates.end() ? it->second : shared_ptr<CardTemplate>();
+	}
+
+	void insert(int rhs, int enc, shared_ptr<CardTemplate> tmpl)
+	{
+		lock_guard<mutex> lock(mtx);
+
+		if (nof_lits + tmpl->clauses.nof_lits() <= max_lits &&
+				templates.insert(make_pair(Shape(make_pair(tmpl->n, rhs), enc),
+					tmpl)).second)
+			nof_lits += tmpl->clauses.nof_lits();
+	}
+
+	// dropping all the templates; a limit of zero disables the cache
+	void reset(size_t limit)
+	{
+		lock_guard<mutex> lock(mtx);
+
+		templates.clear();
+		max_lits = limit;
+		nof_lits = 0;
+	}
+
+	// the number of bytes taken by the templates
+	size_t memory()
+	{
+		lock_guard<mutex> lock(mtx);
+
+		size_t bytes = 0;
+		for (map<Shape, shared_ptr<CardTemplate> >::iterator it =
+				templates.begin(); it != templates.end(); ++it)
+			bytes += sizeof(CardTemplate) + it->second->clauses.memory();
+
+		return bytes;
+	}
+private:
+	typedef pair<pair<int, int>, int> Shape;
+
+	mutex mtx;
+	map<Shape, shared_ptr<CardTemplate> > templates;
+	size_t max_lits;
+	size_t nof_lits;
+};
+
+static CardCache card_cache;
+
+// encoding the template of a shape
+//=============================================================================
+static inline shared_ptr<CardTemplate> _card_template(int n, int rhs, int enc)
+{
+	shared_ptr<CardTemplate> tmpl(new CardTemplate);
+
+	vector<int> lhs(n);
+	for (int i = 0; i < n; ++i)
+		lhs[i] = i + 1;
+
+	tmpl->n = n;
+	tmpl->top = n;
+	_encode_atmost(tmpl->clauses, lhs, rhs, tmpl->top, enc);
+
+	return tmpl;
+}
+
+// instantiating a template for the given inputs, with the auxiliary
+// variables numbered from top + 1
+//=============================================================================
+static inline void _card_apply(
+	ClauseSet& dest,
+	CardTemplate& tmpl,
+	vector<int>& lhs,
+	int& top
+)
+{
+	dest.append_relocated(tmpl.clauses, lhs, top);
+	top += tmpl.top - tmpl.n;
+}
+
+// the same as _encode_atmost() but the constraints of a shape met before are
+// instantiated from its template rather than encoded from scratch
+//=============================================================================
+static inline void _encode_atmost_cached(
+	ClauseSet& dest,
+	vector<int>& lhs,
+	int rhs,
+	int& top,
+	int enc
+)
+{
+	if (!card_cache.enabled()) {
+		_encode_atmost(dest, lhs, rhs, top, enc);
+		return;
+	}
+
+	shared_ptr<CardTemplate> tmpl = card_cache.find(lhs.size(), rhs, enc);
+
+	if (!tmpl) {
+		tmpl = _card_template(lhs.size(), rhs, enc);
+		card_cache.insert(rhs, enc, tmpl);
+	}
+
+	_card_apply(dest, *tmpl, lhs, top);
+}
+
+// a batch of AtMostK constraints shared by the encoding threads, which take
+// the constraints one by one in the order of their indices
+//=============================================================================
+typedef struct {
+	vector<vector<int> > *lhss;
+	vector<int> *rhss;
+	vector<ClauseSet> *parts;
+	vector<int> *tops;
+	int enc;
+	atomic<size_t> next;
+} CardBatch;
+
+//
+//=============================================================================
+static void _encode_batch_run(CardBatch *batch)
+{
+	size_t i;
+	while ((i = batch->next++) < batch->lhss->size())
+		_encode_atmost_cached((*batch->parts)[i], (*batch->lhss)[i],
+				(*batch->rhss)[i], (*batch->tops)[i], batch->enc);
+}
+
+// encoding many independent AtMostK constraints on several threads; all of
+// them number their auxiliary variables from top + 1 and these are shifted
+// afterwards, so that the result is exactly the one of encoding the
+// constraints one after another, whatever the number of threads is
+//=============================================================================
+static inline void _encode_atmost_many(
+	ClauseSet& dest,
+	vector<vector<int> >& lhss,
+	vector<int>& rhss,
+	int& top,
+	int enc,
+	unsigned nof_threads
+)
+{
+	vector<ClauseSet> parts(lhss.size());
+	vector<int> tops(lhss.size(), top);
+
+	CardBatch batch;
+	batch.lhss  = &lhss;
+	batch.rhss  = &rhss;
+	batch.parts = &parts;
+	batch.tops  = &tops;
+	batch.enc   = enc;
+	batch.next  = 0;
+
+	if (nof_threads == 0)
+		nof_threads = std::max(thread::hardware_concurrency(), 1u);
+	if (nof_threads > lhss.size())
+		nof_threads = lhss.size();
+
+	if (nof_threads <= 1)
+		_encode_batch_run(&batch);
+	else {
+		vector<thread> threads;
+		for (unsigned i = 0; i < nof_threads; ++i)
+			threads.push_back(thread(_encode_batch_run, &batch));
+
+		for (size_t i = 0; i < threads.size(); ++i)
+			threads[i].join();
+	}
+
+	size_t ncls = dest.size(), nlits = dest.nof_lits();
+	for (size_t i = 0; i < parts.size(); ++i) {
+		ncls  += parts[i].size();
+		nlits += parts[i].nof_lits();
+	}
+
+	dest.reserve(ncls, nlits);
+
+	int shift = 0;
+	for (size_t i = 0; i < parts.size(); ++i) {
+		dest.append_shifted(parts[i], top, shift);
+		shift += tops[i] - top;
+	}
+
+	top += shift;
+}
+
 #endif // CARD_HH_
@@ -14,104 +14,248 @@
 
 using namespace std;
 
+// a read-only view of a clause stored in a ClauseSet; it remains valid
+// only as long as no clause is added to or removed from the set
+//=============================================================================
+class ClauseRef {
+public:
+	ClauseRef(const int *lits, size_t nlits) : data(lits), sz(nlits) {}
+
+	size_t size() const
+	{
+		return sz;
+	}
+
+	int operator[](size_t i) const
+	{
+		return data[i];
+	}
+
+	const int *begin() const
+	{
+		return data;
+	}
+
+	const int *end() const
+	{
+		return data + sz;
+	}
+
+	bool operator==(const vector<int>& cl) const
+	{
+		return sz == cl.size() && std::equal(data, data + sz, cl.begin());
+	}
+private:
+	const int *data;
+	size_t sz;
+};
+
+// clauses are stored back to back in a single literal arena; clause i
+// occupies lits[offs[i]] .. lits[offs[i + 1] - 1]
+//=============================================================================
 class ClauseSet {
 public:
-	ClauseSet() : clauses(0) {}
-	ClauseSet(ClauseSet& orig) : clauses(orig.clauses) {}
+	ClauseSet() : lits(0), offs(1, 0) {}
+	ClauseSet(ClauseSet& orig) : lits(orig.lits), offs(orig.offs) {}
 
 	void clear()
 	{
-		clauses.clear();
+		lits.clear();
+		offs.resize(1);
 	}
 
 	size_t size()
 	{
-		return clauses.size();
+		return offs.size() - 1;
 	}
 
+	size_t nof_lits()
+	{
+		return lits.size();
+	}
+
+	// the number of bytes reserved for the clauses
+	size_t memory()
+	{
+		return lits.capacity() * sizeof(int) +
+			offs.capacity() * sizeof(size_t);
+	}
+
+	void reserve(size_t ncls, size_t nlits)
+	{
+		offs.reserve(ncls + 1);
+		lits.reserve(nlits);
+	}
+
+	// growing the set adds empty clauses
 	void resize(size_t sz_new)
 	{
-		return clauses.resize(sz_new);
+		if (sz_new < size()) {
+			lits.resize(offs[sz_new]);
+			offs.resize(sz_new + 1);
+		}
+		else
+			offs.resize(sz_new + 1, lits.size());
 	}
 
-	vector<int>& operator[](size_t i)
+	ClauseRef operator[](size_t i)
 	{
-		return clauses[i];
+		return ClauseRef(lits.data() + offs[i], offs[i + 1] - offs[i]);
 	}
 
 	void erase(vector<int>& cl)
 	{
-		clauses.erase(std::find(clauses.begin(), clauses.end(), cl));
+		size_t i = find(0, cl);
+
+		if (i < size())
+			erase_range(i, i + 1);
 	}
 
 	void erase_subset(size_t start, ClauseSet& clset)
 	{
 		if (clset.size()) {
-			vector<int>& cl_first = clset[0];
-			vector<vector<int> >::iterator begin = std::find(clauses.begin() + start, clauses.end(), cl_first);
-			clauses.erase(begin, begin + clset.size());
+			ClauseRef cl_first = clset[0];
+			vector<int> first(cl_first.begin(), cl_first.end());
+
+			size_t i = find(start, first);
+			erase_range(i, std::min(i + clset.size(), size()));
 		}
 	}
 
-	vector<vector<int> >& get_clauses()
+	const vector<int>& get_literals()
+	{
+		return lits;
+	}
+
+	const vector<size_t>& get_offsets()
 	{
-		return clauses;
+		return offs;
+	}
+
+	// appending the clauses of another set, with the variables above top
+	// renumbered by shift
+	void append_shifted(ClauseSet& other, int top, int shift)
+	{
+		size_t base = lits.size();
+
+		for (size_t i = 0; i < other.lits.size(); ++i) {
+			int l = other.lits[i];
+
+			if (l > top)
+				l += shift;
+			else if (l < -top)
+				l -= shift;
+
+			lits.push_back(l);
+		}
+
+		for (size_t i = 1; i < other.offs.size(); ++i)
+			offs.push_back(base + other.offs[i]);
+	}
+
+	// appending the clauses of a template whose variables 1 .. inputs.size()
+	// stand for the given input literals and the others are auxiliary ones,
+	// which are renumbered to follow top
+	void append_relocated(ClauseSet& other, vector<int>& inputs, int top)
+	{
+		int n = (int)inputs.size();
+		size_t base = lits.size();
+
+		for (size_t i = 0; i < other.lits.size(); ++i) {
+			int l = other.lits[i];
+
+			if (l > n)
+				l += top - n;
+			else if (l < -n)
+				l -= top - n;
+			else
+				l = l > 0 ? inputs[l - 1] : -inputs[-l - 1];
+
+			lits.push_back(l);
+		}
+
+		for (size_t i = 1; i < other.offs.size(); ++i)
+			offs.push_back(base + other.offs[i]);
 	}
 
 	void add_clause(vector<int> cl)
 	{
-		clauses.push_back(cl);
+		add_clause_ref(cl);
 	}
 
 	void add_clause_ref(vector<int>& cl)
 	{
-		clauses.push_back(cl);
+		lits.insert(lits.end(), cl.begin(), cl.end());
+		offs.push_back(lits.size());
 	}
 
 	void create_clause(vector<int>& cl)
 	{
-		add_clause(cl);
+		add_clause_ref(cl);
 	}
 
 	void create_unit_clause(int l)
 	{
-		vector<int> cl; cl.push_back(l);
-		clauses.push_back(cl);
+		lits.push_back(l);
+		offs.push_back(lits.size());
 	}
 
 	void create_binary_clause(int l1, int l2)
 	{
-		vector<int> cl;
-		cl.push_back(l1);
-		cl.push_back(l2);
+		lits.push_back(l1);
+		lits.push_back(l2);
 
-		clauses.push_back(cl);
+		offs.push_back(lits.size());
 	}
 
 	void create_ternary_clause(int l1, int l2, int l3)
 	{
-		vector<int> cl;
-		cl.push_back(l1);
-		cl.push_back(l2);
-		cl.push_back(l3);
+		lits.push_back(l1);
+		lits.push_back(l2);
+		lits.push_back(l3);
 
-		clauses.push_back(cl);
+		offs.push_back(lits.size());
 	}
 
 	void dump(ostream& out)
 	{
-		for (size_t i = 0; i < clauses.size(); ++i)
-			dump_clause(out, clauses[i]);
+		for (size_t i = 0; i < size(); ++i)
+			dump_clause(out, (*this)[i]);
 	}
 private:
-	void dump_clause(ostream& out, vector<int>& cl)
+	void dump_clause(ostream& out, ClauseRef cl)
 	{
 		for (size_t i = 0; i < cl.size(); ++i)
 				out << cl[i] << " ";
-		out << "0" << endl;
+		out << "0\n";
+	}
+
+	// index of the first clause equal to cl starting from clause start
+	size_t find(size_t start, vector<int>& cl)
+	{
+		for (size_t i = start; i < size(); ++i)
+			if ((*this)[i] == cl)
+				return i;
+
+		return size();
+	}
+
+	// removing clauses first .. last - 1 and shifting the offsets
+	void erase_range(size_t first, size_t last)
+	{
+		if (first >= last)
+			return;
+
+		size_t shift = offs[last] - offs[first];
+		lits.erase(lits.begin() + offs[first], lits.begin() + offs[last]);
+		offs.erase(offs.begin() + first + 1, offs.begin() + last + 1);
+
+		for (size_t i = first + 1; i < offs.size(); ++i)
+			offs[i] -= shift;
 	}
 protected:
-	vector<vector<int> > clauses;
+	vector<int> lits;
+	vector<size_t> offs;
 };
 
 #endif // CLSET_HH_
@@ -0,0 +1,436 @@
+/*
+ * dimacs.hh
+ *
+ *  Created on: Oct 14, 2026
+ */
+
+#ifndef DIMACS_HH_
+#define DIMACS_HH_
+
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "clset.hh"
+
+using namespace std;
+
+// formats understood by the parser
+//=============================================================================
+enum DimacsFormat {
+	DIMACS_CNF   = 0,
+	DIMACS_WCNF  = 1,
+	DIMACS_CNFP  = 2,  // CNF+
+	DIMACS_WCNFP = 3   // WCNF+
+};
+
+// weights are kept as doubles; the tokens of non-integral weights are
+// saved as well, so that the caller can convert them to exact decimals
+//=============================================================================
+class WeightList {
+public:
+	size_t size()
+	{
+		return vals.size();
+	}
+
+	void push(double val, const char *beg, const char *end)
+	{
+		if (!std::isfinite(val) || val != std::floor(val)) {
+			frac.push_back(vals.size());
+			tokens.push_back(string(beg, end));
+		}
+
+		vals.push_back(val);
+	}
+
+	// the same weight taken with the opposite sign
+	void push_neg(double val, const char *beg, const char *end)
+	{
+		if (!std::isfinite(val) || val != std::floor(val)) {
+			frac.push_back(vals.size());
+
+			if (*beg == '-')
+				tokens.push_back(string(beg + 1, end));
+			else if (*beg == '+')
+				tokens.push_back("-" + string(beg + 1, end));
+			else
+				tokens.push_back("-" + string(beg, end));
+		}
+
+		vals.push_back(-val);
+	}
+
+	vector<double> vals;
+	vector<size_t> frac;    // indices of non-integral weights
+	vector<string> tokens;  // their original tokens
+};
+
+// a line-based parser of DIMACS-like formats, which can be fed with
+// chunks of arbitrary size; it mirrors the from_fp() methods of
+// pysat.formula, i.e. there is one clause or constraint per line and
+// the last token of a clause line is ignored
+//=============================================================================
+class DimacsParser {
+public:
+	DimacsParser(DimacsFormat fmt, const string& comment_lead)
+	: format(fmt), leads("p" + comment_lead), nv(0), lineno(0)
+	{
+		topw.push(1, NULL, NULL);
+	}
+
+	// parsing a chunk; a line may be split between consecutive chunks
+	bool feed(const char *data, size_t len)
+	{
+		const char *end = data + len;
+
+		if (!pending.empty()) {
+			const char *eol = find_eol(data, end);
+			pending.append(data, eol);
+
+			if (eol == end)
+				return error.empty();
+
+			process(pending.data(), pending.data() + pending.size());
+			pending.clear();
+			data = eol + 1;
+		}
+
+		while (data < end && error.empty()) {
+			const char *eol = find_eol(data, end);
+
+			if (eol == end) {
+				pending.assign(data, end);
+				break;
+			}
+
+			process(data, eol);
+			data = eol + 1;
+		}
+
+		return error.empty();
+	}
+
+	// processing the last line, if it has no trailing newline
+	bool finish()
+	{
+		if (!pending.empty() && error.empty()) {
+			process(pending.data(), pending.data() + pending.size());
+			pending.clear();
+		}
+
+		return error.empty();
+	}
+
+	DimacsFormat format;
+	string leads;      // characters starting non-clause lines
+	int nv;            // largest variable seen so far
+	WeightList topw;   // the top weight (one element)
+	ClauseSet hard;    // clauses of a CNF, or hard clauses of a WCNF
+	ClauseSet soft;    // soft clauses of a WCNF
+	WeightList wght;   // their weights
+	ClauseSet negs;    // soft clauses with non-positive weights
+	WeightList nwght;  // their weights taken with the opposite sign
+	ClauseSet atms;    // literals of cardinality constraints
+	vector<int> rhs;   // their right-hand sides
+	vector<string> comments;
+	string error;
+private:
+	static bool is_space(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+	}
+
+	static const char *find_eol(const char *beg, const char *end)
+	{
+		const char *eol = (const char *)memchr(beg, '\n', end - beg);
+		return eol ? eol : end;
+	}
+
+	static bool starts_with(const char *beg, const char *end, const char *s)
+	{
+		size_t len = strlen(s);
+		return (size_t)(end - beg) >= len && memcmp(beg, s, len) == 0;
+	}
+
+	bool fail(const char *what, const char *beg, const char *end)
+	{
+		error = string(what) + " '" + string(beg, end) + "' in line "
+			+ std::to_string(lineno);
+		return false;
+	}
+
+	bool parse_int(const char *beg, const char *end, int& val)
+	{
+		const char *p = beg;
+		bool neg = false;
+
+		if (p < end && (*p == '-' || *p == '+'))
+			neg = *p++ == '-';
+
+		if (p == end)
+			return fail("invalid literal", beg, end);
+
+		long long res = 0;
+		for (; p < end; ++p) {
+			if (*p < '0' || *p > '9')
+				return fail("invalid literal", beg, end);
+
+			res = res * 10 + (*p - '0');
+			if (res > INT_MAX)
+				return fail("literal out of range", beg, end);
+		}
+
+		val = neg ? -(int)res : (int)res;
+		return true;
+	}
+
+	bool parse_wght(const char *beg, const char *end, double& val)
+	{
+		string tok(beg, end);
+		char *stop;
+
+		val = strtod(tok.c_str(), &stop);
+		if (stop != tok.c_str() + tok.size())
+			return fail("invalid weight", beg, end);
+
+		return true;
+	}
+
+	// reading literals tokens[first] .. tokens[last - 1] into the clause
+	bool parse_lits(size_t first, size_t last)
+	{
+		clause.clear();
+
+		for (size_t i = first; i < last; ++i) {
+			int l = 0;
+
+			if (!parse_int(tokens[i].first, tokens[i].second, l))
+				return false;
+
+			clause.push_back(l);
+			nv = std::max(nv, std::abs(l));
+		}
+
+		return true;
+	}
+
+	void process(const char *beg, const char *end)
+	{
+		++lineno;
+
+		while (beg < end && is_space(*beg))
+			++beg;
+		while (beg < end && is_space(end[-1]))
+			--end;
+
+		if (beg == end)
+			return;
+
+		if (leads.find(*beg) != string::npos) {
+			process_meta(beg, end);
+			return;
+		}
+
+		tokens.clear();
+		for (const char *p = beg; p < end; ) {
+			const char *q = p;
+			while (q < end && !is_space(*q))
+				++q;
+
+			tokens.push_back(make_pair(p, q));
+
+			p = q;
+			while (p < end && is_space(*p))
+				++p;
+		}
+
+		size_t nt = tokens.size();
+		bool weighted = format == DIMACS_WCNF || format == DIMACS_WCNFP;
+		bool cardinal = false;
+
+		if (format == DIMACS_CNFP || format == DIMACS_WCNFP) {
+			int last;
+
+			if (!parse_int(tokens[nt - 1].first, tokens[nt - 1].second, last))
+				return;
+
+			cardinal = last != 0;
+		}
+
+		if (cardinal) {
+			// atmost/atleast constraint: [weight] lits <= (or >=) rhs
+			int k;
+
+			if (nt < 2 || !parse_lits(weighted ? 1 : 0, nt - 2))
+				return;
+			if (!parse_int(tokens[nt - 1].first, tokens[nt - 1].second, k))
+				return;
+
+			if (*tokens[nt - 2].first == '>') {
+				for (size_t i = 0; i < clause.size(); ++i)
+					clause[i] = -clause[i];
+
+				k = clause.size() - k;
+			}
+
+			atms.add_clause_ref(clause);
+			rhs.push_back(k);
+		}
+		else if (weighted) {
+			double w;
+
+			if (!parse_wght(tokens[0].first, tokens[0].second, w))
+				return;
+			if (!parse_lits(1, nt - 1))
+				return;
+
+			if (w <= 0) {
+				// to be normalized by the caller
+				negs.add_clause_ref(clause);
+				nwght.push_neg(w, tokens[0].first, tokens[0].second);
+			}
+			else if (w >= topw.vals[0])
+				hard.add_clause_ref(clause);
+			else {
+				soft.add_clause_ref(clause);
+				wght.push(w, tokens[0].first, tokens[0].second);
+			}
+		}
+		else if (parse_lits(0, nt - 1))
+			hard.add_clause_ref(clause);
+	}
+
+	// a comment or the preamble
+	void process_meta(const char *beg, const char *end)
+	{
+		switch (format) {
+			case DIMACS_CNF:
+				if (starts_with(beg, end, "p cnf "))
+					return;
+				break;
+			case DIMACS_CNFP:
+				if (starts_with(beg, end, "p cnf"))
+					return;
+				break;
+			case DIMACS_WCNF:
+			case DIMACS_WCNFP:
+				if (starts_with(beg, end, format == DIMACS_WCNF ? "p wcnf " : "p wcnf")) {
+					// the top weight is the last token
+					const char *p = end;
+					while (p > beg && !is_space(p[-1]))
+						--p;
+
+					double w;
+					if (parse_wght(p, end, w)) {
+						topw = WeightList();
+						topw.push(w, p, end);
+					}
+
+					return;
+				}
+				break;
+		}
+
+		comments.push_back(string(beg, end));
+	}
+
+	string pending;  // incomplete line left from the previous chunk
+	size_t lineno;
+	vector<pair<const char *, const char *> > tokens;
+	vector<int> clause;
+};
+
+// buffered writer of clauses in the DIMACS format; the caller is to take
+// the contents of buf whenever full() says so and once writing is over
+//=============================================================================
+class DimacsWriter {
+public:
+	DimacsWriter(size_t capacity = 1 << 20) : cap(capacity)
+	{
+		buf.reserve(cap + 256);
+	}
+
+	bool full()
+	{
+		return buf.size() >= cap;
+	}
+
+	void put(const char *str, size_t len)
+	{
+		buf.append(str, len);
+	}
+
+	void put(const string& str)
+	{
+		buf.append(str);
+	}
+
+	void put(char c)
+	{
+		buf.push_back(c);
+	}
+
+	void put_int(int val)
+	{
+		char tmp[12];
+		char *p = tmp + sizeof(tmp);
+		unsigned u = val < 0 ? 0U - (unsigned)val : (unsigned)val;
+
+		do {
+			*--p = '0' + u % 10;
+			u /= 10;
+		} while (u);
+
+		if (val < 0)
+			*--p = '-';
+
+		buf.append(p, tmp + sizeof(tmp) - p);
+	}
+
+	// a clause is written as "[prefix ]l1 l2 ... ln 0", exactly as
+	// print() does it in pysat.formula, i.e. even if it is empty
+	void put_clause(const int *lits, size_t len, const string& prefix)
+	{
+		put_lits(lits, len, prefix);
+		put(" 0\n", 3);
+	}
+
+	// and a cardinality constraint as "[prefix ]l1 l2 ... ln <= rhs"
+	void put_atmost(const int *lits, size_t len, const string& prefix,
+			int rhs)
+	{
+		put_lits(lits, len, prefix);
+		put(" <= ", 4);
+		put_int(rhs);
+		put('\n');
+	}
+
+	void put_clauses(ClauseSet& clset, const string& prefix)
+	{
+		for (size_t i = 0; i < clset.size(); ++i)
+			put_clause(clset[i].begin(), clset[i].size(), prefix);
+	}
+
+	string buf;
+private:
+	void put_lits(const int *lits, size_t len, const string& prefix)
+	{
+		if (!prefix.empty()) {
+			put(prefix);
+			put(' ');
+		}
+
+		for (size_t i = 0; i < len; ++i) {
+			if (i)
+				put(' ');
+			put_int(lits[i]);
+		}
+	}
+
+	size_t cap;
+};
+
+#endif // DIMACS_HH_
@@ -0,0 +1,492 @@
+/*
+ * imto.hh
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef IMTO_HH_
+#define IMTO_HH_
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include "clset.hh"
+#include "itot.hh"
+
+using namespace std;
+
+// a node of an (incremental) modulo totalizer; a node with fewer than p
+// inputs is a plain totalizer node counting them in unary, while the count
+// of a larger node is split into the remainder modulo p (p - 1 lower
+// variables) and the quotient (upper variables), which are created lazily,
+// as the bound grows; the variables are stored in MtoTree::vars
+typedef struct MtoNode {
+	unsigned nof_input;
+	unsigned left;       // index of the left child (unused for leaves)
+	unsigned right;      // index of the right child (unused for leaves)
+	size_t   lvars;      // offset of the lower variables
+	unsigned nof_lvars;  // their number
+	int      carry;      // carry to the upper digit (0 if none)
+	size_t   uvars;      // offset of the upper variables
+	unsigned nof_uvars;  // their number
+	unsigned cap;        // number of slots reserved for them
+} MtoNode;
+
+// as in TotTree, children precede their parents in the pool; outs[k] is
+// the output variable implied by the sum exceeding k
+typedef struct MtoTree {
+	vector<MtoNode> nodes;
+	vector<int> vars;
+	vector<int> outs;
+	unsigned root;
+	unsigned p;
+} MtoTree;
+
+//
+//=============================================================================
+static inline int *imto_lower(MtoTree *tree, unsigned node)
+{
+	return tree->vars.data() + tree->nodes[node].lvars;
+}
+
+//
+//=============================================================================
+static inline int *imto_upper(MtoTree *tree, unsigned node)
+{
+	return tree->vars.data() + tree->nodes[node].uvars;
+}
+
+// number of upper variables a node needs for the given bound; only the
+// quotient rhs / p has to be told apart from the larger ones
+//=============================================================================
+static inline unsigned imto_nof_upper(MtoTree *tree, unsigned n, unsigned rhs)
+{
+	if (n < tree->p)
+		return 0;
+
+	return std::min(n / tree->p, rhs / tree->p + 1);
+}
+
+// appending a node with nl lower variables, a carry (if needed), and nu
+// upper variables, all of them fresh
+//=============================================================================
+static unsigned imto_add_node(
+	MtoTree *tree,
+	unsigned nof_input,
+	unsigned left,
+	unsigned right,
+	unsigned nl,
+	unsigned nu,
+	int& top
+)
+{
+	MtoNode node;
+	node.nof_input = nof_input;
+	node.left      = left;
+	node.right     = right;
+	node.lvars     = tree->vars.size();
+	node.nof_lvars = nl;
+	node.carry     = nof_input < tree->p ? 0 : ++top;
+	node.uvars     = node.lvars + nl;
+	node.nof_uvars = nu;
+	node.cap       = nu;
+
+	for (unsigned i = 0; i < nl + nu; ++i)
+		tree->vars.push_back(++top);
+
+	tree->nodes.push_back(node);
+	return tree->nodes.size() - 1;
+}
+
+// making room for nu upper variables of a node, as itot_reserve() does
+//=============================================================================
+static void imto_reserve(MtoTree *tree, unsigned node, unsigned nu)
+{
+	MtoNode& nd = tree->nodes[node];
+
+	if (nu <= nd.cap)
+		return;
+
+	unsigned cap = std::min(std::max(nu, 2 * nd.cap), nd.nof_input / tree->p);
+	size_t   beg = tree->vars.size();
+
+	tree->vars.resize(beg + cap);
+	std::copy(tree->vars.begin() + nd.uvars,
+			tree->vars.begin() + nd.uvars + nd.nof_uvars,
+			tree->vars.begin() + beg);
+
+	nd.uvars = beg;
+	nd.cap   = cap;
+}
+
+// the remainder of the sum of two digits modulo p (rv) and the carry (c);
+// a combination may set the carry instead of a remainder variable, which
+// can only make the sum look larger
+//=============================================================================
+static void imto_lower_ua(
+	ClauseSet& dest,
+	int *rv,
+	int c,
+	unsigned p,
+	int *av,
+	unsigned na,
+	int *bv,
+	unsigned nb
+)
+{
+	// i = 0
+	for (unsigned j = 1; j <= nb; ++j)
+		dest.create_ternary_clause(-bv[j - 1], rv[j - 1], c);
+
+	// j = 0
+	for (unsigned i = 1; i <= na; ++i)
+		dest.create_ternary_clause(-av[i - 1], rv[i - 1], c);
+
+	// i, j > 0
+	for (unsigned i = 1; i <= na; ++i) {
+		for (unsigned j = 1; j <= nb; ++j) {
+			if (i + j < p) {
+				vector<int> lits(4);
+				lits[0] = -av[i - 1];
+				lits[1] = -bv[j - 1];
+				lits[2] =  rv[i + j - 1];
+				lits[3] = c;
+				dest.create_clause(lits);
+			}
+			else if (i + j > p)
+				dest.create_ternary_clause(-av[i - 1], -bv[j - 1], rv[i + j - p - 1]);
+			else
+				dest.create_ternary_clause(-av[i - 1], -bv[j - 1], c);
+		}
+	}
+}
+
+// the sum of two quotients and the carry, for the upper variables
+// hv[last .. nh - 1] only; the quotient is merely saturated at nh unless
+// the node is full, i.e. nh = n / p, since it can grow later; as in
+// mto_MUA_A(), a full node forbids the combinations exceeding its maximum,
+// which is where a carry set instead of a remainder variable must not go
+//=============================================================================
+static void imto_upper_ua(
+	ClauseSet& dest,
+	int *hv,
+	unsigned last,
+	unsigned nh,
+	bool full,
+	int c,
+	int *fv,
+	unsigned nf,
+	int *gv,
+	unsigned ng
+)
+{
+	if (last == 0)
+		dest.create_binary_clause(-c, hv[0]);
+
+	// i = 0
+	for (unsigned j = 1; j <= ng; ++j) {
+		if (j > last && j <= nh)
+			dest.create_binary_clause(-gv[j - 1], hv[j - 1]);
+
+		if (j >= last && j < nh)
+			dest.create_ternary_clause(-c, -gv[j - 1], hv[j]);
+		else if (j == nh && full)
+			dest.create_binary_clause(-c, -gv[j - 1]);
+	}
+
+	// j = 0
+	for (unsigned i = 1; i <= nf; ++i) {
+		if (i > last && i <= nh)
+			dest.create_binary_clause(-fv[i - 1], hv[i - 1]);
+
+		if (i >= last && i < nh)
+			dest.create_ternary_clause(-c, -fv[i - 1], hv[i]);
+		else if (i == nh && full)
+			dest.create_binary_clause(-c, -fv[i - 1]);
+	}
+
+	// i, j > 0
+	for (unsigned i = 1; i <= nf; ++i) {
+		for (unsigned j = std::max((int)last - (int)i, 1); j <= ng; ++j) {
+			if (i + j > last) {
+				if (i + j <= nh)
+					dest.create_ternary_clause(-fv[i - 1], -gv[j - 1], hv[i + j - 1]);
+				else if (full)
+					dest.create_binary_clause(-fv[i - 1], -gv[j - 1]);
+			}
+
+			if (i + j < nh) {
+				vector<int> lits(4);
+				lits[0] = -c;
+				lits[1] = -fv[i - 1];
+				lits[2] = -gv[j - 1];
+				lits[3] =  hv[i + j];
+				dest.create_clause(lits);
+			}
+			else if (i + j == nh && full)
+				dest.create_ternary_clause(-c, -fv[i - 1], -gv[j - 1]);
+		}
+	}
+}
+
+// encoding the root of a tree whose children are already in the pool
+//=============================================================================
+static unsigned imto_new_node(
+	MtoTree *tree,
+	ClauseSet& dest,
+	unsigned l,
+	unsigned r,
+	unsigned rhs,
+	int& top
+)
+{
+	unsigned n  = tree->nodes[l].nof_input + tree->nodes[r].nof_input;
+	unsigned nl = n < tree->p ? n : tree->p - 1;
+	unsigned nu = imto_nof_upper(tree, n, rhs);
+
+	unsigned node = imto_add_node(tree, n, l, r, nl, nu, top);
+
+	MtoNode& nd = tree->nodes[node];
+	MtoNode& ln = tree->nodes[l];
+	MtoNode& rn = tree->nodes[r];
+
+	if (n < tree->p) {
+		// a plain totalizer node
+		itot_new_ua(top, dest, imto_lower(tree, node), n,
+				imto_lower(tree, l), ln.nof_lvars,
+				imto_lower(tree, r), rn.nof_lvars);
+		return node;
+	}
+
+	imto_lower_ua(dest, imto_lower(tree, node), nd.carry, tree->p,
+			imto_lower(tree, l), ln.nof_lvars,
+			imto_lower(tree, r), rn.nof_lvars);
+
+	imto_upper_ua(dest, imto_upper(tree, node), 0, nu,
+			nu == n / tree->p, nd.carry,
+			imto_upper(tree, l), ln.nof_uvars,
+			imto_upper(tree, r), rn.nof_uvars);
+
+	return node;
+}
+
+// the output variables for the bounds up to rhs; with a single (lower)
+// digit at the root, they are its variables, and otherwise sum > k holds
+// if the quotient exceeds k / p or equals it and the remainder exceeds k % p
+//=============================================================================
+static void imto_outputs(MtoTree *tree, ClauseSet& dest, unsigned rhs, int& top)
+{
+	MtoNode& root = tree->nodes[tree->root];
+	unsigned kmax = std::min(rhs + 1, root.nof_input);
+	unsigned p    = tree->p;
+
+	for (unsigned k = tree->outs.size(); k < kmax; ++k) {
+		if (root.nof_input < p) {
+			tree->outs.push_back(imto_lower(tree, tree->root)[k]);
+			continue;
+		}
+
+		int *lv = imto_lower(tree, tree->root);
+		int *uv = imto_upper(tree, tree->root);
+		int o = ++top;
+
+		unsigned ro = k / p;
+		unsigned nu = k % p;
+
+		if (ro < root.nof_uvars)
+			dest.create_binary_clause(-uv[ro], o);
+
+		for (unsigned i = nu + 1; i < p; ++i) {
+			if (ro == 0)
+				dest.create_binary_clause(-lv[i - 1], o);
+			else if (ro - 1 < root.nof_uvars)
+				dest.create_ternary_clause(-uv[ro - 1], -lv[i - 1], o);
+		}
+
+		tree->outs.push_back(o);
+	}
+}
+
+//
+//=============================================================================
+MtoTree *imto_new(
+	ClauseSet& dest,
+	vector<int>& lhs,
+	unsigned rhs,
+	unsigned p,
+	int& top
+)
+{
+	unsigned n = lhs.size();
+	deque<unsigned> nqueue;
+
+	MtoTree *tree = new MtoTree();
+	tree->nodes.reserve(2 * n);
+	tree->p = std::max(p, 2u);
+
+	// leaves output their own input literals
+	for (unsigned i = 0; i < n; ++i) {
+		MtoNode leaf;
+		leaf.nof_input = 1;
+		leaf.left      = leaf.right = 0;
+		leaf.lvars     = tree->vars.size();
+		leaf.nof_lvars = 1;
+		leaf.carry     = 0;
+		leaf.uvars     = leaf.lvars + 1;
+		leaf.nof_uvars = leaf.cap = 0;
+
+		tree->vars.push_back(lhs[i]);
+		tree->nodes.push_back(leaf);
+
+		nqueue.push_back(tree->nodes.size() - 1);
+	}
+
+	while (nqueue.size() > 1) {
+		unsigned l = nqueue.front();
+		nqueue.pop_front();
+		unsigned r = nqueue.front();
+		nqueue.pop_front();
+
+		nqueue.push_back(imto_new_node(tree, dest, l, r, rhs, top));
+	}
+
+	tree->root = nqueue.front();
+	imto_outputs(tree, dest, rhs, top);
+
+	return tree;
+}
+
+// post-order traversal of the nodes whose quotients have to grow; as in
+// itot_increase(), a subtree is skipped if its root has enough of them
+//=============================================================================
+void imto_increase(MtoTree *tree, ClauseSet& dest, unsigned rhs, int& top)
+{
+	vector<pair<unsigned, bool> > stack;  // (node, children done)
+	stack.push_back(make_pair(tree->root, false));
+
+	while (!stack.empty()) {
+		unsigned node = stack.back().first;
+		unsigned nu = imto_nof_upper(tree, tree->nodes[node].nof_input, rhs);
+
+		if (!stack.back().second) {
+			if (nu <= tree->nodes[node].nof_uvars) {
+				stack.pop_back();
+				continue;
+			}
+
+			stack.back().second = true;
+			stack.push_back(make_pair(tree->nodes[node].right, false));
+			stack.push_back(make_pair(tree->nodes[node].left,  false));
+			continue;
+		}
+
+		stack.pop_back();
+
+		// the array may get reallocated here,
+		// so the pointers are taken afterwards
+		imto_reserve(tree, node, nu);
+
+		MtoNode& nd = tree->nodes[node];
+		unsigned last = nd.nof_uvars;
+
+		int *hv = imto_upper(tree, node);
+		for (unsigned i = last; i < nu; ++i)
+			hv[i] = ++top;
+
+		imto_upper_ua(dest, hv, last, nu, nu == nd.nof_input / tree->p,
+				nd.carry,
+				imto_upper(tree, nd.left ), tree->nodes[nd.left ].nof_uvars,
+				imto_upper(tree, nd.right), tree->nodes[nd.right].nof_uvars);
+
+		nd.nof_uvars = nu;
+	}
+
+	imto_outputs(tree, dest, rhs, top);
+}
+
+// releasing the memory of the pool; the tree object itself stays valid
+//=============================================================================
+static void imto_clear(MtoTree *tree)
+{
+	vector<MtoNode>().swap(tree->nodes);
+	vector<int>().swap(tree->vars);
+	vector<int>().swap(tree->outs);
+}
+
+// the number of bytes taken by a tree, including its pool
+//=============================================================================
+static size_t imto_memory(MtoTree *tree)
+{
+	return sizeof(MtoTree) + tree->nodes.capacity() * sizeof(MtoNode) +
+		(tree->vars.capacity() + tree->outs.capacity()) * sizeof(int);
+}
+
+// the nodes of tb are moved into the pool of ta, as in itot_merge(); both
+// trees must use the same modulo; the outputs are created anew
+//=============================================================================
+MtoTree *imto_merge(
+	MtoTree *ta,
+	MtoTree *tb,
+	ClauseSet& dest,
+	unsigned rhs,
+	int& top
+)
+{
+	imto_increase(ta, dest, rhs, top);
+	imto_increase(tb, dest, rhs, top);
+
+	unsigned shift  = ta->nodes.size();
+	size_t   vshift = ta->vars.size();
+
+	ta->vars.insert(ta->vars.end(), tb->vars.begin(), tb->vars.end());
+	ta->nodes.reserve(shift + tb->nodes.size() + 1);
+
+	for (size_t i = 0; i < tb->nodes.size(); ++i) {
+		MtoNode node = tb->nodes[i];
+
+		if (node.nof_input > 1) {
+			node.left  += shift;
+			node.right += shift;
+		}
+
+		node.lvars += vshift;
+		node.uvars += vshift;
+		ta->nodes.push_back(node);
+	}
+
+	unsigned r = tb->root + shift;
+
+	imto_clear(tb);
+
+	ta->root = imto_new_node(ta, dest, ta->root, r, rhs, top);
+	ta->outs.clear();
+	imto_outputs(ta, dest, rhs, top);
+
+	return ta;
+}
+
+//
+//=============================================================================
+MtoTree *imto_extend(
+	vector<int>& newin,
+	MtoTree *ta,
+	ClauseSet& dest,
+	unsigned rhs,
+	int& top
+)
+{
+	MtoTree *tb = imto_new(dest, newin, rhs, ta->p, top);
+	imto_merge(ta, tb, dest, rhs, top);
+
+	delete tb;
+	return ta;
+}
+
+//
+//=============================================================================
+static void imto_destroy(MtoTree *tree)
+{
+	delete tree;
+}
+
+#endif // IMTO_HH_
@@ -17,83 +17,163 @@
 
 using namespace std;
 
+// a node of the tree; its (counting) output variables are stored in
+// TotTree::vars at positions vars .. vars + nof_vars - 1
+typedef struct TotNode {
+	unsigned nof_input;
+	unsigned left;      // index of the left child (unused for leaves)
+	unsigned right;     // index of the right child (unused for leaves)
+	size_t   vars;      // offset of the output variables
+	unsigned nof_vars;  // number of output variables
+	unsigned cap;       // number of slots reserved for them
+} TotNode;
+
+// all the nodes of a tree live in one pool, in which children always
+// precede their parents, and share a single array of output variables
 typedef struct TotTree {
+	vector<TotNode> nodes;
 	vector<int> vars;
-	unsigned nof_input;
-	TotTree *left;
-	TotTree *right;
+	unsigned root;
 } TotTree;
 
+//
+//=============================================================================
+static inline int *itot_outputs(TotTree *tree, unsigned node)
+{
+	return tree->vars.data() + tree->nodes[node].vars;
+}
+
+// appending a node with kmin fresh output variables
+//=============================================================================
+static unsigned itot_add_node(
+	TotTree *tree,
+	unsigned nof_input,
+	unsigned left,
+	unsigned right,
+	unsigned kmin,
+	int& top
+)
+{
+	TotNode node;
+	node.nof_input = nof_input;
+	node.left      = left;
+	node.right     = right;
+	node.vars      = tree->vars.size();
+	node.nof_vars  = kmin;
+	node.cap       = kmin;
+
+	for (unsigned i = 0; i < kmin; ++i)
+		tree->vars.push_back(++top);
+
+	tree->nodes.push_back(node);
+	return tree->nodes.size() - 1;
+}
+
+// making room for kmin output variables of a node; the old slots are
+// abandoned if the node has to be moved to the end of the array
+//=============================================================================
+static void itot_reserve(TotTree *tree, unsigned node, unsigned kmin)
+{
+	TotNode& nd = tree->nodes[node];
+
+	if (kmin <= nd.cap)
+		return;
+
+	unsigned cap = std::min(std::max(kmin, 2 * nd.cap), nd.nof_input);
+	size_t   beg = tree->vars.size();
+
+	tree->vars.resize(beg + cap);
+	std::copy(tree->vars.begin() + nd.vars,
+			tree->vars.begin() + nd.vars + nd.nof_vars,
+			tree->vars.begin() + beg);
+
+	nd.vars = beg;
+	nd.cap  = cap;
+}
+
 //
 //=============================================================================
 void itot_new_ua(
 	int& top,
 	ClauseSet& dest,
-	vector<int>& ov,
+	int *ov,
 	unsigned rhs,
-	vector<int>& av,
-	vector<int>& bv
+	int *av,
+	unsigned na,
+	int *bv,
+	unsigned nb
 )
 {
 	// i = 0
-	unsigned kmin = std::min(rhs, (unsigned)bv.size());
+	unsigned kmin = std::min(rhs, nb);
 	for (unsigned j = 0; j < kmin; ++j)
 		dest.create_binary_clause(-bv[j], ov[j]);
 
 	// j = 0
-	kmin = std::min(rhs, (unsigned)av.size());
+	kmin = std::min(rhs, na);
 	for (unsigned i = 0; i < kmin; ++i)
 		dest.create_binary_clause(-av[i], ov[i]);
 
 	// i, j > 0
 	for (unsigned i = 1; i <= kmin; ++i) {
-		unsigned minj = std::min(rhs - i, (unsigned)bv.size());
+		unsigned minj = std::min(rhs - i, nb);
 		for (unsigned j = 1; j <= minj; ++j)
 			dest.create_ternary_clause(-av[i - 1], -bv[j - 1], ov[i + j - 1]);
 	}
 }
 
+// encoding the root of a tree whose children are already in the pool
+//=============================================================================
+static unsigned itot_new_node(
+	TotTree *tree,
+	ClauseSet& dest,
+	unsigned l,
+	unsigned r,
+	unsigned rhs,
+	int& top
+)
+{
+	unsigned n    = tree->nodes[l].nof_input + tree->nodes[r].nof_input;
+	unsigned kmin = std::min(rhs + 1, n);
+
+	unsigned node = itot_add_node(tree, n, l, r, kmin, top);
+
+	itot_new_ua(top, dest, itot_outputs(tree, node), kmin,
+			itot_outputs(tree, l), tree->nodes[l].nof_vars,
+			itot_outputs(tree, r), tree->nodes[r].nof_vars);
+
+	return node;
+}
+
 //
 //=============================================================================
 TotTree *itot_new(ClauseSet& dest, vector<int>& lhs, unsigned rhs, int& top)
 {
 	unsigned n = lhs.size();
-	deque<TotTree *> nqueue;
+	deque<unsigned> nqueue;
 
-	for (unsigned i = 0; i < n; ++i) {
-		TotTree *tree = new TotTree();
+	TotTree *tree = new TotTree();
+	tree->nodes.reserve(2 * n);
 
-		tree->vars.resize(1);
-		tree->vars[0]   = lhs[i];
-		tree->nof_input = 1;
-		tree->left      = 0;
-		tree->right     = 0;
+	// leaves output their own input literals
+	for (unsigned i = 0; i < n; ++i) {
+		nqueue.push_back(itot_add_node(tree, 1, 0, 0, 0, top));
 
-		nqueue.push_back(tree);
+		tree->nodes.back().nof_vars = tree->nodes.back().cap = 1;
+		tree->vars.push_back(lhs[i]);
 	}
 
 	while (nqueue.size() > 1) {
-		TotTree *l = nqueue.front();
+		unsigned l = nqueue.front();
 		nqueue.pop_front();
-		TotTree *r = nqueue.front();
+		unsigned r = nqueue.front();
 		nqueue.pop_front();
 
-		TotTree *node = new TotTree();
-		node->nof_input = l->nof_input + r->nof_input;
-		node->left      = l;
-		node->right     = r;
-
-		unsigned kmin = std::min(rhs + 1, node->nof_input);
-
-		node->vars.resize(kmin);
-		for (unsigned i = 0; i < kmin; ++i)
-			node->vars[i] = ++top;
-
-		itot_new_ua(top, dest, node->vars, kmin, l->vars, r->vars);
-		nqueue.push_back(node);
+		nqueue.push_back(itot_new_node(tree, dest, l, r, rhs, top));
 	}
 
-	return nqueue.front();
+	tree->root = nqueue.front();
+	return tree;
 }
 
 //
@@ -101,52 +181,98 @@ TotTree *itot_new(ClauseSet& dest, vector<int>& lhs, unsigned rhs, int& top)
 void itot_increase_ua(
 	int& top,
 	ClauseSet& dest,
-	vector<int>& ov,
-	vector<int>& av,
-	vector<int>& bv,
+	int *ov,
+	unsigned last,
+	int *av,
+	unsigned na,
+	int *bv,
+	unsigned nb,
 	unsigned rhs
 )
 {
-	unsigned last = ov.size();
-
 	for (unsigned i = last; i < rhs; ++i)
-		ov.push_back(++top);
+		ov[i] = ++top;
 
 	// add the constraints
 	// i = 0
-	unsigned maxj = std::min(rhs, (unsigned)bv.size());
+	unsigned maxj = std::min(rhs, nb);
 	for (unsigned j = last; j < maxj; ++j)
 		dest.create_binary_clause(-bv[j], ov[j]);
 
 	// j = 0
-	unsigned maxi = std::min(rhs, (unsigned)av.size());
+	unsigned maxi = std::min(rhs, na);
 	for (unsigned i = last; i < maxi; ++i)
 		dest.create_binary_clause(-av[i], ov[i]);
 
 	// i, j > 0
 	for (unsigned i = 1; i <= maxi; ++i) {
-		unsigned maxj = std::min(rhs - i, (unsigned)bv.size());
+		unsigned maxj = std::min(rhs - i, nb);
 		unsigned minj = std::max((int)last - (int)i + 1, 1);
 		for (unsigned j = minj; j <= maxj; ++j)
 			dest.create_ternary_clause(-av[i - 1], -bv[j - 1], ov[i + j - 1]);
 	}
 }
 
-//
+// post-order traversal with an explicit stack; the subtrees that already
+// have enough outputs are skipped, exactly as in the recursive version
 //=============================================================================
 void itot_increase(TotTree *tree, ClauseSet& dest, unsigned rhs, int& top)
 {
-	unsigned kmin = std::min(rhs + 1, tree->nof_input);
+	vector<pair<unsigned, bool> > stack;  // (node, children done)
+	stack.push_back(make_pair(tree->root, false));
 
-	if (kmin <= tree->vars.size())
-		return;
+	while (!stack.empty()) {
+		unsigned node = stack.back().first;
+		unsigned kmin = std::min(rhs + 1, tree->nodes[node].nof_input);
 
-	itot_increase   (tree->left,  dest, rhs, top);
-	itot_increase   (tree->right, dest, rhs, top);
-	itot_increase_ua(top, dest, tree->vars, tree->left->vars, tree->right->vars, kmin);
+		if (!stack.back().second) {
+			if (kmin <= tree->nodes[node].nof_vars) {
+				stack.pop_back();
+				continue;
+			}
+
+			stack.back().second = true;
+			stack.push_back(make_pair(tree->nodes[node].right, false));
+			stack.push_back(make_pair(tree->nodes[node].left,  false));
+			continue;
+		}
+
+		stack.pop_back();
+
+		// the array may get reallocated here,
+		// so the pointers are taken afterwards
+		itot_reserve(tree, node, kmin);
+
+		TotNode& nd = tree->nodes[node];
+		TotNode& l  = tree->nodes[nd.left ];
+		TotNode& r  = tree->nodes[nd.right];
+
+		itot_increase_ua(top, dest, itot_outputs(tree, node), nd.nof_vars,
+				itot_outputs(tree, nd.left ), l.nof_vars,
+				itot_outputs(tree, nd.right), r.nof_vars, kmin);
+
+		nd.nof_vars = kmin;
+	}
 }
 
-//
+// releasing the memory of the pool; the tree object itself stays valid
+//=============================================================================
+static void itot_clear(TotTree *tree)
+{
+	vector<TotNode>().swap(tree->nodes);
+	vector<int>().swap(tree->vars);
+}
+
+// the number of bytes taken by a tree, including its pool
+//=============================================================================
+static inline size_t itot_memory(TotTree *tree)
+{
+	return sizeof(TotTree) + tree->nodes.capacity() * sizeof(TotNode) +
+		tree->vars.capacity() * sizeof(int);
+}
+
+// the nodes of tb are moved into the pool of ta, which becomes the
+// merged tree; tb is left empty and can only be destroyed afterwards
 //=============================================================================
 TotTree *itot_merge(
 	TotTree *ta,
@@ -159,20 +285,30 @@ TotTree *itot_merge(
 	itot_increase(ta, dest, rhs, top);
 	itot_increase(tb, dest, rhs, top);
 
-	unsigned n    = ta->nof_input + tb->nof_input;
-	unsigned kmin = std::min(rhs + 1, n);
+	unsigned shift  = ta->nodes.size();
+	size_t   vshift = ta->vars.size();
 
-	TotTree *tree = new TotTree();
-	tree->nof_input = n;
-	tree->left      = ta;
-	tree->right     = tb;
+	ta->vars.insert(ta->vars.end(), tb->vars.begin(), tb->vars.end());
+	ta->nodes.reserve(shift + tb->nodes.size() + 1);
 
-	tree->vars.resize(kmin);
-	for (unsigned i = 0; i < kmin; ++i)
-		tree->vars[i] = ++top;
+	for (size_t i = 0; i < tb->nodes.size(); ++i) {
+		TotNode node = tb->nodes[i];
 
-	itot_new_ua(top, dest, tree->vars, kmin, ta->vars, tb->vars);
-	return tree;
+		if (node.nof_input > 1) {
+			node.left  += shift;
+			node.right += shift;
+		}
+
+		node.vars += vshift;
+		ta->nodes.push_back(node);
+	}
+
+	unsigned r = tb->root + shift;
+
+	itot_clear(tb);
+
+	ta->root = itot_new_node(ta, dest, ta->root, r, rhs, top);
+	return ta;
 }
 
 //
@@ -186,19 +322,16 @@ TotTree *itot_extend(
 )
 {
 	TotTree *tb = itot_new(dest, newin, rhs, top);
-	return itot_merge(ta, tb, dest, rhs, top);
+	itot_merge(ta, tb, dest, rhs, top);
+
+	delete tb;
+	return ta;
 }
 
-// recursive destruction of the tree
+// the whole pool goes at once, with no traversal
 //=============================================================================
 static void itot_destroy(TotTree *tree)
 {
-	if (tree->left )
-		itot_destroy(tree->left );
-	if (tree->right)
-		itot_destroy(tree->right);
-
-	tree->vars.clear();
 	delete tree;
 }
 
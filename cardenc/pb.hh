@@ -0,0 +1,594 @@
+/*
+ * pb.hh
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef PB_HH_
+#define PB_HH_
+
+#include <algorithm>
+#include <climits>
+#include <deque>
+#include <map>
+#include <stdint.h>
+#include <vector>
+#include "clset.hh"
+
+using namespace std;
+
+// supported types of pseudo-Boolean encoding (the numbering follows
+// pysat.pb.EncType; sorting networks and binary merge are not native)
+//=============================================================================
+enum PBEncType {
+	pb_best   = 0,  // currently, the BDD encoding
+	pb_bdd    = 1,
+	pb_seqc   = 2,
+	pb_adder  = 4,
+	pb_gtot   = 6
+};
+
+// comparison operators
+//=============================================================================
+enum PBCmpType {
+	pb_leq    = 0,
+	pb_geq    = 1,
+	pb_equals = 2
+};
+
+// the sums a totalizer node can take, in increasing order, each with the
+// variable stating that the sum of the node's inputs reaches it
+typedef vector<pair<int64_t, int> > PBSums;
+
+// bringing sum(wghts[i] * lits[i]) <= rhs to a form with a single literal
+// per variable and weights in 1 .. rhs; the literals heavier than rhs are
+// falsified with unit clauses, and false is returned if nothing is left to
+// encode (the constraint is then either trivially satisfied or it has been
+// falsified with a pair of complementary unit clauses)
+//=============================================================================
+static bool pb_normalize(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t& rhs
+)
+{
+	// the coefficient of every variable (in the order of appearance),
+	// given that w * -x = w - w * x
+	map<int, size_t> pos;
+	vector<int> vars;
+	vector<int64_t> coefs;
+
+	for (size_t i = 0; i < lits.size(); ++i) {
+		int v = abs(lits[i]);
+
+		map<int, size_t>::iterator it = pos.find(v);
+		if (it == pos.end()) {
+			it = pos.insert(make_pair(v, vars.size())).first;
+			vars.push_back(v);
+			coefs.push_back(0);
+		}
+
+		if (lits[i] > 0)
+			coefs[it->second] += wghts[i];
+		else {
+			coefs[it->second] -= wghts[i];
+			rhs -= wghts[i];
+		}
+	}
+
+	// negative coefficients are turned positive in the same way
+	lits.clear();
+	wghts.clear();
+	for (size_t i = 0; i < vars.size(); ++i) {
+		if (coefs[i] > 0) {
+			lits.push_back(vars[i]);
+			wghts.push_back(coefs[i]);
+		}
+		else if (coefs[i] < 0) {
+			lits.push_back(-vars[i]);
+			wghts.push_back(-coefs[i]);
+			rhs -= coefs[i];
+		}
+	}
+
+	if (rhs < 0) {
+		int v = ++top_id;
+		clset.create_unit_clause( v);
+		clset.create_unit_clause(-v);
+		return false;
+	}
+
+	int64_t total = 0;
+	size_t k = 0;
+	for (size_t i = 0; i < lits.size(); ++i) {
+		if (wghts[i] > rhs)
+			clset.create_unit_clause(-lits[i]);
+		else {
+			lits[k] = lits[i];
+			wghts[k++] = wghts[i];
+			total += wghts[i];
+		}
+	}
+
+	lits.resize(k);
+	wghts.resize(k);
+
+	return total > rhs;
+}
+
+// the output variable of a totalizer node for a given sum
+//=============================================================================
+static inline int pb_gtot_output(PBSums& outs, int64_t sum)
+{
+	PBSums::iterator it = lower_bound(outs.begin(), outs.end(),
+			make_pair(sum, INT_MIN));
+	return it->second;
+}
+
+// a node of the generalized totalizer over lits[lo .. hi - 1]; the sums
+// exceeding rhs are all represented by rhs + 1, and they are forbidden at
+// the root rather than given an output
+//=============================================================================
+static void pb_gtot_node(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	size_t lo,
+	size_t hi,
+	int64_t rhs,
+	PBSums& outs,
+	bool root
+)
+{
+	if (hi - lo == 1) {
+		outs.push_back(make_pair(wghts[lo], lits[lo]));
+		return;
+	}
+
+	PBSums left, right;
+	pb_gtot_node(top_id, clset, lits, wghts, lo, (lo + hi) / 2, rhs, left,
+			false);
+	pb_gtot_node(top_id, clset, lits, wghts, (lo + hi) / 2, hi, rhs, right,
+			false);
+
+	if (!root) {
+		vector<int64_t> sums;
+		for (size_t i = 0; i < left.size(); ++i)
+			sums.push_back(left[i].first);
+		for (size_t j = 0; j < right.size(); ++j)
+			sums.push_back(right[j].first);
+		for (size_t i = 0; i < left.size(); ++i)
+			for (size_t j = 0; j < right.size(); ++j)
+				sums.push_back(min(left[i].first + right[j].first, rhs + 1));
+
+		sort(sums.begin(), sums.end());
+		sums.erase(unique(sums.begin(), sums.end()), sums.end());
+
+		for (size_t i = 0; i < sums.size(); ++i)
+			outs.push_back(make_pair(sums[i], ++top_id));
+	}
+
+	// a single child reaching a sum
+	for (int side = 0; side < 2; ++side) {
+		PBSums& child = side ? right : left;
+
+		for (size_t i = 0; i < child.size(); ++i) {
+			if (!root)
+				clset.create_binary_clause(-child[i].second,
+						pb_gtot_output(outs, child[i].first));
+			else if (child[i].first > rhs)
+				clset.create_unit_clause(-child[i].second);
+		}
+	}
+
+	// both children together
+	for (size_t i = 0; i < left.size(); ++i) {
+		for (size_t j = 0; j < right.size(); ++j) {
+			int64_t sum = min(left[i].first + right[j].first, rhs + 1);
+
+			if (!root)
+				clset.create_ternary_clause(-left[i].second,
+						-right[j].second, pb_gtot_output(outs, sum));
+			else if (sum > rhs)
+				clset.create_binary_clause(-left[i].second,
+						-right[j].second);
+		}
+	}
+}
+
+// generalized totalizer (Joshi, Martins, Manquinho, CP'15)
+//=============================================================================
+static void pb_gtot_encode_leq(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t rhs
+)
+{
+	PBSums outs;
+	pb_gtot_node(top_id, clset, lits, wghts, 0, lits.size(), rhs, outs,
+			true);
+}
+
+// sequential weight counter (Hoelldobler, Manthey, Steinke, KI'12); s[j]
+// states that the sum of the first i literals reaches j + 1
+//=============================================================================
+static void pb_swc_encode_leq(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t rhs
+)
+{
+	size_t n = lits.size();
+	vector<int> prev, curr;
+
+	for (size_t i = 0; i < n; ++i) {
+		int x = lits[i];
+		int64_t w = wghts[i];
+
+		// the previous sum must leave room for this literal
+		if (i > 0)
+			clset.create_binary_clause(-x, -prev[rhs - w]);
+
+		// nothing needs to be counted after the last literal
+		if (i == n - 1)
+			break;
+
+		curr.resize(rhs);
+		for (int64_t j = 0; j < rhs; ++j)
+			curr[j] = ++top_id;
+
+		for (int64_t j = 0; j < w; ++j)
+			clset.create_binary_clause(-x, curr[j]);
+
+		if (i > 0) {
+			for (int64_t j = 0; j < rhs; ++j)
+				clset.create_binary_clause(-prev[j], curr[j]);
+
+			for (int64_t j = 0; j + w < rhs; ++j)
+				clset.create_ternary_clause(-x, -prev[j], curr[j + w]);
+		}
+
+		prev.swap(curr);
+	}
+}
+
+// ordering the literals by decreasing weights
+//=============================================================================
+struct PBWeightGreater {
+	PBWeightGreater(vector<int64_t>& w) : wghts(w) {}
+
+	bool operator()(size_t i, size_t j) const
+	{
+		return wghts[i] > wghts[j];
+	}
+
+	vector<int64_t>& wghts;
+};
+
+// the terminal nodes of a BDD
+//=============================================================================
+static const int pb_bdd_true  = INT_MAX;
+static const int pb_bdd_false = INT_MIN;
+
+// a BDD node is shared by all the bounds in [lo, hi]
+//=============================================================================
+typedef struct {
+	int64_t lo;
+	int64_t hi;
+	int node;
+} PBInterval;
+
+// BDD-based encoding (Abio, Nieuwenhuis, Oliveras, Rodriguez-Carbonell,
+// CP'12); a node reduces the constraint over lits[i ..] to a bound, and the
+// nodes of a level are shared by intervals of bounds; the recursion is
+// unrolled into an explicit stack as there is a level per literal
+//=============================================================================
+static void pb_bdd_encode_leq(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t rhs
+)
+{
+	size_t n = lits.size();
+
+	// heavier literals go first, which makes the BDD smaller
+	vector<size_t> order(n);
+	for (size_t i = 0; i < n; ++i)
+		order[i] = i;
+	stable_sort(order.begin(), order.end(), PBWeightGreater(wghts));
+
+	vector<int> xs(n);
+	vector<int64_t> ws(n), rest(n + 1, 0);
+	for (size_t i = 0; i < n; ++i) {
+		xs[i] = lits[order[i]];
+		ws[i] = wghts[order[i]];
+	}
+
+	for (size_t i = n; i > 0; --i)
+		rest[i - 1] = rest[i] + ws[i - 1];
+
+	// intervals of a level, indexed by their lower ends
+	vector<map<int64_t, PBInterval> > memo(n + 1);
+
+	typedef struct {
+		size_t level;
+		int64_t bound;
+		int stage;  // the number of children computed
+		PBInterval hi;
+	} Frame;
+
+	vector<Frame> stack;
+	PBInterval res;
+
+	Frame root = { 0, rhs, 0, { 0, 0, 0 } };
+	stack.push_back(root);
+
+	while (!stack.empty()) {
+		Frame& f = stack.back();
+
+		if (f.stage == 0) {
+			if (f.bound < 0) {
+				PBInterval r = { INT64_MIN, -1, pb_bdd_false };
+				res = r;
+				stack.pop_back();
+				continue;
+			}
+
+			if (rest[f.level] <= f.bound) {
+				PBInterval r = { rest[f.level], INT64_MAX, pb_bdd_true };
+				res = r;
+				stack.pop_back();
+				continue;
+			}
+
+			map<int64_t, PBInterval>& m = memo[f.level];
+			map<int64_t, PBInterval>::iterator it = m.upper_bound(f.bound);
+			if (it != m.begin() && (--it)->second.hi >= f.bound) {
+				res = it->second;
+				stack.pop_back();
+				continue;
+			}
+
+			// the literal is true
+			f.stage = 1;
+			Frame next = { f.level + 1, f.bound - ws[f.level], 0, { 0, 0, 0 } };
+			stack.push_back(next);
+		}
+		else if (f.stage == 1) {
+			f.hi = res;
+
+			// the literal is false
+			f.stage = 2;
+			Frame next = { f.level + 1, f.bound, 0, { 0, 0, 0 } };
+			stack.push_back(next);
+		}
+		else {
+			PBInterval lo = res, hi = f.hi;
+			int64_t w = ws[f.level];
+			int x = xs[f.level];
+
+			// the bounds of the true branch, shifted to this level
+			int64_t hlo = hi.lo == INT64_MIN ? INT64_MIN : hi.lo + w;
+			int64_t hhi = hi.hi == INT64_MAX ? INT64_MAX : hi.hi + w;
+
+			PBInterval r;
+			r.lo = max(lo.lo, hlo);
+			r.hi = min(lo.hi, hhi);
+
+			if (lo.node == hi.node)
+				r.node = lo.node;  // the literal does not matter here
+			else {
+				r.node = ++top_id;
+
+				// the node holds only if its children do
+				if (lo.node == pb_bdd_false)
+					clset.create_unit_clause(-r.node);
+				else if (lo.node != pb_bdd_true)
+					clset.create_binary_clause(-r.node, lo.node);
+
+				if (hi.node == pb_bdd_false)
+					clset.create_binary_clause(-r.node, -x);
+				else if (hi.node != pb_bdd_true)
+					clset.create_ternary_clause(-r.node, -x, hi.node);
+			}
+
+			memo[f.level][r.lo] = r;
+			res = r;
+			stack.pop_back();
+		}
+	}
+
+	// the constraint is non-trivial, and so is the root
+	clset.create_unit_clause(res.node);
+}
+
+// full adder: s <-> a + b + c (mod 2) and o <-> a + b + c >= 2
+//=============================================================================
+static void pb_full_adder(
+	ClauseSet& clset,
+	int a,
+	int b,
+	int c,
+	int s,
+	int o
+)
+{
+	vector<int> cl(4);
+
+	for (int m = 0; m < 8; ++m) {
+		int va = m & 1, vb = (m >> 1) & 1, vc = (m >> 2) & 1;
+
+		// the assignment a, b, c = va, vb, vc fixes both outputs
+		cl[0] = va ? -a : a;
+		cl[1] = vb ? -b : b;
+		cl[2] = vc ? -c : c;
+
+		cl[3] = (va + vb + vc) % 2 ? s : -s;
+		clset.create_clause(cl);
+	}
+
+	clset.create_ternary_clause(-a, -b,  o);
+	clset.create_ternary_clause(-a, -c,  o);
+	clset.create_ternary_clause(-b, -c,  o);
+	clset.create_ternary_clause( a,  b, -o);
+	clset.create_ternary_clause( a,  c, -o);
+	clset.create_ternary_clause( b,  c, -o);
+}
+
+// half adder: s <-> a + b (mod 2) and o <-> a + b >= 2
+//=============================================================================
+static void pb_half_adder(ClauseSet& clset, int a, int b, int s, int o)
+{
+	clset.create_ternary_clause(-a,  b,  s);
+	clset.create_ternary_clause( a, -b,  s);
+	clset.create_ternary_clause(-a, -b, -s);
+	clset.create_ternary_clause( a,  b, -s);
+
+	clset.create_ternary_clause(-a, -b,  o);
+	clset.create_binary_clause ( a, -o);
+	clset.create_binary_clause ( b, -o);
+}
+
+// adder network (Een, Soerensson, JSAT'06); the bits of the sum are
+// compared with rhs lexicographically
+//=============================================================================
+static void pb_adder_encode_leq(
+	int& top_id,
+	ClauseSet& clset,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t rhs
+)
+{
+	vector<deque<int> > buckets;
+
+	for (size_t i = 0; i < lits.size(); ++i) {
+		for (size_t b = 0; (wghts[i] >> b) != 0; ++b) {
+			if (b >= buckets.size())
+				buckets.resize(b + 1);
+
+			if ((wghts[i] >> b) & 1)
+				buckets[b].push_back(lits[i]);
+		}
+	}
+
+	// bits of the sum, where 0 stands for a constant false
+	vector<int> bits;
+
+	for (size_t b = 0; b < buckets.size(); ++b) {
+		// the carries go to the next bucket
+		if (buckets[b].size() >= 2 && b + 1 >= buckets.size())
+			buckets.resize(b + 2);
+
+		deque<int>& q = buckets[b];
+
+		while (q.size() >= 2) {
+			int s = ++top_id, o = ++top_id;
+
+			if (q.size() >= 3) {
+				int x = q.front(); q.pop_front();
+				int y = q.front(); q.pop_front();
+				int z = q.front(); q.pop_front();
+				pb_full_adder(clset, x, y, z, s, o);
+			}
+			else {
+				int x = q.front(); q.pop_front();
+				int y = q.front(); q.pop_front();
+				pb_half_adder(clset, x, y, s, o);
+			}
+
+			q.push_back(s);
+			buckets[b + 1].push_back(o);
+		}
+
+		bits.push_back(q.empty() ? 0 : q.front());
+	}
+
+	// for every bit that is 0 in rhs, the sum may have it set only if one
+	// of the higher bits set in rhs is unset in the sum
+	for (size_t j = 0; j < bits.size(); ++j) {
+		if (bits[j] == 0 || (j < 63 && ((rhs >> j) & 1)))
+			continue;
+
+		vector<int> cl(1, -bits[j]);
+		bool sat = false;
+
+		for (size_t i = j + 1; i < bits.size() && i < 63; ++i) {
+			if ((rhs >> i) & 1) {
+				if (bits[i] == 0) {
+					sat = true;
+					break;
+				}
+
+				cl.push_back(-bits[i]);
+			}
+		}
+
+		if (!sat)
+			clset.create_clause(cl);
+	}
+}
+
+//
+//=============================================================================
+static void _encode_pb_leq(
+	ClauseSet& dest,
+	vector<int> lits,
+	vector<int64_t> wghts,
+	int64_t rhs,
+	int& top,
+	int enc
+)
+{
+	if (!pb_normalize(top, dest, lits, wghts, rhs))
+		return;
+
+	if (enc == pb_gtot)
+		pb_gtot_encode_leq(top, dest, lits, wghts, rhs);
+	else if (enc == pb_seqc)
+		pb_swc_encode_leq(top, dest, lits, wghts, rhs);
+	else if (enc == pb_adder)
+		pb_adder_encode_leq(top, dest, lits, wghts, rhs);
+	else
+		pb_bdd_encode_leq(top, dest, lits, wghts, rhs);
+}
+
+// sum(wghts[i] * lits[i]) compared with rhs; a GEQ constraint is encoded
+// as sum(wghts[i] * -lits[i]) <= sum(wghts) - rhs
+//=============================================================================
+static inline void _encode_pb(
+	ClauseSet& dest,
+	vector<int>& lits,
+	vector<int64_t>& wghts,
+	int64_t rhs,
+	int cmp,
+	int& top,
+	int enc
+)
+{
+	if (cmp != pb_geq)
+		_encode_pb_leq(dest, lits, wghts, rhs, top, enc);
+
+	if (cmp != pb_leq) {
+		vector<int> neg(lits.size());
+		int64_t total = 0;
+
+		for (size_t i = 0; i < lits.size(); ++i) {
+			neg[i] = -lits[i];
+			total += wghts[i];
+		}
+
+		_encode_pb_leq(dest, neg, wghts, total - rhs, top, enc);
+	}
+}
+
+#endif // PB_HH_
@@ -8,7 +8,9 @@
 #ifndef PTYPES_HH_
 #define PTYPES_HH_
 
+#include <stdint.h>
 #include <unordered_map>
+#include <vector>
 
 using namespace std;
 
@@ -20,9 +22,19 @@ typedef pair<int, int> IntPair;
 //=============================================================================
 class IntPairHash {
 public:
-	int operator() (IntPair pval) const
+	size_t operator() (IntPair pval) const
 	{
-		return pval.first * pval.second;
+		uint64_t h = ((uint64_t)(uint32_t)pval.first << 32)
+			| (uint32_t)pval.second;
+
+		// finalizer of MurmurHash3
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdULL;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ULL;
+		h ^= h >> 33;
+
+		return (size_t)h;
 	}
 };
 
@@ -40,4 +52,21 @@ public:
 //=============================================================================
 typedef unordered_map<IntPair, int, IntPairHash, IntPairEqual> Pair2IntMap;
 
+// a dense (i, j) -> int table for pairs ranging over a known rectangle;
+// zero stands for a missing entry
+//=============================================================================
+class Pair2IntTable {
+public:
+	Pair2IntTable(size_t nrows, size_t ncols)
+	: ncols(ncols), vals(nrows * ncols, 0) {}
+
+	int& operator() (size_t i, size_t j)
+	{
+		return vals[i * ncols + j];
+	}
+private:
+	size_t ncols;
+	vector<int> vals;
+};
+
 #endif // PTYPES_HH_
@@ -13,8 +13,16 @@
 #include <stdio.h>
 #include <Python.h>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "card.hh"
+#include "dimacs.hh"
+#include "imto.hh"
 #include "itot.hh"
+#include "pb.hh"
 
 using namespace std;
 
@@ -25,6 +33,11 @@ static char   module_docstring[] = "This module provides an interface for "
                                    "constraints";
 static char   atmost_docstring[] = "Create an AtMost(k) constraint.";
 static char  atleast_docstring[] = "Create an AtLeast(k) constraint.";
+static char     many_docstring[] = "Create many AtMost(k) constraints in "
+				   "parallel.";
+static char    cache_docstring[] = "Drop the cached encodings and set the "
+				   "size of the cache.";
+static char  cachemem_docstring[] = "Get the memory used by the cache.";
 static char itot_new_docstring[] = "Create an iterative totalizer object for "
                                    "an AtMost(k) constraint.";
 static char itot_inc_docstring[] = "Increase bound in an iterative totalizer "
@@ -33,6 +46,28 @@ static char itot_ext_docstring[] = "Extends the set of inputs in an iterative"
 				   " totalizer object.";
 static char itot_mrg_docstring[] = "Merge two totalizer objects into one.";
 static char itot_del_docstring[] = "Delete an iterative totalizer object";
+static char itot_mem_docstring[] = "Get the memory used by an iterative "
+				   "totalizer object.";
+static char imto_new_docstring[] = "Create an incremental modulo totalizer "
+				   "object for an AtMost(k) constraint.";
+static char imto_inc_docstring[] = "Increase bound in an incremental modulo "
+				   "totalizer object.";
+static char imto_ext_docstring[] = "Extends the set of inputs in an "
+				   "incremental modulo totalizer object.";
+static char imto_mrg_docstring[] = "Merge two modulo totalizer objects into "
+				   "one.";
+static char imto_del_docstring[] = "Delete an incremental modulo totalizer "
+				   "object";
+static char imto_mem_docstring[] = "Get the memory used by an incremental "
+				   "modulo totalizer object.";
+static char dmcs_new_docstring[] = "Create a parser of DIMACS-like formats.";
+static char dmcs_fed_docstring[] = "Parse a chunk of text.";
+static char dmcs_map_docstring[] = "Parse a memory-mapped file.";
+static char dmcs_res_docstring[] = "Get the formula parsed.";
+static char dmcs_wrt_docstring[] = "Write clauses in the DIMACS format.";
+static char clpk_docstring[] = "Pack clauses into a flat buffer.";
+static char clix_docstring[] = "Index the clauses of a flat buffer.";
+static char       pb_docstring[] = "Create a pseudo-Boolean constraint.";
 
 static PyObject *CardError;
 static jmp_buf env;
@@ -42,11 +77,29 @@ static jmp_buf env;
 extern "C" {
 	static PyObject *py_encode_atmost  (PyObject *, PyObject *);
 	static PyObject *py_encode_atleast (PyObject *, PyObject *);
+	static PyObject *py_encode_many    (PyObject *, PyObject *);
+	static PyObject *py_encode_cache   (PyObject *, PyObject *);
+	static PyObject *py_encode_memory  (PyObject *, PyObject *);
+	static PyObject *py_encode_pb      (PyObject *, PyObject *);
 	static PyObject *py_itot_new       (PyObject *, PyObject *);
 	static PyObject *py_itot_inc       (PyObject *, PyObject *);
 	static PyObject *py_itot_ext       (PyObject *, PyObject *);
 	static PyObject *py_itot_mrg       (PyObject *, PyObject *);
 	static PyObject *py_itot_del       (PyObject *, PyObject *);
+	static PyObject *py_itot_mem       (PyObject *, PyObject *);
+	static PyObject *py_imto_new       (PyObject *, PyObject *);
+	static PyObject *py_imto_inc       (PyObject *, PyObject *);
+	static PyObject *py_imto_ext       (PyObject *, PyObject *);
+	static PyObject *py_imto_mrg       (PyObject *, PyObject *);
+	static PyObject *py_imto_del       (PyObject *, PyObject *);
+	static PyObject *py_imto_mem       (PyObject *, PyObject *);
+	static PyObject *py_dimacs_new     (PyObject *, PyObject *);
+	static PyObject *py_dimacs_feed    (PyObject *, PyObject *);
+	static PyObject *py_dimacs_map     (PyObject *, PyObject *);
+	static PyObject *py_dimacs_result  (PyObject *, PyObject *);
+	static PyObject *py_dimacs_write   (PyObject *, PyObject *);
+	static PyObject *py_clauses_pack   (PyObject *, PyObject *);
+	static PyObject *py_clauses_index  (PyObject *, PyObject *);
 }
 
 // module specification
@@ -54,11 +107,29 @@ extern "C" {
 static PyMethodDef module_methods[] = {
 	{ "encode_atmost",  py_encode_atmost,  METH_VARARGS,   atmost_docstring },
 	{ "encode_atleast", py_encode_atleast, METH_VARARGS,  atleast_docstring },
+	{ "encode_many",    py_encode_many,    METH_VARARGS,     many_docstring },
+	{ "encode_cache",   py_encode_cache,   METH_VARARGS,    cache_docstring },
+	{ "encode_memory",  py_encode_memory,  METH_VARARGS, cachemem_docstring },
+	{ "encode_pb",      py_encode_pb,      METH_VARARGS,       pb_docstring },
 	{ "itot_new",       py_itot_new,       METH_VARARGS, itot_new_docstring },
 	{ "itot_inc",       py_itot_inc,       METH_VARARGS, itot_inc_docstring },
 	{ "itot_ext",       py_itot_ext,       METH_VARARGS, itot_ext_docstring },
 	{ "itot_mrg",       py_itot_mrg,       METH_VARARGS, itot_mrg_docstring },
 	{ "itot_del",       py_itot_del,       METH_VARARGS, itot_del_docstring },
+	{ "itot_mem",       py_itot_mem,       METH_VARARGS, itot_mem_docstring },
+	{ "imto_new",       py_imto_new,       METH_VARARGS, imto_new_docstring },
+	{ "imto_inc",       py_imto_inc,       METH_VARARGS, imto_inc_docstring },
+	{ "imto_ext",       py_imto_ext,       METH_VARARGS, imto_ext_docstring },
+	{ "imto_mrg",       py_imto_mrg,       METH_VARARGS, imto_mrg_docstring },
+	{ "imto_del",       py_imto_del,       METH_VARARGS, imto_del_docstring },
+	{ "imto_mem",       py_imto_mem,       METH_VARARGS, imto_mem_docstring },
+	{ "dimacs_new",     py_dimacs_new,     METH_VARARGS, dmcs_new_docstring },
+	{ "dimacs_feed",    py_dimacs_feed,    METH_VARARGS, dmcs_fed_docstring },
+	{ "dimacs_map",     py_dimacs_map,     METH_VARARGS, dmcs_map_docstring },
+	{ "dimacs_result",  py_dimacs_result,  METH_VARARGS, dmcs_res_docstring },
+	{ "dimacs_write",   py_dimacs_write,   METH_VARARGS, dmcs_wrt_docstring },
+	{ "clauses_pack",   py_clauses_pack,   METH_VARARGS,     clpk_docstring },
+	{ "clauses_index",  py_clauses_index,  METH_VARARGS,     clix_docstring },
 
 	{ NULL, NULL, 0, NULL }
 };
@@ -87,18 +158,85 @@ static PyObject *pyint_from_cint(int i)
 	return PyLong_FromLong(i);
 }
 
-// PyCapsule_New()
+// PyCapsule_GetPointer()
 //=============================================================================
-static PyObject *void_to_pyobj(void *ptr)
+static void *pyobj_to_void(PyObject *obj)
 {
-	return PyCapsule_New(ptr, NULL, NULL);
+	return PyCapsule_GetPointer(obj, NULL);
 }
 
-// PyCapsule_GetPointer()
+// capsule destructor of a totalizer tree
 //=============================================================================
-static void *pyobj_to_void(PyObject *obj)
+static void tree_free(PyObject *obj)
 {
-	return PyCapsule_GetPointer(obj, NULL);
+	itot_destroy((TotTree *)PyCapsule_GetPointer(obj, NULL));
+}
+
+// PyCapsule_New() owning the tree
+//=============================================================================
+static PyObject *tree_to_pyobj(TotTree *tree)
+{
+	return PyCapsule_New((void *)tree, NULL, tree_free);
+}
+
+// capsule destructor of a modulo totalizer tree
+//=============================================================================
+static void mtree_free(PyObject *obj)
+{
+	imto_destroy((MtoTree *)PyCapsule_GetPointer(obj, NULL));
+}
+
+// PyCapsule_New() owning the modulo totalizer tree
+//=============================================================================
+static PyObject *mtree_to_pyobj(MtoTree *tree)
+{
+	return PyCapsule_New((void *)tree, NULL, mtree_free);
+}
+
+// capsule destructor of a DIMACS parser
+//=============================================================================
+static void parser_free(PyObject *obj)
+{
+	delete (DimacsParser *)PyCapsule_GetPointer(obj, NULL);
+}
+
+// PyCapsule_New() owning the parser
+//=============================================================================
+static PyObject *parser_to_pyobj(DimacsParser *parser)
+{
+	return PyCapsule_New((void *)parser, NULL, parser_free);
+}
+
+// PyUnicode_DecodeUTF8()
+//=============================================================================
+static PyObject *pystr_from_string(const string& str)
+{
+	return PyUnicode_DecodeUTF8(str.data(), str.size(), "replace");
+}
+
+// PyBytes_FromStringAndSize()
+//=============================================================================
+static PyObject *pybytes_from_string(const string& str)
+{
+	return PyBytes_FromStringAndSize(str.data(), str.size());
+}
+
+// str(obj) encoded in UTF-8
+//=============================================================================
+static bool pyobj_to_string(PyObject *obj, string& str)
+{
+	PyObject *s_obj = PyObject_Str(obj);
+	if (s_obj == NULL)
+		return false;
+
+	Py_ssize_t len;
+	const char *data = PyUnicode_AsUTF8AndSize(s_obj, &len);
+
+	if (data)
+		str.assign(data, len);
+
+	Py_DECREF(s_obj);
+	return data != NULL;
 }
 
 // PyInt_Check()
@@ -154,18 +292,81 @@ static PyObject *pyint_from_cint(int i)
 	return PyInt_FromLong(i);
 }
 
-// PyCObject_FromVoidPtr()
+// PyCObject_AsVoidPtr()
 //=============================================================================
-static PyObject *void_to_pyobj(void *ptr)
+static void *pyobj_to_void(PyObject *obj)
 {
-	return PyCObject_FromVoidPtr(ptr, NULL);
+	return PyCObject_AsVoidPtr(obj);
 }
 
-// PyCObject_AsVoidPtr()
+// CObject destructor of a totalizer tree
 //=============================================================================
-static void *pyobj_to_void(PyObject *obj)
+static void tree_free(void *ptr)
 {
-	return PyCObject_AsVoidPtr(obj);
+	itot_destroy((TotTree *)ptr);
+}
+
+// PyCObject_FromVoidPtr() owning the tree
+//=============================================================================
+static PyObject *tree_to_pyobj(TotTree *tree)
+{
+	return PyCObject_FromVoidPtr((void *)tree, tree_free);
+}
+
+// CObject destructor of a modulo totalizer tree
+//=============================================================================
+static void mtree_free(void *ptr)
+{
+	imto_destroy((MtoTree *)ptr);
+}
+
+// PyCObject_FromVoidPtr() owning the modulo totalizer tree
+//=============================================================================
+static PyObject *mtree_to_pyobj(MtoTree *tree)
+{
+	return PyCObject_FromVoidPtr((void *)tree, mtree_free);
+}
+
+// CObject destructor of a DIMACS parser
+//=============================================================================
+static void parser_free(void *ptr)
+{
+	delete (DimacsParser *)ptr;
+}
+
+// PyCObject_FromVoidPtr() owning the parser
+//=============================================================================
+static PyObject *parser_to_pyobj(DimacsParser *parser)
+{
+	return PyCObject_FromVoidPtr((void *)parser, parser_free);
+}
+
+// PyString_FromStringAndSize()
+//=============================================================================
+static PyObject *pystr_from_string(const string& str)
+{
+	return PyString_FromStringAndSize(str.data(), str.size());
+}
+
+// PyString_FromStringAndSize()
+//=============================================================================
+static PyObject *pybytes_from_string(const string& str)
+{
+	return PyString_FromStringAndSize(str.data(), str.size());
+}
+
+// str(obj)
+//=============================================================================
+static bool pyobj_to_string(PyObject *obj, string& str)
+{
+	PyObject *s_obj = PyObject_Str(obj);
+	if (s_obj == NULL)
+		return false;
+
+	str.assign(PyString_AS_STRING(s_obj), PyString_GET_SIZE(s_obj));
+
+	Py_DECREF(s_obj);
+	return true;
 }
 
 // PyInt_Check()
@@ -228,42 +429,74 @@ static bool pyiter_to_vector(PyObject *obj, vector<int>& vect)
 	return true;
 }
 
-//
+// auxiliary function for translating an iterable of integer weights to a
+// vector<int64_t>
 //=============================================================================
-static PyObject *py_encode_atmost(PyObject *self, PyObject *args)
+static bool pyiter_to_weights(PyObject *obj, vector<int64_t>& vect)
 {
-	PyObject *lhs_obj;
-	int rhs;
-	int top;
-	int enc;
-	int main_thread;
+	PyObject *i_obj = PyObject_GetIter(obj);
 
-	if (!PyArg_ParseTuple(args, "Oiiii", &lhs_obj, &rhs, &top, &enc,
-				&main_thread))
-		return NULL;
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return false;
+	}
 
-	vector<int> lhs;
-	if (pyiter_to_vector(lhs_obj, lhs) == false)
-		return NULL;
+	PyObject *w_obj;
+	while ((w_obj = PyIter_Next(i_obj)) != NULL) {
+		long long w = PyLong_AsLongLong(w_obj);
+		Py_DECREF(w_obj);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+		if (w == -1 && PyErr_Occurred()) {
+			Py_DECREF(i_obj);
+			return false;
+		}
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(CardError, "Caught keyboard interrupt");
+		vect.push_back(w);
+	}
+
+	Py_DECREF(i_obj);
+	return !PyErr_Occurred();
+}
+
+// auxiliary function for translating a clause set to a list of lists or,
+// if flat is set, to a pair of a zero-terminated int32 buffer and the
+// number of clauses in it; the buffer can be fed to a solver as is
+//=============================================================================
+static PyObject *pyclauses_from_clset(ClauseSet& dest, int flat)
+{
+	if (flat) {
+		const vector<int>& lits = dest.get_literals();
+		const vector<size_t>& offs = dest.get_offsets();
+
+		PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+				(lits.size() + dest.size()) * sizeof(int32_t));
+		if (b_obj == NULL)
 			return NULL;
+
+		int32_t *buf = (int32_t *)PyBytes_AS_STRING(b_obj);
+		for (size_t i = 0, k = 0; i < dest.size(); ++i) {
+			for (size_t j = offs[i]; j < offs[i + 1]; ++j)
+				buf[k++] = lits[j];
+
+			buf[k++] = 0;
 		}
-	}
 
-	// calling encoder
-	ClauseSet dest;
-	_encode_atmost(dest, lhs, rhs, top, enc);
+#if PY_MAJOR_VERSION >= 3
+		PyObject *v_obj = PyMemoryView_FromObject(b_obj);
+		Py_DECREF(b_obj);
+		if (v_obj == NULL)
+			return NULL;
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+		b_obj = PyObject_CallMethod(v_obj, (char *)"cast", (char *)"s", "i");
+		Py_DECREF(v_obj);
+		if (b_obj == NULL)
+			return NULL;
+#endif
+
+		return Py_BuildValue("(Nn)", b_obj, (Py_ssize_t)dest.size());
+	}
 
-	// creating the resulting clause set
 	PyObject *dest_obj = PyList_New(dest.size());
 	for (size_t i = 0; i < dest.size(); ++i) {
 		PyObject *cl_obj = PyList_New(dest[i].size());
@@ -276,157 +509,849 @@ static PyObject *py_encode_atmost(PyObject *self, PyObject *args)
 		PyList_SetItem(dest_obj, i, cl_obj);
 	}
 
-	if (dest.size()) {
-		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
-		Py_DECREF(dest_obj);
-		return ret;
-	}
-	else {
-		Py_DECREF(dest_obj);
-		Py_RETURN_NONE;
-	}
+	return dest_obj;
 }
 
-//
+// auxiliary function for translating a list of weights to Python; integral
+// weights become integers while the others are turned into decimals
 //=============================================================================
-static PyObject *py_encode_atleast(PyObject *self, PyObject *args)
+static PyObject *pyweights_from_list(WeightList& wl)
 {
-	PyObject *lhs_obj;
-	int rhs;
-	int top;
-	int enc;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "Oiiii", &lhs_obj, &rhs, &top, &enc,
-				&main_thread))
-		return NULL;
-
-	vector<int> lhs;
-	if (pyiter_to_vector(lhs_obj, lhs) == false)
-		return NULL;
+	PyObject *dec_obj = NULL;  // decimal.Decimal
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	if (wl.frac.size()) {
+		PyObject *mod_obj = PyImport_ImportModule("decimal");
+		if (mod_obj == NULL)
+			return NULL;
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(CardError, "Caught keyboard interrupt");
+		dec_obj = PyObject_GetAttrString(mod_obj, "Decimal");
+		Py_DECREF(mod_obj);
+		if (dec_obj == NULL)
 			return NULL;
-		}
 	}
 
-	// calling encoder
-	ClauseSet dest;
-	_encode_atleast(dest, lhs, rhs, top, enc);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	PyObject *w_obj = PyList_New(wl.size());
+	for (size_t i = 0, j = 0; i < wl.size(); ++i) {
+		PyObject *v_obj;
 
-	// creating the resulting clause set
-	PyObject *dest_obj = PyList_New(dest.size());
-	for (size_t i = 0; i < dest.size(); ++i) {
-		PyObject *cl_obj = PyList_New(dest[i].size());
+		if (j < wl.frac.size() && wl.frac[j] == i)
+			v_obj = PyObject_CallFunction(dec_obj, (char *)"s",
+					wl.tokens[j++].c_str());
+		else
+			v_obj = PyLong_FromDouble(wl.vals[i]);
 
-		for (size_t j = 0; j < dest[i].size(); ++j) {
-			PyObject *lit_obj = pyint_from_cint(dest[i][j]);
-			PyList_SetItem(cl_obj, j, lit_obj);
+		if (v_obj == NULL) {
+			Py_XDECREF(dec_obj);
+			Py_DECREF(w_obj);
+			return NULL;
 		}
 
-		PyList_SetItem(dest_obj, i, cl_obj);
+		PyList_SetItem(w_obj, i, v_obj);
 	}
 
-	if (dest.size()) {
-		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
-		Py_DECREF(dest_obj);
-		return ret;
+	Py_XDECREF(dec_obj);
+	return w_obj;
+}
 
-	}
-	else {
-		Py_DECREF(dest_obj);
-		Py_RETURN_NONE;
+// auxiliary function for translating the cardinality constraints parsed
+// to a list of pairs [lits, rhs]
+//=============================================================================
+static PyObject *pyatmosts_from_parser(DimacsParser *parser)
+{
+	PyObject *cls_obj = pyclauses_from_clset(parser->atms, 0);
+	if (cls_obj == NULL)
+		return NULL;
+
+	PyObject *am_obj = PyList_New(parser->rhs.size());
+	for (size_t i = 0; i < parser->rhs.size(); ++i) {
+		PyObject *cl_obj = PyList_GetItem(cls_obj, i);
+		Py_INCREF(cl_obj);
+
+		PyList_SetItem(am_obj, i, Py_BuildValue("[NN]", cl_obj,
+					pyint_from_cint(parser->rhs[i])));
 	}
 
+	Py_DECREF(cls_obj);
+	return am_obj;
 }
 
-//
+// auxiliary function for translating the soft clauses with non-positive
+// weights to a list of pairs (clause, -weight)
 //=============================================================================
-static PyObject *py_itot_new(PyObject *self, PyObject *args)
+static PyObject *pynegs_from_parser(DimacsParser *parser)
 {
-	PyObject *lhs_obj;
-	int rhs;
-	int top;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "Oiii", &lhs_obj, &rhs, &top, &main_thread))
+	PyObject *cls_obj = pyclauses_from_clset(parser->negs, 0);
+	if (cls_obj == NULL)
 		return NULL;
 
-	vector<int> lhs;
-	if (pyiter_to_vector(lhs_obj, lhs) == false)
+	PyObject *wts_obj = pyweights_from_list(parser->nwght);
+	if (wts_obj == NULL) {
+		Py_DECREF(cls_obj);
 		return NULL;
+	}
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	PyObject *ng_obj = PyList_New(parser->negs.size());
+	for (size_t i = 0; i < parser->negs.size(); ++i) {
+		PyObject *cl_obj = PyList_GetItem(cls_obj, i);
+		PyObject *wt_obj = PyList_GetItem(wts_obj, i);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(CardError, "Caught keyboard interrupt");
-			return NULL;
-		}
+		PyList_SetItem(ng_obj, i, Py_BuildValue("(OO)", cl_obj, wt_obj));
 	}
 
-	// calling encoder
-	ClauseSet dest;
-	TotTree *tree = itot_new(dest, lhs, rhs, top);
+	Py_DECREF(cls_obj);
+	Py_DECREF(wts_obj);
+	return ng_obj;
+}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+// passing the contents of a writer's buffer to a Python write() method
+//=============================================================================
+static bool pywriter_flush(PyObject *write_obj, DimacsWriter& writer, int text)
+{
+	if (writer.buf.empty())
+		return true;
 
-	// creating the resulting clause set
-	PyObject *dest_obj = PyList_New(dest.size());
-	for (size_t i = 0; i < dest.size(); ++i) {
-		PyObject *cl_obj = PyList_New(dest[i].size());
+	PyObject *c_obj = text ? pystr_from_string(writer.buf)
+		: pybytes_from_string(writer.buf);
+	if (c_obj == NULL)
+		return false;
 
-		for (size_t j = 0; j < dest[i].size(); ++j) {
-			PyObject *lit_obj = pyint_from_cint(dest[i][j]);
-			PyList_SetItem(cl_obj, j, lit_obj);
-		}
+	writer.buf.clear();
 
-		PyList_SetItem(dest_obj, i, cl_obj);
-	}
+	PyObject *r_obj = PyObject_CallFunctionObjArgs(write_obj, c_obj, NULL);
+	Py_DECREF(c_obj);
 
-	// creating the upper-bounds (right-hand side)
-	PyObject *ubs_obj = PyList_New(tree->vars.size());
-	for (size_t i = 0; i < tree->vars.size(); ++i) {
-		PyObject *ub_obj = pyint_from_cint(tree->vars[i]);
-		PyList_SetItem(ubs_obj, i, ub_obj);
+	if (r_obj == NULL)
+		return false;
+
+	Py_DECREF(r_obj);
+	return true;
+}
+
+// auxiliary function for fetching the next weight of a clause to be written
+//=============================================================================
+static bool pyweight_next(PyObject *wi_obj, string& pref)
+{
+	PyObject *w_obj = PyIter_Next(wi_obj);
+
+	if (w_obj == NULL) {
+		if (!PyErr_Occurred())
+			PyErr_SetString(PyExc_ValueError, "too few weights");
+		return false;
 	}
 
-	PyObject *ret = Py_BuildValue("OOOn", void_to_pyobj((void *)tree),
-				dest_obj, ubs_obj, (Py_ssize_t)top);
+	bool ok = pyobj_to_string(w_obj, pref);
+	Py_DECREF(w_obj);
 
-	Py_DECREF(dest_obj);
-	Py_DECREF( ubs_obj);
-	return ret;
+	return ok;
 }
 
-//
+// auxiliary function for reading a clause given as a Python iterable
 //=============================================================================
-static PyObject *py_itot_inc(PyObject *self, PyObject *args)
+static bool pyclause_to_vector(PyObject *cl_obj, vector<int>& cl)
 {
-	PyObject *t_obj;
-	int rhs;
-	int top;
-	int main_thread;
+	PyObject *seq_obj = PySequence_Fast(cl_obj, "clause must be iterable");
+	if (seq_obj == NULL)
+		return false;
 
-	if (!PyArg_ParseTuple(args, "Oiii", &t_obj, &rhs, &top, &main_thread))
-		return NULL;
+	Py_ssize_t n = PySequence_Fast_GET_SIZE(seq_obj);
+	PyObject **items = PySequence_Fast_ITEMS(seq_obj);
 
-	// get pointer to tree
-	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+	cl.resize(n);
+	for (Py_ssize_t i = 0; i < n; ++i) {
+		if (!pyint_check(items[i])) {
+			Py_DECREF(seq_obj);
+			PyErr_SetString(PyExc_TypeError, "integer expected");
+			return false;
+		}
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+		cl[i] = pyint_to_cint(items[i]);
+	}
+
+	Py_DECREF(seq_obj);
+	return true;
+}
+
+#if PY_MAJOR_VERSION >= 3
+// auxiliary function for accessing a flat zero-terminated int32 buffer
+//=============================================================================
+static bool pybuf_get_int32(PyObject *obj, Py_buffer *view)
+{
+	if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0)
+		return false;
+
+	const char *fmt = view->format ? view->format : "B";
+	if (*fmt == '@' || *fmt == '=')
+		++fmt;
+
+	if (view->itemsize != 4 || (strcmp(fmt, "i") && strcmp(fmt, "l"))) {
+		PyBuffer_Release(view);
+		PyErr_SetString(PyExc_TypeError, "buffer of int32 expected");
+		return false;
+	}
+
+	return true;
+}
+#endif
+
+// auxiliary function for creating the list of upper-bound (output)
+// variables of a totalizer tree
+//=============================================================================
+static PyObject *pyubs_from_tree(TotTree *tree)
+{
+	TotNode& root = tree->nodes[tree->root];
+	int *ubs = itot_outputs(tree, tree->root);
+
+	PyObject *ubs_obj = PyList_New(root.nof_vars);
+	for (unsigned i = 0; i < root.nof_vars; ++i) {
+		PyObject *ub_obj = pyint_from_cint(ubs[i]);
+		PyList_SetItem(ubs_obj, i, ub_obj);
+	}
+
+	return ubs_obj;
+}
+
+// the same for the output variables of a modulo totalizer tree
+//=============================================================================
+static PyObject *pyubs_from_mtree(MtoTree *tree)
+{
+	PyObject *ubs_obj = PyList_New(tree->outs.size());
+	for (size_t i = 0; i < tree->outs.size(); ++i) {
+		PyObject *ub_obj = pyint_from_cint(tree->outs[i]);
+		PyList_SetItem(ubs_obj, i, ub_obj);
+	}
+
+	return ubs_obj;
+}
+
+// encoding an AtMostK constraint through the cache of templates; only the
+// construction of a missing template can be interrupted, as an interrupt
+// must not leave the cache locked
+//=============================================================================
+static bool encode_atmost_cached(ClauseSet& dest, vector<int>& lhs, int rhs,
+		int& top, int enc, int main_thread)
+{
+	bool cached = card_cache.enabled();
+
+	shared_ptr<CardTemplate> tmpl;
+	if (cached)
+		tmpl = card_cache.find(lhs.size(), rhs, enc);
+
+	if (!tmpl) {
+		PyOS_sighandler_t sig_save;
+		if (main_thread) {
+			sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+			if (setjmp(env) != 0) {
+				PyOS_setsig(SIGINT, sig_save);
+				PyErr_SetString(CardError, "Caught keyboard interrupt");
+				return false;
+			}
+		}
+
+		if (cached)
+			tmpl = _card_template(lhs.size(), rhs, enc);
+		else
+			_encode_atmost(dest, lhs, rhs, top, enc);
+
+		if (main_thread)
+			PyOS_setsig(SIGINT, sig_save);
+
+		if (!cached)
+			return true;
+
+		card_cache.insert(rhs, enc, tmpl);
+	}
+
+	_card_apply(dest, *tmpl, lhs, top);
+	return true;
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_atmost(PyObject *self, PyObject *args)
+{
+	PyObject *lhs_obj;
+	int rhs;
+	int top;
+	int enc;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiiii|i", &lhs_obj, &rhs, &top, &enc,
+				&main_thread, &flat))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	// calling encoder
+	ClauseSet dest;
+	if (encode_atmost_cached(dest, lhs, rhs, top, enc, main_thread) == false)
+		return NULL;
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	if (dest.size()) {
+		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
+		Py_DECREF(dest_obj);
+		return ret;
+	}
+	else {
+		Py_DECREF(dest_obj);
+		Py_RETURN_NONE;
+	}
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_atleast(PyObject *self, PyObject *args)
+{
+	PyObject *lhs_obj;
+	int rhs;
+	int top;
+	int enc;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiiii|i", &lhs_obj, &rhs, &top, &enc,
+				&main_thread, &flat))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	// calling encoder
+	ClauseSet dest;
+	if (rhs == 1)
+		common_encode_atleast1(dest, lhs);
+	else {
+		// AtLeastK is AtMost(n - k) over the negated literals
+		for (size_t i = 0; i < lhs.size(); ++i)
+			lhs[i] = -lhs[i];
+
+		if (encode_atmost_cached(dest, lhs, lhs.size() - rhs, top, enc,
+					main_thread) == false)
+			return NULL;
+	}
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	if (dest.size()) {
+		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
+		Py_DECREF(dest_obj);
+		return ret;
+
+	}
+	else {
+		Py_DECREF(dest_obj);
+		Py_RETURN_NONE;
+	}
+
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_many(PyObject *self, PyObject *args)
+{
+	PyObject *c_obj;  // constraints
+	int top;
+	int enc;
+	int nof_threads;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiii|i", &c_obj, &top, &enc, &nof_threads,
+				&flat))
+		return NULL;
+
+	PyObject *i_obj = PyObject_GetIter(c_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return NULL;
+	}
+
+	// pairs of a list of literals and a bound
+	vector<vector<int> > lhss;
+	vector<int> rhss;
+
+	PyObject *p_obj;
+	while ((p_obj = PyIter_Next(i_obj)) != NULL) {
+		PyObject *seq_obj = PySequence_Fast(p_obj, "pair expected");
+		Py_DECREF(p_obj);
+
+		if (seq_obj == NULL || PySequence_Fast_GET_SIZE(seq_obj) != 2) {
+			if (seq_obj != NULL) {
+				Py_DECREF(seq_obj);
+				PyErr_SetString(PyExc_TypeError, "pair expected");
+			}
+
+			Py_DECREF(i_obj);
+			return NULL;
+		}
+
+		PyObject *l_obj = PySequence_Fast_GET_ITEM(seq_obj, 0);
+		PyObject *k_obj = PySequence_Fast_GET_ITEM(seq_obj, 1);
+
+		lhss.push_back(vector<int>());
+		if (pyiter_to_vector(l_obj, lhss.back()) == false ||
+				!pyint_check(k_obj)) {
+			if (!PyErr_Occurred())
+				PyErr_SetString(PyExc_TypeError, "integer expected");
+
+			Py_DECREF(seq_obj);
+			Py_DECREF(i_obj);
+			return NULL;
+		}
+
+		rhss.push_back(pyint_to_cint(k_obj));
+		Py_DECREF(seq_obj);
+	}
+
+	Py_DECREF(i_obj);
+
+	if (PyErr_Occurred())
+		return NULL;
+
+	// the threads cannot be interrupted midway; a keyboard
+	// interrupt is raised by Python once the batch is done
+	ClauseSet dest;
+
+	Py_BEGIN_ALLOW_THREADS
+	_encode_atmost_many(dest, lhss, rhss, top, enc,
+			nof_threads > 0 ? nof_threads : 0);
+	Py_END_ALLOW_THREADS
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	if (dest.size()) {
+		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
+		Py_DECREF(dest_obj);
+		return ret;
+	}
+	else {
+		Py_DECREF(dest_obj);
+		Py_RETURN_NONE;
+	}
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_cache(PyObject *self, PyObject *args)
+{
+	Py_ssize_t max_lits;
+
+	if (!PyArg_ParseTuple(args, "n", &max_lits))
+		return NULL;
+
+	card_cache.reset(max_lits > 0 ? (size_t)max_lits : 0);
+	Py_RETURN_NONE;
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_memory(PyObject *self, PyObject *args)
+{
+	if (!PyArg_ParseTuple(args, ""))
+		return NULL;
+
+	return PyLong_FromSize_t(card_cache.memory());
+}
+
+//
+//=============================================================================
+static PyObject *py_encode_pb(PyObject *self, PyObject *args)
+{
+	PyObject *lhs_obj;
+	PyObject *wght_obj;
+	long long rhs;
+	int cmp;
+	int top;
+	int enc;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOLiiii", &lhs_obj, &wght_obj, &rhs, &cmp,
+				&top, &enc, &main_thread))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	vector<int64_t> wghts;
+	if (pyiter_to_weights(wght_obj, wghts) == false)
+		return NULL;
+
+	if (lhs.size() != wghts.size()) {
+		PyErr_SetString(PyExc_ValueError,
+				"numbers of literals and weights differ");
+		return NULL;
+	}
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder
+	ClauseSet dest;
+	_encode_pb(dest, lhs, wghts, rhs, cmp, top, enc);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, 0);
+	if (dest_obj == NULL)
+		return NULL;
+
+	if (dest.size()) {
+		PyObject *ret = Py_BuildValue("On", dest_obj, (Py_ssize_t)top);
+		Py_DECREF(dest_obj);
+		return ret;
+	}
+	else {
+		Py_DECREF(dest_obj);
+		Py_RETURN_NONE;
+	}
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_new(PyObject *self, PyObject *args)
+{
+	PyObject *lhs_obj;
+	int rhs;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiii|i", &lhs_obj, &rhs, &top, &main_thread,
+				&flat))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder
+	ClauseSet dest;
+	TotTree *tree = itot_new(dest, lhs, rhs, top);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	// creating the upper-bounds (right-hand side)
+	PyObject *ubs_obj = pyubs_from_tree(tree);
+
+	PyObject *ret = Py_BuildValue("NOOn", tree_to_pyobj(tree),
+				dest_obj, ubs_obj, (Py_ssize_t)top);
+
+	Py_DECREF(dest_obj);
+	Py_DECREF( ubs_obj);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_inc(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+	int rhs;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiii|i", &t_obj, &rhs, &top, &main_thread,
+				&flat))
+		return NULL;
+
+	// get pointer to tree
+	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder
+	ClauseSet dest;
+	itot_increase(tree, dest, rhs, top);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	// creating the upper-bounds (right-hand side)
+	PyObject *ubs_obj = pyubs_from_tree(tree);
+
+	PyObject *ret = Py_BuildValue("OOn", dest_obj, ubs_obj, (Py_ssize_t)top);
+
+	Py_DECREF(dest_obj);
+	Py_DECREF( ubs_obj);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_ext(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+	PyObject *lhs_obj;
+	int rhs;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "OOiii|i", &t_obj, &lhs_obj, &rhs, &top,
+				&main_thread, &flat))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	// get pointer to tree
+	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder; the tree is extended in place
+	ClauseSet dest;
+	itot_extend(lhs, tree, dest, rhs, top);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	// creating the upper-bounds (right-hand side)
+	PyObject *ubs_obj = pyubs_from_tree(tree);
+
+	PyObject *ret = Py_BuildValue("OOOn", t_obj, dest_obj, ubs_obj,
+				(Py_ssize_t)top);
+
+	Py_DECREF(dest_obj);
+	Py_DECREF( ubs_obj);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_mrg(PyObject *self, PyObject *args)
+{
+	PyObject *t1_obj;
+	PyObject *t2_obj;
+	int rhs;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "OOiii|i", &t1_obj, &t2_obj, &rhs, &top,
+				&main_thread, &flat))
+		return NULL;
+
+	// get pointer to tree
+	TotTree *tree1 = (TotTree *)pyobj_to_void(t1_obj);
+	TotTree *tree2 = (TotTree *)pyobj_to_void(t2_obj);
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder; the nodes of tree2 are moved into tree1
+	ClauseSet dest;
+	itot_merge(tree1, tree2, dest, rhs, top);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	// creating the upper-bounds (right-hand side)
+	PyObject *ubs_obj = pyubs_from_tree(tree1);
+
+	if (dest.size()) {
+		PyObject *ret = Py_BuildValue("OOOn", t1_obj, dest_obj, ubs_obj,
+				(Py_ssize_t)top);
+		Py_DECREF(dest_obj);
+		Py_DECREF( ubs_obj);
+		return ret;
+	}
+	else {
+		Py_DECREF(dest_obj);
+		Py_DECREF( ubs_obj);
+		Py_RETURN_NONE;
+	}
+
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_del(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &t_obj))
+		return NULL;
+
+	// get pointer to tree
+	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+
+	// freeing the node pool; the tree itself
+	// is destroyed together with its capsule
+	itot_clear(tree);
+
+	PyObject *ret = Py_BuildValue("");
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_itot_mem(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &t_obj))
+		return NULL;
+
+	// get pointer to tree
+	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+
+	return PyLong_FromSize_t(itot_memory(tree));
+}
+
+//
+//=============================================================================
+static PyObject *py_imto_new(PyObject *self, PyObject *args)
+{
+	PyObject *lhs_obj;
+	int rhs;
+	int p;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiiii|i", &lhs_obj, &rhs, &p, &top,
+				&main_thread, &flat))
+		return NULL;
+
+	vector<int> lhs;
+	if (pyiter_to_vector(lhs_obj, lhs) == false)
+		return NULL;
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+
+		if (setjmp(env) != 0) {
+			PyErr_SetString(CardError, "Caught keyboard interrupt");
+			return NULL;
+		}
+	}
+
+	// calling encoder
+	ClauseSet dest;
+	MtoTree *tree = imto_new(dest, lhs, rhs, p, top);
+
+	if (main_thread)
+		PyOS_setsig(SIGINT, sig_save);
+
+	// creating the resulting clause set
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
+
+	// creating the upper-bounds (right-hand side)
+	PyObject *ubs_obj = pyubs_from_mtree(tree);
+
+	PyObject *ret = Py_BuildValue("NOOn", mtree_to_pyobj(tree),
+				dest_obj, ubs_obj, (Py_ssize_t)top);
+
+	Py_DECREF(dest_obj);
+	Py_DECREF( ubs_obj);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_imto_inc(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+	int rhs;
+	int top;
+	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
+
+	if (!PyArg_ParseTuple(args, "Oiii|i", &t_obj, &rhs, &top, &main_thread,
+				&flat))
+		return NULL;
+
+	// get pointer to tree
+	MtoTree *tree = (MtoTree *)pyobj_to_void(t_obj);
+
+	PyOS_sighandler_t sig_save;
+	if (main_thread) {
+		sig_save = PyOS_setsig(SIGINT, sigint_handler);
 
 		if (setjmp(env) != 0) {
 			PyErr_SetString(CardError, "Caught keyboard interrupt");
@@ -436,30 +1361,18 @@ static PyObject *py_itot_inc(PyObject *self, PyObject *args)
 
 	// calling encoder
 	ClauseSet dest;
-	itot_increase(tree, dest, rhs, top);
+	imto_increase(tree, dest, rhs, top);
 
 	if (main_thread)
 		PyOS_setsig(SIGINT, sig_save);
 
 	// creating the resulting clause set
-	PyObject *dest_obj = PyList_New(dest.size());
-	for (size_t i = 0; i < dest.size(); ++i) {
-		PyObject *cl_obj = PyList_New(dest[i].size());
-
-		for (size_t j = 0; j < dest[i].size(); ++j) {
-			PyObject *lit_obj = pyint_from_cint(dest[i][j]);
-			PyList_SetItem(cl_obj, j, lit_obj);
-		}
-
-		PyList_SetItem(dest_obj, i, cl_obj);
-	}
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
 
 	// creating the upper-bounds (right-hand side)
-	PyObject *ubs_obj = PyList_New(tree->vars.size());
-	for (size_t i = 0; i < tree->vars.size(); ++i) {
-		PyObject *ub_obj = pyint_from_cint(tree->vars[i]);
-		PyList_SetItem(ubs_obj, i, ub_obj);
-	}
+	PyObject *ubs_obj = pyubs_from_mtree(tree);
 
 	PyObject *ret = Py_BuildValue("OOn", dest_obj, ubs_obj, (Py_ssize_t)top);
 
@@ -470,16 +1383,17 @@ static PyObject *py_itot_inc(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_itot_ext(PyObject *self, PyObject *args)
+static PyObject *py_imto_ext(PyObject *self, PyObject *args)
 {
 	PyObject *t_obj;
 	PyObject *lhs_obj;
 	int rhs;
 	int top;
 	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
 
-	if (!PyArg_ParseTuple(args, "OOiii", &t_obj, &lhs_obj, &rhs, &top,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OOiii|i", &t_obj, &lhs_obj, &rhs, &top,
+				&main_thread, &flat))
 		return NULL;
 
 	vector<int> lhs;
@@ -487,7 +1401,7 @@ static PyObject *py_itot_ext(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to tree
-	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+	MtoTree *tree = (MtoTree *)pyobj_to_void(t_obj);
 
 	PyOS_sighandler_t sig_save;
 	if (main_thread) {
@@ -499,35 +1413,23 @@ static PyObject *py_itot_ext(PyObject *self, PyObject *args)
 		}
 	}
 
-	// calling encoder
+	// calling encoder; the tree is extended in place
 	ClauseSet dest;
-	tree = itot_extend(lhs, tree, dest, rhs, top);
+	imto_extend(lhs, tree, dest, rhs, top);
 
 	if (main_thread)
 		PyOS_setsig(SIGINT, sig_save);
 
 	// creating the resulting clause set
-	PyObject *dest_obj = PyList_New(dest.size());
-	for (size_t i = 0; i < dest.size(); ++i) {
-		PyObject *cl_obj = PyList_New(dest[i].size());
-
-		for (size_t j = 0; j < dest[i].size(); ++j) {
-			PyObject *lit_obj = pyint_from_cint(dest[i][j]);
-			PyList_SetItem(cl_obj, j, lit_obj);
-		}
-
-		PyList_SetItem(dest_obj, i, cl_obj);
-	}
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
 
 	// creating the upper-bounds (right-hand side)
-	PyObject *ubs_obj = PyList_New(tree->vars.size());
-	for (size_t i = 0; i < tree->vars.size(); ++i) {
-		PyObject *ub_obj = pyint_from_cint(tree->vars[i]);
-		PyList_SetItem(ubs_obj, i, ub_obj);
-	}
+	PyObject *ubs_obj = pyubs_from_mtree(tree);
 
-	PyObject *ret = Py_BuildValue("OOOn", void_to_pyobj((void *)tree),
-				dest_obj, ubs_obj, (Py_ssize_t)top);
+	PyObject *ret = Py_BuildValue("OOOn", t_obj, dest_obj, ubs_obj,
+				(Py_ssize_t)top);
 
 	Py_DECREF(dest_obj);
 	Py_DECREF( ubs_obj);
@@ -536,21 +1438,28 @@ static PyObject *py_itot_ext(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_itot_mrg(PyObject *self, PyObject *args)
+static PyObject *py_imto_mrg(PyObject *self, PyObject *args)
 {
 	PyObject *t1_obj;
 	PyObject *t2_obj;
 	int rhs;
 	int top;
 	int main_thread;
+	int flat = 0;  // clauses as a flat buffer
 
-	if (!PyArg_ParseTuple(args, "OOiii", &t1_obj, &t2_obj, &rhs, &top,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OOiii|i", &t1_obj, &t2_obj, &rhs, &top,
+				&main_thread, &flat))
 		return NULL;
 
 	// get pointer to tree
-	TotTree *tree1 = (TotTree *)pyobj_to_void(t1_obj);
-	TotTree *tree2 = (TotTree *)pyobj_to_void(t2_obj);
+	MtoTree *tree1 = (MtoTree *)pyobj_to_void(t1_obj);
+	MtoTree *tree2 = (MtoTree *)pyobj_to_void(t2_obj);
+
+	if (tree1->p != tree2->p) {
+		PyErr_SetString(PyExc_ValueError,
+				"totalizers with different moduli cannot be merged");
+		return NULL;
+	}
 
 	PyOS_sighandler_t sig_save;
 	if (main_thread) {
@@ -562,51 +1471,32 @@ static PyObject *py_itot_mrg(PyObject *self, PyObject *args)
 		}
 	}
 
-	// calling encoder
+	// calling encoder; the nodes of tree2 are moved into tree1
 	ClauseSet dest;
-	tree1 = itot_merge(tree1, tree2, dest, rhs, top);
+	imto_merge(tree1, tree2, dest, rhs, top);
 
 	if (main_thread)
 		PyOS_setsig(SIGINT, sig_save);
 
 	// creating the resulting clause set
-	PyObject *dest_obj = PyList_New(dest.size());
-	for (size_t i = 0; i < dest.size(); ++i) {
-		PyObject *cl_obj = PyList_New(dest[i].size());
-
-		for (size_t j = 0; j < dest[i].size(); ++j) {
-			PyObject *lit_obj = pyint_from_cint(dest[i][j]);
-			PyList_SetItem(cl_obj, j, lit_obj);
-		}
-
-		PyList_SetItem(dest_obj, i, cl_obj);
-	}
+	PyObject *dest_obj = pyclauses_from_clset(dest, flat);
+	if (dest_obj == NULL)
+		return NULL;
 
 	// creating the upper-bounds (right-hand side)
-	PyObject *ubs_obj = PyList_New(tree1->vars.size());
-	for (size_t i = 0; i < tree1->vars.size(); ++i) {
-		PyObject *ub_obj = pyint_from_cint(tree1->vars[i]);
-		PyList_SetItem(ubs_obj, i, ub_obj);
-	}
+	PyObject *ubs_obj = pyubs_from_mtree(tree1);
 
-	if (dest.size()) {
-		PyObject *ret = Py_BuildValue("OOOn", void_to_pyobj((void *)tree1),
-				dest_obj, ubs_obj, (Py_ssize_t)top);
-		Py_DECREF(dest_obj);
-		Py_DECREF( ubs_obj);
-		return ret;
-	}
-	else {
-		Py_DECREF(dest_obj);
-		Py_DECREF( ubs_obj);
-		Py_RETURN_NONE;
-	}
+	PyObject *ret = Py_BuildValue("OOOn", t1_obj, dest_obj, ubs_obj,
+			(Py_ssize_t)top);
 
+	Py_DECREF(dest_obj);
+	Py_DECREF( ubs_obj);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_itot_del(PyObject *self, PyObject *args)
+static PyObject *py_imto_del(PyObject *self, PyObject *args)
 {
 	PyObject *t_obj;
 
@@ -614,13 +1504,419 @@ static PyObject *py_itot_del(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to tree
-	TotTree *tree = (TotTree *)pyobj_to_void(t_obj);
+	MtoTree *tree = (MtoTree *)pyobj_to_void(t_obj);
 
-	// delete
-	itot_destroy(tree);
+	// freeing the node pool; the tree itself
+	// is destroyed together with its capsule
+	imto_clear(tree);
 
 	PyObject *ret = Py_BuildValue("");
 	return ret;
 }
 
+//
+//=============================================================================
+static PyObject *py_imto_mem(PyObject *self, PyObject *args)
+{
+	PyObject *t_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &t_obj))
+		return NULL;
+
+	// get pointer to tree
+	MtoTree *tree = (MtoTree *)pyobj_to_void(t_obj);
+
+	return PyLong_FromSize_t(imto_memory(tree));
+}
+
+//
+//=============================================================================
+static PyObject *py_dimacs_new(PyObject *self, PyObject *args)
+{
+	int format;
+	const char *leads;
+
+	if (!PyArg_ParseTuple(args, "is", &format, &leads))
+		return NULL;
+
+	if (format < DIMACS_CNF || format > DIMACS_WCNFP) {
+		PyErr_SetString(PyExc_ValueError, "unknown formula format");
+		return NULL;
+	}
+
+	DimacsParser *parser = new DimacsParser((DimacsFormat)format, leads);
+	return parser_to_pyobj(parser);
+}
+
+//
+//=============================================================================
+static PyObject *py_dimacs_feed(PyObject *self, PyObject *args)
+{
+	PyObject *p_obj;
+	const char *data;
+	Py_ssize_t len;
+
+	if (!PyArg_ParseTuple(args, "Os#", &p_obj, &data, &len))
+		return NULL;
+
+	// get pointer to parser
+	DimacsParser *parser = (DimacsParser *)pyobj_to_void(p_obj);
+
+	bool res;
+	Py_BEGIN_ALLOW_THREADS
+	res = parser->feed(data, (size_t)len);
+	Py_END_ALLOW_THREADS
+
+	if (!res) {
+		PyErr_SetString(PyExc_ValueError, parser->error.c_str());
+		return NULL;
+	}
+
+	Py_RETURN_NONE;
+}
+
+// the file is mapped in memory and parsed starting from the given offset;
+// False is returned if the descriptor does not refer to a regular file
+//=============================================================================
+static PyObject *py_dimacs_map(PyObject *self, PyObject *args)
+{
+	PyObject *p_obj;
+	int fd;
+	Py_ssize_t offset;
+
+	if (!PyArg_ParseTuple(args, "Oin", &p_obj, &fd, &offset))
+		return NULL;
+
+#ifdef _WIN32
+	Py_RETURN_FALSE;
+#else
+	// get pointer to parser
+	DimacsParser *parser = (DimacsParser *)pyobj_to_void(p_obj);
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < offset)
+		Py_RETURN_FALSE;
+
+	if (st.st_size == offset)
+		Py_RETURN_TRUE;
+
+	void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		Py_RETURN_FALSE;
+
+	bool res;
+	Py_BEGIN_ALLOW_THREADS
+	madvise(data, st.st_size, MADV_SEQUENTIAL);
+	res = parser->feed((const char *)data + offset, st.st_size - offset);
+	munmap(data, st.st_size);
+	Py_END_ALLOW_THREADS
+
+	if (!res) {
+		PyErr_SetString(PyExc_ValueError, parser->error.c_str());
+		return NULL;
+	}
+
+	Py_RETURN_TRUE;
+#endif
+}
+
+// returns a tuple (nv, topw, clauses or hard clauses, soft clauses, their
+// weights, cardinality constraints, soft clauses with negative weights,
+// comments), where the components irrelevant for the format are empty
+//=============================================================================
+static PyObject *py_dimacs_result(PyObject *self, PyObject *args)
+{
+	PyObject *p_obj;
+	int flat = 0;  // clauses as flat buffers
+
+	if (!PyArg_ParseTuple(args, "O|i", &p_obj, &flat))
+		return NULL;
+
+	// get pointer to parser
+	DimacsParser *parser = (DimacsParser *)pyobj_to_void(p_obj);
+
+	if (!parser->finish()) {
+		PyErr_SetString(PyExc_ValueError, parser->error.c_str());
+		return NULL;
+	}
+
+	PyObject *comm_obj = PyList_New(parser->comments.size());
+	for (size_t i = 0; i < parser->comments.size(); ++i)
+		PyList_SetItem(comm_obj, i, pystr_from_string(parser->comments[i]));
+
+	PyObject *topw_obj = pyweights_from_list(parser->topw);
+	PyObject *hard_obj = pyclauses_from_clset(parser->hard, flat);
+	PyObject *soft_obj = pyclauses_from_clset(parser->soft, flat);
+	PyObject *wght_obj = pyweights_from_list(parser->wght);
+	PyObject *atms_obj = pyatmosts_from_parser(parser);
+	PyObject *negs_obj = pynegs_from_parser(parser);
+
+	// the parser is not needed anymore
+	parser->hard.clear();
+	parser->soft.clear();
+	parser->atms.clear();
+	parser->negs.clear();
+	parser->comments.clear();
+
+	if (!topw_obj || !hard_obj || !soft_obj || !wght_obj || !atms_obj
+			|| !negs_obj) {
+		Py_XDECREF(topw_obj);
+		Py_XDECREF(hard_obj);
+		Py_XDECREF(soft_obj);
+		Py_XDECREF(wght_obj);
+		Py_XDECREF(atms_obj);
+		Py_XDECREF(negs_obj);
+		Py_DECREF(comm_obj);
+		return NULL;
+	}
+
+	PyObject *w_obj = PyList_GetItem(topw_obj, 0);
+	PyObject *ret = Py_BuildValue("nONNNNNN", (Py_ssize_t)parser->nv, w_obj,
+			hard_obj, soft_obj, wght_obj, atms_obj, negs_obj, comm_obj);
+
+	Py_DECREF(topw_obj);
+	return ret;
+}
+
+// lines are written first, followed by the clauses (or the cardinality
+// constraints given as pairs (lits, rhs)); the clauses can also come as
+// a flat zero-terminated buffer of 32-bit integers; every clause gets the
+// corresponding weight or, if there are no weights, the prefix in front
+//=============================================================================
+static PyObject *py_dimacs_write(PyObject *self, PyObject *args)
+{
+	PyObject *write_obj;
+	int text;
+	PyObject *lines_obj;
+	PyObject *items_obj;
+	const char *prefix;
+	PyObject *wghts_obj;
+	int cardinal;
+
+	if (!PyArg_ParseTuple(args, "OiOOsOi", &write_obj, &text, &lines_obj,
+				&items_obj, &prefix, &wghts_obj, &cardinal))
+		return NULL;
+
+	DimacsWriter writer;
+	string pref(prefix), line;
+
+	PyObject *i_obj = PyObject_GetIter(lines_obj);
+	if (i_obj == NULL)
+		return NULL;
+
+	PyObject *l_obj;
+	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
+		bool ok = pyobj_to_string(l_obj, line);
+		Py_DECREF(l_obj);
+
+		if (!ok) {
+			Py_DECREF(i_obj);
+			return NULL;
+		}
+
+		writer.put(line);
+		writer.put('\n');
+	}
+
+	Py_DECREF(i_obj);
+	if (PyErr_Occurred())
+		return NULL;
+
+	PyObject *wi_obj = NULL;
+	if (wghts_obj != Py_None && (wi_obj = PyObject_GetIter(wghts_obj)) == NULL)
+		return NULL;
+
+#if PY_MAJOR_VERSION >= 3
+	if (PyObject_CheckBuffer(items_obj)) {
+		Py_buffer view;
+
+		if (!pybuf_get_int32(items_obj, &view)) {
+			Py_XDECREF(wi_obj);
+			return NULL;
+		}
+
+		const int *lits = (const int *)view.buf;
+		size_t nlits = view.len / 4;
+		bool ok = true;
+
+		for (size_t beg = 0, i = 0; ok && i < nlits; ++i) {
+			if (lits[i] == 0) {
+				if (wi_obj && !(ok = pyweight_next(wi_obj, pref)))
+					break;
+
+				writer.put_clause(lits + beg, i - beg, pref);
+				beg = i + 1;
+
+				if (writer.full())
+					ok = pywriter_flush(write_obj, writer, text);
+			}
+		}
+
+		PyBuffer_Release(&view);
+		Py_XDECREF(wi_obj);
+
+		if (!ok || !pywriter_flush(write_obj, writer, text))
+			return NULL;
+
+		Py_RETURN_NONE;
+	}
+#endif
+
+	if ((i_obj = PyObject_GetIter(items_obj)) == NULL) {
+		Py_XDECREF(wi_obj);
+		return NULL;
+	}
+
+	vector<int> cl;
+	PyObject *c_obj;
+	bool ok = true;
+
+	while (ok && (c_obj = PyIter_Next(i_obj)) != NULL) {
+		if (wi_obj)
+			ok = pyweight_next(wi_obj, pref);
+
+		if (ok && cardinal) {
+			// either a list or a tuple of two items
+			PyObject *lits_obj = NULL, *rhs_obj = NULL;
+
+			if (PySequence_Check(c_obj) && PySequence_Size(c_obj) == 2) {
+				lits_obj = PySequence_GetItem(c_obj, 0);
+				rhs_obj  = PySequence_GetItem(c_obj, 1);
+			}
+
+			if (!lits_obj || !rhs_obj || !pyint_check(rhs_obj)) {
+				PyErr_SetString(PyExc_TypeError, "pair (lits, rhs) expected");
+				ok = false;
+			}
+			else if ((ok = pyclause_to_vector(lits_obj, cl)))
+				writer.put_atmost(cl.data(), cl.size(), pref,
+						pyint_to_cint(rhs_obj));
+
+			Py_XDECREF(lits_obj);
+			Py_XDECREF( rhs_obj);
+		}
+		else if (ok && (ok = pyclause_to_vector(c_obj, cl)))
+			writer.put_clause(cl.data(), cl.size(), pref);
+
+		Py_DECREF(c_obj);
+
+		if (ok && writer.full())
+			ok = pywriter_flush(write_obj, writer, text);
+	}
+
+	Py_DECREF(i_obj);
+	Py_XDECREF(wi_obj);
+
+	if (!ok || PyErr_Occurred() || !pywriter_flush(write_obj, writer, text))
+		return NULL;
+
+	Py_RETURN_NONE;
+}
+
+// clauses given as an iterable of iterables are packed into a flat buffer of
+// zero-terminated clauses; the result is a triple (literals, offsets, nv)
+// where the literals are int32, the offsets are int64 and both are bytes;
+// offset i points past the terminating zero of clause i, counting from the
+// given base, i.e. the position of the buffer in a larger one
+//=============================================================================
+static PyObject *py_clauses_pack(PyObject *self, PyObject *args)
+{
+	PyObject *cls_obj;
+	Py_ssize_t base;
+
+	if (!PyArg_ParseTuple(args, "On", &cls_obj, &base))
+		return NULL;
+
+	PyObject *i_obj = PyObject_GetIter(cls_obj);
+	if (i_obj == NULL)
+		return NULL;
+
+	vector<int32_t> lits;
+	vector<int64_t> offs;
+	vector<int> cl;
+	int nv = 0;
+
+	PyObject *c_obj;
+	bool ok = true;
+
+	while (ok && (c_obj = PyIter_Next(i_obj)) != NULL) {
+		ok = pyclause_to_vector(c_obj, cl);
+		Py_DECREF(c_obj);
+
+		for (size_t j = 0; ok && j < cl.size(); ++j) {
+			if (cl[j] == 0) {
+				PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
+				ok = false;
+			}
+			else {
+				lits.push_back(cl[j]);
+				nv = max(nv, abs(cl[j]));
+			}
+		}
+
+		lits.push_back(0);
+		offs.push_back(base + lits.size());
+	}
+
+	Py_DECREF(i_obj);
+	if (!ok || PyErr_Occurred())
+		return NULL;
+
+	return Py_BuildValue("(NNi)",
+			PyBytes_FromStringAndSize((const char *)lits.data(),
+				lits.size() * sizeof(int32_t)),
+			PyBytes_FromStringAndSize((const char *)offs.data(),
+				offs.size() * sizeof(int64_t)), nv);
+}
+
+// a flat buffer of zero-terminated int32 clauses is scanned for the offsets
+// of its clauses (see above); the result is a pair (offsets, nv)
+//=============================================================================
+static PyObject *py_clauses_index(PyObject *self, PyObject *args)
+{
+	PyObject *buf_obj;
+	Py_ssize_t base;
+
+	if (!PyArg_ParseTuple(args, "On", &buf_obj, &base))
+		return NULL;
+
+#if PY_MAJOR_VERSION >= 3
+	Py_buffer view;
+
+	if (!pybuf_get_int32(buf_obj, &view))
+		return NULL;
+
+	const int32_t *lits = (const int32_t *)view.buf;
+	size_t nlits = view.len / 4;
+
+	if (nlits && lits[nlits - 1] != 0) {
+		PyBuffer_Release(&view);
+		PyErr_SetString(PyExc_ValueError, "buffer must be zero-terminated");
+		return NULL;
+	}
+
+	vector<int64_t> offs;
+	int nv = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+	for (size_t i = 0; i < nlits; ++i) {
+		if (lits[i] == 0)
+			offs.push_back(base + i + 1);
+		else
+			nv = max(nv, abs(lits[i]));
+	}
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&view);
+
+	return Py_BuildValue("(Ni)",
+			PyBytes_FromStringAndSize((const char *)offs.data(),
+				offs.size() * sizeof(int64_t)), nv);
+#else
+	PyErr_SetString(PyExc_NotImplementedError,
+			"flat buffers require Python 3");
+	return NULL;
+#endif
+}
+
 }  // extern "C"
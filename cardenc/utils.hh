@@ -8,6 +8,7 @@
 #ifndef CARDUTILS_HH_
 #define CARDUTILS_HH_
 
+#include <cassert>
 #include <vector>
 #include "clset.hh"
 #include "ptypes.hh"
@@ -38,6 +39,18 @@ inline int mk_yvar(int& top_id, PH& vset, PT np)
 	return nid;
 }
 
+// same as above but with a dense table
+//=============================================================================
+inline int mk_yvar(int& top_id, Pair2IntTable& vset, size_t i, size_t j)
+{
+	int& nid = vset(i, j);
+
+	if (nid == 0)
+		nid = ++top_id;
+
+	return nid;
+}
+
 //
 //=============================================================================
 inline void encode_ite(ClauseSet& clset, int ov, int sv, int x1, int x0)
@@ -28,7 +28,8 @@
     implementation is improved by the use of the *iterative totalizer encoding*
     [2]_. The encoding is used in an incremental fashion, i.e. it is created
     once and reused as many times as the number of iterations the algorithm
-    makes.
+    makes. Alternatively, an incremental variant of the *modulo totalizer*
+    encoding [3]_ can be used, which is much more compact for large costs.
 
     .. [1] António Morgado, Federico Heras, Mark H. Liffiton, Jordi Planes,
         Joao Marques-Silva. *Iterative and core-guided MaxSAT solving: A
@@ -37,6 +38,10 @@
     .. [2] Ruben Martins, Saurabh Joshi, Vasco M. Manquinho, Inês Lynce.
         *Incremental Cardinality Constraints for MaxSAT*. CP 2014. pp. 531-548
 
+    .. [3] Toru Ogawa, Yangyang Liu, Ryuzo Hasegawa, Miyuki Koshimura,
+        Hiroshi Fujita. *Modulo Based CNF Encoding of Cardinality Constraints
+        and Its Application to MaxSAT Solvers*. ICTAI 2013. pp. 9-17
+
     The implementation can be used as an executable (the list of available
     command-line options can be shown using ``lsu.py -h``) in the following
     way:
@@ -86,7 +91,7 @@
 #==============================================================================
 from __future__ import print_function
 import getopt
-from pysat.card import ITotalizer
+from pysat.card import IModTotalizer, ITotalizer
 from pysat.formula import CNF, WCNF, WCNFPlus
 from pysat.solvers import Solver, SolverNames
 from threading import Timer
@@ -103,7 +108,8 @@ class LSU:
         as a series of satisfiability oracle calls refining an upper bound on
         the MaxSAT cost, followed by one unsatisfiability call, which stops the
         algorithm. The implementation encodes the sum of all selector literals
-        using the *iterative totalizer encoding* [2]_. At every iteration, the
+        using the *iterative totalizer encoding* [2]_ or, if requested, the
+        incremental modulo totalizer [3]_. At every iteration, the
         upper bound on the cost is reduced and enforced by adding the
         corresponding unit size clause to the working formula. No clauses are
         removed during the execution of the algorithm. As a result, the SAT
@@ -113,26 +119,34 @@ class LSU:
             **unweighted** problems.
 
         The constructor receives an input :class:`.WCNF` formula, a name of the
-        SAT solver to use (see :class:`.SolverNames` for details), and an
-        integer verbosity level.
+        SAT solver to use (see :class:`.SolverNames` for details), the
+        incremental cardinality encoding to use (either ``'itot'`` for
+        :class:`.ITotalizer` or ``'imto'`` for :class:`.IModTotalizer`), and
+        an integer verbosity level.
 
         :param formula: input MaxSAT formula
         :param solver: name of SAT solver
         :param expect_interrupt: whether or not an :meth:`interrupt` call is expected
         :param verbose: verbosity level
+        :param cardenc: incremental cardinality encoding
 
         :type formula: :class:`.WCNF`
         :type solver: str
         :type expect_interrupt: bool
         :type verbose: int
+        :type cardenc: str
     """
 
-    def __init__(self, formula, solver='g4', expect_interrupt=False, verbose=0):
+    def __init__(self, formula, solver='g4', expect_interrupt=False, verbose=0,
+            cardenc='itot'):
         """
             Constructor.
         """
 
+        assert cardenc in ('itot', 'imto'), 'Unknown cardinality encoding: {0}'.format(cardenc)
+
         self.verbose = verbose
+        self.cardenc = cardenc
         self.solver = solver
         self.expect_interrupt = expect_interrupt
         self.formula = formula
@@ -291,7 +305,8 @@ class LSU:
             The method enforces an upper bound on the cost of the MaxSAT
             solution. This is done by encoding the sum of all soft clause
             selectors with the use the iterative totalizer encoding, i.e.
-            :class:`.ITotalizer`. Note that the sum is created once, at the
+            :class:`.ITotalizer`, or the incremental modulo totalizer, i.e.
+            :class:`.IModTotalizer`. Note that the sum is created once, at the
             beginning. Each of the following calls to this method only enforces
             the upper bound on the created sum by adding the corresponding unit
             size clause. Each such clause is added on the fly with no restart
@@ -304,7 +319,10 @@ class LSU:
         """
 
         if self.tot == None:
-            self.tot = ITotalizer(lits=self.sels, ubound=cost-1, top_id=self.topv)
+            if self.cardenc == 'imto':
+                self.tot = IModTotalizer(lits=self.sels, ubound=cost-1, top_id=self.topv)
+            else:
+                self.tot = ITotalizer(lits=self.sels, ubound=cost-1, top_id=self.topv)
             self.topv = self.tot.top_id
 
             for cl in self.tot.cnf.clauses:
@@ -391,19 +409,22 @@ def parse_options():
     """
 
     try:
-        opts, args = getopt.getopt(sys.argv[1:], 'hms:t:v', ['help', 'model', 'solver=', 'timeout=', 'verbose'])
+        opts, args = getopt.getopt(sys.argv[1:], 'c:hms:t:v', ['cardenc=', 'help', 'model', 'solver=', 'timeout=', 'verbose'])
     except getopt.GetoptError as err:
         sys.stderr.write(str(err).capitalize())
         print_usage()
         sys.exit(1)
 
+    cardenc = 'itot'
     solver = 'g4'
     verbose = 1
     print_model = False
     timeout = None
 
     for opt, arg in opts:
-        if opt in ('-h', '--help'):
+        if opt in ('-c', '--cardenc'):
+            cardenc = str(arg)
+        elif opt in ('-h', '--help'):
             print_usage()
             sys.exit(0)
         elif opt in ('-m', '--model'):
@@ -418,7 +439,7 @@ def parse_options():
         else:
             assert False, 'Unhandled option: {0} {1}'.format(opt, arg)
 
-    return print_model, solver, timeout, verbose, args
+    return cardenc, print_model, solver, timeout, verbose, args
 
 
 #
@@ -430,6 +451,8 @@ def print_usage():
 
     print('Usage: ' + os.path.basename(sys.argv[0]) + ' [options] dimacs-file')
     print('Options:')
+    print('        -c, --cardenc=<string>   Incremental cardinality encoding to use')
+    print('                                 Available values: itot, imto (default = itot)')
     print('        -h, --help               Show this message')
     print('        -m, --model              Print model')
     print('        -s, --solver=<string>    SAT solver to use')
@@ -442,7 +465,7 @@ def print_usage():
 #
 #==============================================================================
 if __name__ == '__main__':
-    print_model, solver, timeout, verbose, files = parse_options()
+    cardenc, print_model, solver, timeout, verbose, files = parse_options()
 
     if files:
         # reading standard CNF or WCNF
@@ -453,7 +476,8 @@ if __name__ == '__main__':
                 formula = CNF(from_file=files[0]).weighted()
 
             lsu = LSU(formula, solver=solver,
-                    expect_interrupt=(timeout != None), verbose=verbose)
+                    expect_interrupt=(timeout != None), verbose=verbose,
+                    cardenc=cardenc)
 
         # reading WCNF+
         elif re.search('\.wcnf[p,+](\.(gz|bz2|lzma|xz))?$', files[0]):
@@ -194,8 +194,23 @@ class MUSX(object):
             is, nothing else is done. Otherwise, an *unsatisfiable core* of the
             formula is extracted, which is later used as an over-approximation
             of an MUS refined in :func:`_compute`.
+
+            Unless the clauses tested are to be reported (verbosity level
+            ``2`` or higher), the extraction is delegated to the oracle's
+            native :meth:`.Solver.extract_mus`, if the oracle supports it.
         """
 
+        if self.verbose < 2:
+            try:
+                mus = self.oracle.extract_mus(self.sels)
+            except NotImplementedError:
+                pass
+            else:
+                if mus is not None:
+                    return list(map(lambda x: self.vmap[x] + 1, mus))
+
+                return
+
         # cheking whether or not the formula is unsatisfiable
         if not self.oracle.solve(assumptions=self.sels):
             # get an overapproximation of an MUS
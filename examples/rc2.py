@@ -131,14 +131,21 @@ import getopt
 import itertools
 from math import copysign
 import os
+from pysat._utils import MainThread
 from pysat.formula import CNFPlus, WCNFPlus
 from pysat.card import ITotalizer
-from pysat.solvers import Solver, SolverNames
+from pysat.solvers import Solver, SolverNames, Portfolio
+import pysolvers
 import re
 import six
 from six.moves import range
 import sys
 
+try:  # for Python < 3.8
+    from time import clock as process_time
+except ImportError:  # for Python >= 3.8
+    from time import process_time
+
 
 #
 #==============================================================================
@@ -167,6 +174,18 @@ class RC2(object):
         is set to a non-zero integer. Finally, verbosity level can be
         set using the ``verbose`` parameter.
 
+        If the weights of the soft clauses are integers and the SAT
+        oracle is neither Lingeling nor a solver with native
+        cardinality constraints, e.g. Minicard, the core-guided loop of
+        :func:`compute_` runs in a native engine, which keeps the
+        totalizers, the assumptions, and the weights in C++ across
+        iterations and makes exactly the same oracle calls as the
+        Python implementation. (The same holds for intrinsic AtMost1
+        constraints, which are detected and adapted first, but only
+        once.) The Python methods processing cores are then not called
+        at all. This is not done if the verbosity level is higher than
+        ``1``, as the progress of the loop is not reported natively.
+
         .. [7] Gilles Audemard, Jean-Marie Lagniez, Laurent Simon.
             *Improving Glucose for Incremental SAT Solving with
             Assumptions: Application to MUS Extraction*. SAT 2013.
@@ -205,6 +224,11 @@ class RC2(object):
         self.minz = minz
         self.trim = trim
 
+        # native engine running the core-guided loop (if possible)
+        self.native = verbose <= 1
+        self.engine = None
+        self.native_time = 0.0
+
         # clause selectors and mapping from selectors to clause ids
         self.sels, self.smap, self.sall, self.s2cl, self.sneg = [], {}, [], {}, set([])
 
@@ -405,6 +429,9 @@ class RC2(object):
             self.sall.append(selv)
             self.sels_set.add(selv)
 
+            if self.engine:
+                pysolvers.rc2_add(self.engine, selv, weight)
+
     def delete(self):
         """
             Explicit destructor of the internal SAT oracle and all the
@@ -412,6 +439,9 @@ class RC2(object):
         """
 
         if self.oracle:
+            # the engine refers to the oracle
+            self.engine = None
+
             if not self.oracle.supports_atmost():  # for minicard, there is nothing to free
                 for t in six.itervalues(self.tobj):
                     t.delete()
@@ -464,7 +494,7 @@ class RC2(object):
 
         if res:
             # extracting a model
-            self.model = self.oracle.get_model()
+            self.model = self._oracle_model()
 
             if self.model is None and self.topv == 0:
                 # we seem to have been given an empty formula
@@ -529,7 +559,7 @@ class RC2(object):
                     # to block an MSS corresponding to the model, we add
                     # a clause enforcing at least one of the MSS clauses
                     # to be falsified next time
-                    m, cl = set(self.oracle.get_model()), []
+                    m, cl = set(self._oracle_model()), []
 
                     for selv in self.sall:
                         if selv in m:
@@ -549,7 +579,7 @@ class RC2(object):
                     # a similar (but simpler) piece of code goes here,
                     # to block the MCS corresponding to the model
                     # (this blocking is stronger than MSS blocking above)
-                    m = set(self.oracle.get_model())
+                    m = set(self._oracle_model())
                     self.oracle.add_clause([l for l in filter(lambda l: -l in m, self.sall)])
                 else:
                     # here, we simply block a previous MaxSAT model
@@ -573,9 +603,12 @@ class RC2(object):
 
         # trying to adapt (simplify) the formula
         # by detecting and using atmost1 constraints
-        if self.adapt:
+        if self.adapt and self.engine is None:
             self.adapt_am1()
 
+        if self._init_engine():
+            return self._compute_native()
+
         # main solving loop
         while not self.oracle.solve(assumptions=self.sels + self.sums):
             self.get_core()
@@ -833,9 +866,21 @@ class RC2(object):
         """
             This method trims a previously extracted unsatisfiable
             core at most a given number of times. If a fixed point is
-            reached before that, the method returns.
+            reached before that, the method returns. The core is
+            trimmed natively by :meth:`.Solver.minimize_core` unless
+            the oracle does not support it.
         """
 
+        if not self.trim:
+            return
+
+        try:
+            self.core = self.oracle.minimize_core(self.core,
+                    trim=self.trim, minimize=False)
+            return
+        except NotImplementedError:
+            pass
+
         for i in range(self.trim):
             # call solver with core assumption only
             # it must return 'unsatisfiable'
@@ -866,11 +911,21 @@ class RC2(object):
             and are reported as a result of the procedure.
 
             During this core minimization procedure, all SAT calls are
-            dropped after obtaining 1000 conflicts.
+            dropped after obtaining 1000 conflicts. The calls are made
+            natively by :meth:`.Solver.minimize_core` unless the oracle
+            does not support it.
         """
 
         if self.minz and len(self.core) > 1:
             self.core = sorted(self.core, key=lambda l: self.wght[l])
+
+            try:
+                self.core = self.oracle.minimize_core(self.core,
+                        conf_budget=1000)
+                return
+            except NotImplementedError:
+                pass
+
             self.oracle.conf_budget(1000)
 
             i = 0
@@ -1166,7 +1221,65 @@ class RC2(object):
             Report the total SAT solving time.
         """
 
-        return self.oracle.time_accum()
+        return self.oracle.time_accum() + self.native_time
+
+    def _init_engine(self):
+        """
+            Create the native engine unless it exists already or it
+            cannot be used. This can be done only before the first
+            core is processed in Python, in which case the engine takes
+            over the selectors, their weights, and the cost.
+        """
+
+        if self.engine is None and self.native:
+            self.native = False
+
+            racer = Portfolio.racers.get(type(self.oracle.solver))
+            weights = [self.wght[l] for l in self.sels]
+
+            if racer and not self.sums and all(isinstance(w,
+                    six.integer_types) for w in weights):
+                try:
+                    self.engine = pysolvers.rc2_new(racer[0],
+                            getattr(self.oracle.solver, racer[1]),
+                            self.sels, weights, self.topv,
+                            int(self.exhaust), int(self.minz), self.trim)
+                except NotImplementedError:
+                    pass  # e.g. for Lingeling or Minicard
+                else:
+                    self.omodel = None
+                    self.native_cost = self.cost
+
+        return self.engine is not None
+
+    def _compute_native(self):
+        """
+            Run the core-guided loop in the native engine. The cost
+            and the top variable are updated afterwards.
+        """
+
+        start_time = process_time()
+
+        self.omodel, cost, self.topv = pysolvers.rc2_compute(self.engine,
+                self.topv, int(MainThread.check()))
+
+        self.native_time += process_time() - start_time
+
+        # the engine counts the cost from the moment of its creation
+        self.cost = self.native_cost + cost
+
+        return self.omodel is not None
+
+    def _oracle_model(self):
+        """
+            The last model of the oracle, which the native engine
+            reports by itself.
+        """
+
+        if self.engine:
+            return self.omodel
+
+        return self.oracle.get_model()
 
     def _map_extlit(self, l):
         """
@@ -1240,6 +1353,9 @@ class RC2Stratified(RC2, object):
         # do clause hardening
         self.hard = nohard == False
 
+        # the levels are processed in Python
+        self.native = False
+
         # backing up selectors
         self.bckp, self.bckp_set = self.sels, self.sels_set
         self.sels = []
@@ -79,7 +79,8 @@ class FileObject(object):
         be used in Python 3 by default and also in Python 2 if the
         ``backports.lzma`` package is installed.
 
-        Note that the class opens a file in text mode.
+        Note that the class opens a file in text mode unless binary mode,
+        i.e. ``'rb'`` or ``'wb'``, is requested explicitly.
 
         :param name: a file name to open
         :param mode: opening mode
@@ -109,11 +110,14 @@ class FileObject(object):
 
     def open(self, name, mode='r', compression=None):
         """
-            Open a file pointer. Note that a file is *always* opened in text
-            mode. The method inherits its input parameters from the constructor
-            of :class:`FileObject`.
+            Open a file pointer. Note that a file is opened in text mode
+            unless ``mode`` contains ``'b'``. The method inherits its input
+            parameters from the constructor of :class:`FileObject`.
         """
 
+        # compressed streams need to be told about text mode explicitly
+        tmode = mode if 'b' in mode else mode + 't'
+
         if compression == 'use_ext':
             self.get_compression_type(name)
         else:
@@ -122,19 +126,22 @@ class FileObject(object):
         if not self.ctype:
             self.fp = open(name, mode)
         elif self.ctype == 'gzip':
-            self.fp = gzip.open(name, mode + 't')
+            self.fp = gzip.open(name, tmode)
         elif self.ctype == 'bzip2':
             try:
                 # Python 3 supports opening bzip2 files in text mode
                 # therefore, we prefer to open them this way
-                self.fp = bz2.open(name, mode + 't')
+                self.fp = bz2.open(name, tmode)
             except:
                 # BZ2File opens a file in binary mode
                 # thus, we have to use codecs.getreader()
                 # to be able to use it in text mode
-                self.fp_extra = bz2.BZ2File(name, mode)
+                self.fp_extra = bz2.BZ2File(name, mode.replace('b', ''))
 
-                if mode == 'r':
+                if 'b' in mode:
+                    self.fp = self.fp_extra
+                    self.fp_extra = None
+                elif mode == 'r':
                     self.fp = codecs.getreader('ascii')(self.fp_extra)
                 else:  # mode == 'w'
                     self.fp = codecs.getwriter('ascii')(self.fp_extra)
@@ -142,7 +149,7 @@ class FileObject(object):
             # LZMA is available in Python 2 only if backports.lzma is installed
             # Python 3 supports it by default
             assert lzma_present, 'LZMA compression is unavailable.'
-            self.fp = lzma.open(name, mode=mode + 't')
+            self.fp = lzma.open(name, mode=tmode)
 
     def close(self):
         """
@@ -19,6 +19,7 @@
         EncType
         CardEnc
         ITotalizer
+        IModTotalizer
 
     ==================
     Module description
@@ -79,9 +80,10 @@
     Additionally, to the standard cardinality encodings that are basically
     "static" CNF formulas, the module is designed to able to construct
     *incremental* cardinality encodings, i.e. those that can be incrementally
-    extended at a later stage. At this point only the *iterative totalizer*
-    [11]_ encoding is supported. Iterative totalizer can be accessed with the
-    use of the :class:`.ITotalizer` class.
+    extended at a later stage. At this point, the *iterative totalizer* [11]_
+    encoding and an incremental variant of the modulo totalizer [9]_ [10]_
+    are supported. These can be accessed with the use of the
+    :class:`.ITotalizer` and :class:`.IModTotalizer` classes, respectively.
 
     .. [11] Ruben Martins, Saurabh Joshi, Vasco M. Manquinho, Inês Lynce.
         *Incremental Cardinality Constraints for MaxSAT*. CP 2014. pp. 531-548
@@ -217,9 +219,29 @@ class CardEnc(object):
         # updating the number of variables
         cnf.nv = vpool.top
 
+    @classmethod
+    def _to_solver(cls, cnf, solver):
+        """
+            Move the clauses of a newly created encoding into a solver.
+
+            :param cnf: the encoding to move.
+            :param solver: the solver to add the clauses to.
+
+            :type cnf: :class:`.formula.CNFPlus`
+            :type solver: :class:`pysat.solvers.Solver`
+        """
+
+        if type(cnf.clauses) == tuple:
+            # a flat buffer of clauses and its size
+            solver.append_buffer(cnf.clauses[0])
+        else:
+            solver.append_formula(cnf.clauses)
+
+        cnf.clauses = []
+
     @classmethod
     def atmost(cls, lits, bound=1, top_id=None, vpool=None,
-            encoding=EncType.seqcounter):
+            encoding=EncType.seqcounter, solver=None):
         """
             This method can be used for creating a CNF encoding of an AtMostK
             constraint, i.e. of :math:`\sum_{i=1}^{n}{x_i}\leq k`. The method
@@ -253,10 +275,18 @@ class CardEnc(object):
         # MiniCard's native representation is handled separately
         if encoding == 9:
             ret.atmosts, ret.nv = [(lits, bound)], top_id
+
+            if solver is not None:
+                solver.add_atmost(*ret.atmosts.pop())
+
             return ret
 
+        # clauses go to the solver as a flat buffer unless they may need to be
+        # renumbered because of the variables occupied in the pool
+        flat = solver is not None and not (vpool and vpool._occupied)
+
         res = pycard.encode_atmost(lits, bound, top_id, encoding,
-                int(MainThread.check()))
+                int(MainThread.check()), int(flat))
 
         if res:
             ret.clauses, ret.nv = res
@@ -270,11 +300,14 @@ class CardEnc(object):
                     vpool.top = ret.nv - 1
                     vpool._next()
 
+            if solver is not None:
+                cls._to_solver(ret, solver)
+
         return ret
 
     @classmethod
     def atleast(cls, lits, bound=1, top_id=None, vpool=None,
-            encoding=EncType.seqcounter):
+            encoding=EncType.seqcounter, solver=None):
         """
             This method can be used for creating a CNF encoding of an AtLeastK
             constraint, i.e. of :math:`\sum_{i=1}^{n}{x_i}\geq k`. The method
@@ -286,12 +319,14 @@ class CardEnc(object):
             :param top_id: top variable identifier used so far.
             :param vpool: variable pool for counting the number of variables.
             :param encoding: identifier of the encoding to use.
+            :param solver: a solver to add the clauses to.
 
             :type lits: iterable(int)
             :type bound: int
             :type top_id: integer or None
             :type vpool: :class:`.IDPool`
             :type encoding: integer
+            :type solver: :class:`pysat.solvers.Solver`
 
             Parameter ``top_id`` serves to increase integer identifiers of
             auxiliary variables introduced during the encoding process. This
@@ -308,6 +343,28 @@ class CardEnc(object):
 
             The default value of ``encoding`` is :attr:`Enctype.seqcounter`.
 
+            If a ``solver`` is given, the clauses of the encoding are added
+            directly to it (see :meth:`pysat.solvers.Solver.append_buffer`)
+            without being converted to Python lists. The resulting
+            :class:`.CNFPlus` object then holds no clauses and serves only to
+            report the top variable identifier ``nv``. With
+            :attr:`EncType.native`, the constraint is added to the solver with
+            :meth:`pysat.solvers.Solver.add_atmost`. A
+            :class:`.ClauseBuffer` can be given instead of a solver to collect
+            the clauses of several encodings compactly.
+
+            .. code-block:: python
+
+                >>> from pysat.card import *
+                >>> from pysat.solvers import Solver
+                >>> with Solver(name='g3') as s:
+                ...     cnf = CardEnc.atmost(lits=[1, 2, 3], bound=1,
+                ...             encoding=EncType.seqcounter, solver=s)
+                ...     print(cnf.clauses, cnf.nv)
+                ...     print(s.solve(assumptions=[1, 2]))
+                [] 5
+                False
+
             The method *translates* the AtLeast constraint into an AtMost
             constraint by *negating* the literals of ``lits``, creating a new
             bound :math:`n-k` and invoking :meth:`CardEnc.atmost` with the
@@ -345,10 +402,18 @@ class CardEnc(object):
         # Minicard's native representation is handled separately
         if encoding == 9:
             ret.atmosts, ret.nv = [([-l for l in lits], len(lits) - bound)], top_id
+
+            if solver is not None:
+                solver.add_atmost(*ret.atmosts.pop())
+
             return ret
 
+        # clauses go to the solver as a flat buffer unless they may need to be
+        # renumbered because of the variables occupied in the pool
+        flat = solver is not None and not (vpool and vpool._occupied)
+
         res = pycard.encode_atleast(lits, bound, top_id, encoding,
-                int(MainThread.check()))
+                int(MainThread.check()), int(flat))
 
         if res:
             ret.clauses, ret.nv = res
@@ -362,11 +427,14 @@ class CardEnc(object):
                     vpool.top = ret.nv - 1
                     vpool._next()
 
+            if solver is not None:
+                cls._to_solver(ret, solver)
+
         return ret
 
     @classmethod
     def equals(cls, lits, bound=1, top_id=None, vpool=None,
-            encoding=EncType.seqcounter):
+            encoding=EncType.seqcounter, solver=None):
         """
             This method can be used for creating a CNF encoding of an EqualsK
             constraint, i.e. of :math:`\sum_{i=1}^{n}{x_i}= k`. The method
@@ -376,11 +444,15 @@ class CardEnc(object):
         """
 
         if vpool:
-            res1 = cls.atleast(lits, bound=bound, vpool=vpool, encoding=encoding)
-            res2 = cls.atmost(lits, bound=bound, vpool=vpool, encoding=encoding)
+            res1 = cls.atleast(lits, bound=bound, vpool=vpool,
+                    encoding=encoding, solver=solver)
+            res2 = cls.atmost(lits, bound=bound, vpool=vpool,
+                    encoding=encoding, solver=solver)
         else:
-            res1 = cls.atleast(lits, bound=bound, top_id=top_id, encoding=encoding)
-            res2 = cls.atmost(lits, bound=bound, top_id=res1.nv, encoding=encoding)
+            res1 = cls.atleast(lits, bound=bound, top_id=top_id,
+                    encoding=encoding, solver=solver)
+            res2 = cls.atmost(lits, bound=bound, top_id=res1.nv,
+                    encoding=encoding, solver=solver)
 
         # merging together AtLeast and AtMost constraints
         res1.nv = max(res1.nv, res2.nv)
@@ -389,6 +461,158 @@ class CardEnc(object):
 
         return res1
 
+    @classmethod
+    def atmost_many(cls, constraints, top_id=None, vpool=None,
+            encoding=EncType.seqcounter, solver=None, threads=0):
+        """
+            This method can be used for creating CNF encodings of many
+            independent AtMostK constraints at once. The constraints are given
+            as a list of pairs ``(lits, bound)`` and encoded in parallel, with
+            the number of native threads set by ``threads`` (by default, one
+            per core). The result is exactly the same as the one of calling
+            :meth:`CardEnc.atmost` for each of the constraints in order, with
+            the top variable identifier of each call being the one returned by
+            the previous call, but the constraints are converted to and from
+            Python objects in one go. All the other arguments are those of
+            :meth:`CardEnc.atleast`.
+
+            If a ``solver`` is given, all the clauses are added to it as one
+            flat buffer, and no Python lists are created for them, which for
+            large batches takes longer than the encoding itself. Note that a
+            keyboard interrupt is delivered only after all the constraints
+            are encoded.
+
+            :param constraints: a list of pairs of literals and bounds.
+            :param threads: number of threads to use.
+
+            :type constraints: iterable(tuple(iterable(int), int))
+            :type threads: int
+
+            :rtype: :class:`pysat.formula.CNFPlus`
+
+            .. code-block:: python
+
+                >>> from pysat.card import *
+                >>> cnf = CardEnc.atmost_many([([1, 2, 3], 1), ([-1, 4, 5], 1)],
+                ...         encoding=EncType.seqcounter)
+                >>> print(cnf.clauses)
+                [[-1, 6], [-6, 7], [-2, -6], [-2, 7], [-3, -7], [1, 8], [-8, 9], [-4, -8], [-4, 9], [-5, -9]]
+                >>> print(cnf.nv)
+                9
+        """
+
+        if encoding < 0 or encoding > 9:
+            raise(NoSuchEncodingError(encoding))
+
+        assert not top_id or not vpool, \
+                'Use either a top id or a pool of variables but not both.'
+
+        # we are going to return this formula
+        ret = CNFPlus()
+
+        # empty lists of literals are dropped
+        constraints = [(list(lits), bound) for lits, bound in constraints if lits]
+        if not constraints:
+            return ret
+
+        # obtaining the top id from the variable pool
+        if vpool:
+            top_id = vpool.top
+
+        # choosing the maximum id among the current top and all the literals
+        top_id = max([abs(l) for lits, bound in constraints for l in lits] + [top_id if top_id != None else 0])
+
+        # MiniCard's native representation is handled separately
+        if encoding == 9:
+            ret.atmosts, ret.nv = constraints, top_id
+
+            if solver is not None:
+                for am in ret.atmosts:
+                    solver.add_atmost(*am)
+
+                ret.atmosts = []
+
+            return ret
+
+        # clauses go to the solver as a flat buffer unless they may need to be
+        # renumbered because of the variables occupied in the pool
+        flat = solver is not None and not (vpool and vpool._occupied)
+
+        res = pycard.encode_many(constraints, top_id, encoding, threads,
+                int(flat))
+
+        if res:
+            ret.clauses, ret.nv = res
+
+            # updating vpool if necessary
+            if vpool:
+                if vpool._occupied and vpool.top <= vpool._occupied[0][0] <= ret.nv:
+                    cls._update_vids(ret, vpool)
+                else:
+                    # here, ret.nv id is assumed to be larger than the top id
+                    vpool.top = ret.nv - 1
+                    vpool._next()
+
+            if solver is not None:
+                cls._to_solver(ret, solver)
+
+        return ret
+
+
+
+    @classmethod
+    def set_cache(cls, max_lits=1 << 24):
+        """
+            The constraints encoded by :meth:`atmost`, :meth:`atleast`,
+            :meth:`equals`, and :meth:`atmost_many` are cached by their shape,
+            i.e. by the number of literals, the bound, and the encoding. The
+            first constraint of a shape is encoded over placeholder inputs
+            and kept as a template, while the later ones are obtained by
+            substituting their literals for the placeholders and renumbering
+            the auxiliary variables in one linear pass, which is much cheaper
+            than running the construction of a sorting network or a
+            totalizer again. The result is exactly the same as without
+            caching.
+
+            The cache is disabled unless this method is called. It drops all
+            the cached templates and sets the maximum number of literals kept
+            in the cache overall (:math:`2^{24}` by default). Once the limit
+            is reached, the templates of new shapes are not cached. Setting
+            ``max_lits`` to ``0`` disables caching again.
+
+            The templates are kept until the cache is reset or the process
+            exits. Each cached literal takes 4 bytes and each clause another
+            8 bytes, and so a full cache of the default size takes at least
+            64MB. The memory actually taken is reported by
+            :meth:`cache_memory`.
+
+            :param max_lits: the maximum number of literals in the cache.
+            :type max_lits: int
+
+            .. code-block:: python
+
+                >>> from pysat.card import *
+                >>> CardEnc.set_cache()
+                >>> cnf1 = CardEnc.atmost(lits=[1, 2, 3, 4], bound=2, encoding=EncType.totalizer)
+                >>> cnf2 = CardEnc.atmost(lits=[5, -6, 7, 8], bound=2, encoding=EncType.totalizer)
+                >>> CardEnc.set_cache(0)
+                >>> cnf3 = CardEnc.atmost(lits=[5, -6, 7, 8], bound=2, encoding=EncType.totalizer)
+                >>> print(cnf2.clauses == cnf3.clauses)
+                True
+        """
+
+        pycard.encode_cache(max_lits)
+
+    @classmethod
+    def cache_memory(cls):
+        """
+            Get the number of bytes taken by the templates kept in the cache
+            of encodings (see :meth:`set_cache`).
+
+            :rtype: int
+        """
+
+        return pycard.encode_memory()
 
 #
 #==============================================================================
@@ -401,15 +625,17 @@ class ITotalizer(object):
         a *totalizer tree* can be extended, or the bound can be increased, as
         well as two totalizer trees can be merged into one.
 
-        The constructor of the class object takes 3 default arguments.
+        The constructor of the class object takes 4 default arguments.
 
         :param lits: a list of literals to sum.
         :param ubound: the largest potential bound to use.
         :param top_id: top variable identifier used so far.
+        :param solver: a solver to add the clauses to.
 
         :type lits: iterable(int)
         :type ubound: int
         :type top_id: integer or None
+        :type solver: :class:`pysat.solvers.Solver`
 
         The encoding of the current tree can be accessed with the use of
         :class:`.CNF` variable stored as ``self.cnf``. Potential bounds **are
@@ -419,6 +645,13 @@ class ITotalizer(object):
         a unit clause ``-self.rhs[k]``. **Note** that ``-self.rhs[0]`` enforces
         all literals of the sum to be *false*.
 
+        If a ``solver`` is given, all the clauses created by the object,
+        including those produced by :meth:`increase`, :meth:`extend`, and
+        :meth:`merge_with`, are added directly to the solver as flat buffers
+        instead of being stored in ``self.cnf``. Only ``self.rhs``,
+        ``self.top_id`` (also kept as ``self.cnf.nv``), and ``self.nof_new``
+        are updated then.
+
         An :class:`ITotalizer` object should be deleted if it is not needed
         anymore.
 
@@ -447,11 +680,14 @@ class ITotalizer(object):
             [6, 7]
     """
 
-    def __init__(self, lits=[], ubound=1, top_id=None):
+    def __init__(self, lits=[], ubound=1, top_id=None, solver=None):
         """
             Constructor.
         """
 
+        # solver to add the clauses to, if any
+        self.solver = solver
+
         # internal totalizer object
         self.tobj = None
 
@@ -488,14 +724,33 @@ class ITotalizer(object):
 
         # creating the object
         self.tobj, clauses, self.rhs, self.top_id = pycard.itot_new(self.lits,
-                self.ubound, self.top_id, int(MainThread.check()))
+                self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
 
         # saving the result
-        self.cnf.clauses = clauses
+        self.cnf.clauses = []
         self.cnf.nv = self.top_id
 
         # for convenience, keeping the number of clauses
-        self.nof_new = len(clauses)
+        self.nof_new = self._save(clauses)
+
+    def _save(self, clauses):
+        """
+            Store new clauses either in ``self.cnf`` or in the solver. Returns
+            the number of clauses saved.
+        """
+
+        if self.solver is None:
+            self.cnf.clauses.extend(clauses)
+            return len(clauses)
+
+        if type(clauses) == tuple:
+            # a flat buffer of clauses and its size
+            self.solver.append_buffer(clauses[0])
+            return clauses[1]
+
+        self.solver.append_formula(clauses)
+        return len(clauses)
 
     def delete(self):
         """
@@ -507,8 +762,8 @@ class ITotalizer(object):
             if not self._merged:
                 pycard.itot_del(self.tobj)
 
-                # otherwise, this totalizer object is merged into a larger one
-                # therefore, this memory should be freed in its destructor
+                # otherwise, its nodes have been moved into a larger totalizer
+                # object, which frees them; the capsule frees the rest
 
             self.tobj = None
 
@@ -521,6 +776,22 @@ class ITotalizer(object):
 
         self.nof_new = 0
 
+    def memory_usage(self):
+        """
+            Get the number of bytes taken by the native tree of the
+            totalizer, i.e. by its nodes and their output variables. The
+            clauses of the encoding are stored in ``self.cnf`` and are not
+            counted. The tree of a totalizer merged into another one (see
+            :meth:`merge_with`) is empty.
+
+            :rtype: int
+        """
+
+        if self.tobj:
+            return pycard.itot_mem(self.tobj)
+
+        return 0
+
     def __enter__(self):
         """
             'with' constructor.
@@ -597,15 +868,13 @@ class ITotalizer(object):
 
         # updating the object and adding more variables and clauses
         clauses, self.rhs, self.top_id = pycard.itot_inc(self.tobj,
-                self.ubound, self.top_id, int(MainThread.check()))
+                self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
 
-        # saving the result
-        self.cnf.clauses.extend(clauses)
+        # saving the result and keeping the number of newly added clauses
+        self.nof_new = self._save(clauses)
         self.cnf.nv = self.top_id
 
-        # keeping the number of newly added clauses
-        self.nof_new = len(clauses)
-
     def extend(self, lits=[], ubound=None, top_id=None):
         """
             Extends the list of literals in the sum and (if needed) increases a
@@ -670,16 +939,14 @@ class ITotalizer(object):
 
         # updating the object and adding more variables and clauses
         self.tobj, clauses, self.rhs, self.top_id = pycard.itot_ext(self.tobj,
-                lits, self.ubound, self.top_id, int(MainThread.check()))
+                lits, self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
 
         # saving the result
-        self.cnf.clauses.extend(clauses)
+        self.nof_new = self._save(clauses)
         self.cnf.nv = self.top_id
         self.lits.extend(lits)
 
-        # for convenience, keeping the number of new clauses
-        self.nof_new = len(clauses)
-
     def merge_with(self, another, ubound=None, top_id=None):
         """
             This method merges a tree of the current :class:`ITotalizer`
@@ -746,15 +1013,215 @@ class ITotalizer(object):
 
         # updating the object and adding more variables and clauses
         self.tobj, clauses, self.rhs, self.top_id = pycard.itot_mrg(self.tobj,
-                another.tobj, self.ubound, self.top_id, int(MainThread.check()))
+                another.tobj, self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
+
+        # saving the result; the clauses of another totalizer are to be
+        # added to our solver unless they are in a solver already
+        self.nof_new = self._save(another.cnf.clauses) + self._save(clauses)
+        self.cnf.nv = self.top_id
+
+        # memory deallocation should not be done for the merged tree
+        another._merged = True
+
+
+#
+#==============================================================================
+class IModTotalizer(ITotalizer, object):
+    """
+        This class implements an incremental variant of the modulo totalizer
+        encoding [9]_ [10]_, with the same interface as :class:`ITotalizer`.
+        The count of each node of the tree is split into a remainder modulo
+        ``p`` and a quotient. Only the variables of the quotient depend on the
+        bound and are created lazily, when the bound is increased. As a
+        result, the encoding is much smaller than the iterative totalizer for
+        large bounds.
+
+        The constructor takes the arguments of :class:`ITotalizer` and the
+        modulo to use. If it is not given, it is set to :math:`\\lfloor
+        \\sqrt{ubound} \\rfloor` (but at least 2) as in the modulo totalizer
+        for :math:`k`-cardinality. The modulo cannot be changed afterwards and
+        only objects with the same modulo can be merged.
+
+        :param lits: a list of literals to sum.
+        :param ubound: the largest potential bound to use.
+        :param top_id: top variable identifier used so far.
+        :param solver: a solver to add the clauses to.
+        :param modulo: the modulo to use.
+
+        :type lits: iterable(int)
+        :type ubound: int
+        :type top_id: integer or None
+        :type solver: :class:`pysat.solvers.Solver`
+        :type modulo: int or None
+
+        As in :class:`ITotalizer`, a bound :math:`k` can be enforced by
+        considering a unit clause ``-self.rhs[k]``. Note that, in contrast to
+        the iterative totalizer, the variables of ``self.rhs`` are auxiliary
+        ones rather than the outputs of the tree. All the other methods,
+        i.e. :meth:`increase`, :meth:`extend`, and :meth:`merge_with`, behave
+        exactly as those of :class:`ITotalizer`.
+
+        .. code-block:: python
+
+            >>> from pysat.card import IModTotalizer
+            >>> from pysat.solvers import Solver
+            >>> with IModTotalizer(lits=list(range(1, 101)), ubound=40) as t:
+            ...     print(len(t.cnf.clauses), t.modulo)
+            ...     with Solver(bootstrap_with=t.cnf.clauses) as s:
+            ...         print(s.solve(assumptions=[-t.rhs[40]] + list(range(1, 42))))
+            ...         t.increase(ubound=50)
+            ...         s.append_formula(t.cnf.clauses[-t.nof_new:])
+            ...         print(s.solve(assumptions=[-t.rhs[50]] + list(range(1, 51))))
+            1433 6
+            False
+            True
+    """
+
+    def __init__(self, lits=[], ubound=1, top_id=None, solver=None,
+            modulo=None):
+        """
+            Constructor.
+        """
+
+        self.modulo = modulo
+
+        super(IModTotalizer, self).__init__(lits=lits, ubound=ubound,
+                top_id=top_id, solver=solver)
+
+    def new(self, lits=[], ubound=1, top_id=None):
+        """
+            The actual constructor of :class:`IModTotalizer`. Invoked from
+            ``self.__init__()``. See :meth:`ITotalizer.new` for details.
+        """
+
+        self.lits = list(lits)
+        self.ubound = ubound
+        self.top_id = max(map(lambda x: abs(x), self.lits + [top_id if top_id != None else 0]))
+
+        if not self.modulo:
+            self.modulo = max(2, int(math.floor(math.sqrt(self.ubound))))
+
+        # creating the object
+        self.tobj, clauses, self.rhs, self.top_id = pycard.imto_new(self.lits,
+                self.ubound, self.modulo, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
+
+        # saving the result
+        self.cnf.clauses = []
+        self.cnf.nv = self.top_id
+
+        # for convenience, keeping the number of clauses
+        self.nof_new = self._save(clauses)
+
+    def delete(self):
+        """
+            Destroys a previously constructed :class:`IModTotalizer` object.
+            Internal variables ``self.cnf`` and ``self.rhs`` get cleaned.
+        """
+
+        if self.tobj:
+            if not self._merged:
+                pycard.imto_del(self.tobj)
+
+            self.tobj = None
+
+        super(IModTotalizer, self).delete()
+
+    def memory_usage(self):
+        """
+            Get the number of bytes taken by the native tree of the
+            totalizer (see :meth:`ITotalizer.memory_usage`).
+
+            :rtype: int
+        """
+
+        if self.tobj:
+            return pycard.imto_mem(self.tobj)
+
+        return 0
+
+    def increase(self, ubound=1, top_id=None):
+        """
+            Increases a potential upper bound that can be imposed on the
+            literals in the sum to a new value. See
+            :meth:`ITotalizer.increase` for details.
+        """
+
+        self.top_id = max(self.top_id, top_id if top_id != None else 0)
+
+        # do nothing if the bound is set incorrectly
+        if ubound <= self.ubound or self.ubound >= len(self.lits):
+            self.nof_new = 0
+            return
+        else:
+            self.ubound = ubound
+
+        # updating the object and adding more variables and clauses
+        clauses, self.rhs, self.top_id = pycard.imto_inc(self.tobj,
+                self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
+
+        # saving the result and keeping the number of newly added clauses
+        self.nof_new = self._save(clauses)
+        self.cnf.nv = self.top_id
+
+    def extend(self, lits=[], ubound=None, top_id=None):
+        """
+            Extends the list of literals in the sum and (if needed) increases
+            a potential upper bound. See :meth:`ITotalizer.extend` for
+            details.
+        """
+
+        # preparing a new list of distinct input literals
+        lits = sorted(set(lits).difference(set(self.lits)))
+
+        if not lits:
+            # nothing to merge with -> just increase the bound
+            if ubound:
+                self.increase(ubound=ubound, top_id=top_id)
+
+            return
+
+        self.top_id = max(map(lambda x: abs(x), self.lits + [self.top_id, top_id if top_id != None else 0]))
+        self.ubound = max(self.ubound, ubound if ubound != None else 0)
+
+        # updating the object and adding more variables and clauses
+        self.tobj, clauses, self.rhs, self.top_id = pycard.imto_ext(self.tobj,
+                lits, self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
 
         # saving the result
-        self.cnf.clauses.extend(another.cnf.clauses)
-        self.cnf.clauses.extend(clauses)
+        self.nof_new = self._save(clauses)
         self.cnf.nv = self.top_id
+        self.lits.extend(lits)
 
-        # for convenience, keeping the number of new clauses
-        self.nof_new = len(another.cnf.clauses) + len(clauses)
+    def merge_with(self, another, ubound=None, top_id=None):
+        """
+            Merges the tree of the current :class:`IModTotalizer` object with
+            the tree of another one, which must use the same modulo. See
+            :meth:`ITotalizer.merge_with` for details.
+        """
+
+        assert isinstance(another, IModTotalizer) and \
+                another.modulo == self.modulo, \
+                'Only modulo totalizers with the same modulo can be merged.'
+
+        self.top_id = max(self.top_id, top_id if top_id != None else 0, another.top_id)
+        self.ubound = max(self.ubound, ubound if ubound != None else 0, another.ubound)
+
+        # extending the list of input literals
+        self.lits.extend(another.lits)
+
+        # updating the object and adding more variables and clauses
+        self.tobj, clauses, self.rhs, self.top_id = pycard.imto_mrg(self.tobj,
+                another.tobj, self.ubound, self.top_id, int(MainThread.check()),
+                int(self.solver is not None))
+
+        # saving the result; the clauses of another totalizer are to be
+        # added to our solver unless they are in a solver already
+        self.nof_new = self._save(another.cnf.clauses) + self._save(clauses)
+        self.cnf.nv = self.top_id
 
         # memory deallocation should not be done for the merged tree
         another._merged = True
@@ -17,6 +17,7 @@
         :nosignatures:
 
         IDPool
+        ClauseBuffer
         CNF
         CNFPlus
         WCNF
@@ -176,6 +177,22 @@
     ``atmosts`` (``atms``, resp.). **Note** that at this point, AtMostK
     constraints in ``WCNF`` can be *hard* only.
 
+    Large formulas can keep their clauses in a compact
+    :class:`ClauseBuffer` instead of a list of lists. A clause buffer stores
+    the literals in a flat array of 32-bit integers and can be passed to the
+    solvers, to the DIMACS writer, and to the cardinality encoders without
+    creating any Python objects for the literals. Classes :class:`CNF`,
+    :class:`CNFPlus`, :class:`WCNF`, and :class:`WCNFPlus` use it as the
+    backing store of their clauses if created with ``compact=True``:
+
+    .. code-block:: python
+
+        >>> from pysat.formula import CNF
+        >>> # a million clauses of size 3
+        >>> cnf = CNF(from_file='huge-file.cnf', compact=True)
+        >>> print(cnf.clauses.memory())  # in bytes
+        24000008
+
     Besides the implementations of CNF and WCNF formulas in PySAT, the
     :mod:`pysat.formula` module also provides a way to manage variable
     identifiers. This can be done with the use of the :class:`IDPool` manager.
@@ -214,12 +231,14 @@
 #
 #==============================================================================
 from __future__ import print_function
+import array
 import collections
 import copy
-import decimal
+import io
 import itertools
 import os
 from pysat._fileio import FileObject
+import pycard
 import sys
 
 # checking whether or not py-aiger-cnf is available and working as expected
@@ -235,6 +254,78 @@ except ImportError:  # for Python3
     from io import StringIO
 
 
+# formats recognized by the native parser and the size of chunks fed into it
+#==============================================================================
+_dimacs_formats = {'cnf': 0, 'wcnf': 1, 'cnf+': 2, 'wcnf+': 3}
+_dimacs_chunk = 1 << 20
+
+
+#
+#==============================================================================
+def _parse_dimacs(fmt, file_pointer, comment_lead, flat=False):
+    """
+        Parse a formula in one of the formats above with the native parser of
+        :mod:`pycard`. Files opened in binary mode are mapped in memory while
+        other file pointers, e.g. compressed streams, are read in chunks.
+        Plain iterables of lines are also accepted.
+
+        The result is a tuple ``(nv, topw, hard, soft, wght, atms, negs,
+        comments)``, in which the components irrelevant to the format given
+        are empty. If ``flat`` is ``True``, the (hard) clauses are returned
+        as a pair of a flat zero-terminated buffer and the number of clauses
+        in it, which can be passed to :meth:`.Solver.append_buffer`. The
+        same holds for the soft clauses.
+    """
+
+    # lines starting with a multi-character lead are never skipped
+    leads = ''.join([lead for lead in comment_lead if len(lead) == 1])
+    parser = pycard.dimacs_new(_dimacs_formats[fmt], leads)
+
+    mapped = False
+    if type(file_pointer) is io.BufferedReader:
+        try:
+            fd, pos = file_pointer.fileno(), file_pointer.tell()
+            mapped = pycard.dimacs_map(parser, fd, pos)
+        except (IOError, OSError):
+            pass
+
+    if mapped:
+        file_pointer.seek(0, os.SEEK_END)
+    elif hasattr(file_pointer, 'read'):
+        chunk = file_pointer.read(_dimacs_chunk)
+        while chunk:
+            pycard.dimacs_feed(parser, chunk)
+            chunk = file_pointer.read(_dimacs_chunk)
+    else:
+        for line in file_pointer:
+            pycard.dimacs_feed(parser, line if line.endswith('\n') else line + '\n')
+
+    return pycard.dimacs_result(parser, int(flat))
+
+
+#
+#==============================================================================
+def _write_dimacs(file_pointer, lines, items, prefix='', weights=None,
+        cardinal=False):
+    """
+        Write the given lines followed by a list of clauses (or of pairs
+        ``(lits, rhs)`` if ``cardinal`` is ``True``) to a file pointer by
+        means of the native writer of :mod:`pycard`. The output is prepared in
+        large chunks, which are passed to the ``write()`` method of the file
+        pointer as bytes or as text depending on its mode. Each clause is
+        preceded by its weight or, if no weights are given, by ``prefix``.
+        A flat buffer of clauses (or a :class:`ClauseBuffer`) is accepted
+        too.
+    """
+
+    if isinstance(items, ClauseBuffer):
+        items = items.buffer()
+
+    text = not isinstance(file_pointer, (io.RawIOBase, io.BufferedIOBase))
+    pycard.dimacs_write(file_pointer.write, int(text), lines, items, prefix,
+            weights, int(cardinal))
+
+
 #
 #==============================================================================
 class IDPool(object):
@@ -381,6 +472,372 @@ class IDPool(object):
         return self.top
 
 
+#
+#==============================================================================
+class ClauseBuffer(object):
+    """
+        A compact list of clauses. The clauses are stored back to back in a
+        flat array of 32-bit literals, each terminated with ``0`` as in the
+        DIMACS format, and indexed by an array of 64-bit offsets: clause
+        ``i`` starts at position ``offs[i]`` of ``lits`` and its terminating
+        ``0`` is at position ``offs[i + 1] - 1``. Optionally, every clause
+        can be given a weight. Integral weights are kept in an array of
+        64-bit integers, which is replaced with a list once a weight of
+        another type is added.
+
+        A clause buffer takes 4 bytes per literal plus 12 bytes per clause,
+        i.e. several times less memory than a list of lists, and it can be
+        used wherever the clauses of a formula are expected. It can be
+        iterated over, indexed and compared with a list of clauses, and it
+        can be the backing store of :class:`CNF`, :class:`CNFPlus`, and
+        :class:`WCNF` (see their ``compact`` parameter). The method
+        :meth:`buffer` returns a ``memoryview`` of the literals, which the
+        solvers (see :meth:`.Solver.append_buffer`) and the native DIMACS
+        writer consume without converting them into Python objects. A clause
+        buffer also has the ``append_formula()`` and ``append_buffer()``
+        methods of a solver and so it can be passed as the ``solver``
+        argument of :meth:`CNF.from_file` or of the encoders of
+        :mod:`pysat.card`.
+
+        :param from_clauses: a list of clauses to bootstrap the buffer with
+        :param from_buffer: a flat zero-terminated buffer of clauses
+        :param weights: whether or not the clauses are weighted
+
+        :type from_clauses: iterable(iterable(int))
+        :type from_buffer: buffer of int32
+        :type weights: bool
+
+        Slicing a clause buffer does not copy anything: the result is a
+        read-only view sharing the storage of the original buffer. Note that
+        while a ``memoryview`` returned by :meth:`buffer` is alive, no more
+        clauses can be added to the buffer.
+
+        .. code-block:: python
+
+            >>> from pysat.formula import ClauseBuffer
+            >>> from pysat.solvers import Solver
+            >>>
+            >>> cb = ClauseBuffer(from_clauses=[[-1, 2], [-2, 3], [1]])
+            >>> cb.append([-3])
+            >>> print(len(cb), cb.nv, cb[1], cb[2:])
+            4 3 [-2, 3] [[1], [-3]]
+            >>> print(cb.buffer().tolist())
+            [-1, 2, 0, -2, 3, 0, 1, 0, -3, 0]
+            >>>
+            >>> with Solver(bootstrap_with=cb[:3]) as s:
+            ...     print(s.solve())
+            True
+    """
+
+    def __init__(self, from_clauses=[], from_buffer=None, weights=False):
+        """
+            Constructor.
+        """
+
+        self.lits = array.array('i')
+        self.offs = array.array('q', [0])
+        self.wght = array.array('q') if weights else None
+        self.nv = 0
+
+        # the range of clauses of a view
+        self.span = None
+
+        if from_buffer is not None:
+            self.append_buffer(from_buffer)
+        elif from_clauses:
+            self.extend(from_clauses)
+
+    def _range(self):
+        """
+            The range of clauses of the buffer (or of the view).
+        """
+
+        if self.span:
+            return self.span
+
+        return 0, len(self.offs) - 1
+
+    def _check_owner(self):
+        """
+            Views cannot be modified.
+        """
+
+        if self.span:
+            raise TypeError('A view of a clause buffer is read-only')
+
+    def __len__(self):
+        """
+            Number of clauses in the buffer.
+        """
+
+        beg, end = self._range()
+        return end - beg
+
+    def __getitem__(self, key):
+        """
+            A clause as a list of literals or, given a slice, a view of a
+            range of clauses.
+        """
+
+        beg, end = self._range()
+
+        if isinstance(key, slice):
+            start, stop, step = key.indices(end - beg)
+            if step != 1:
+                raise ValueError('Clause buffers can only be sliced with step 1')
+
+            view = ClauseBuffer()
+            view.lits, view.offs, view.wght = self.lits, self.offs, self.wght
+            view.span = (beg + start, beg + max(start, stop))
+            view.nv = pycard.clauses_index(view.buffer(), 0)[1]
+
+            return view
+
+        if key < 0:
+            key += end - beg
+        if key < 0 or key >= end - beg:
+            raise IndexError('clause index out of range')
+
+        key += beg
+        return self.lits[self.offs[key]:self.offs[key + 1] - 1].tolist()
+
+    def __iter__(self):
+        """
+            Iterator over all clauses of the buffer.
+        """
+
+        beg, end = self._range()
+        for i in range(beg, end):
+            yield self.lits[self.offs[i]:self.offs[i + 1] - 1].tolist()
+
+    def __eq__(self, other):
+        """
+            Clause buffers are equal to the lists of the same clauses.
+        """
+
+        if isinstance(other, ClauseBuffer):
+            return len(self) == len(other) and self.buffer() == other.buffer()
+
+        try:
+            return len(self) == len(other) and all(cl == list(ot)
+                    for cl, ot in zip(self, other))
+        except TypeError:
+            return False
+
+    def __ne__(self, other):
+        """
+            Negation of :meth:`__eq__` (for Python 2).
+        """
+
+        return not self == other
+
+    def __add__(self, other):
+        """
+            Concatenation of two lists of clauses.
+        """
+
+        res = self.copy()
+        res.extend(other)
+
+        return res
+
+    def __repr__(self):
+        """
+            The clauses are shown as a list of lists.
+        """
+
+        return repr(list(self))
+
+    def __deepcopy__(self, memo):
+        """
+            Deep copy, see :meth:`copy`.
+        """
+
+        return self.copy()
+
+    def copy(self):
+        """
+            Create a copy of the buffer (or of the view) owning its storage.
+
+            :rtype: :class:`ClauseBuffer`
+        """
+
+        res = ClauseBuffer(from_buffer=self.buffer())
+
+        if self.wght is not None:
+            beg, end = self._range()
+            res.wght = self.wght[beg:end]
+
+        return res
+
+    def buffer(self):
+        """
+            Get the literals of the clauses as a flat zero-terminated
+            ``memoryview`` of format ``'i'``. No data is copied.
+
+            :rtype: memoryview
+        """
+
+        beg, end = self._range()
+        return memoryview(self.lits)[self.offs[beg]:self.offs[end]]
+
+    def weights(self):
+        """
+            Get the weights of the clauses or ``None`` if the buffer is not
+            weighted.
+
+            :rtype: array of int64 or list or None
+        """
+
+        if self.wght is None or not self.span:
+            return self.wght
+
+        return self.wght[self.span[0]:self.span[1]]
+
+    def memory(self):
+        """
+            Get the number of bytes taken by the storage of the buffer.
+
+            :rtype: int
+        """
+
+        size = self.lits.buffer_info()[1] * self.lits.itemsize + \
+                self.offs.buffer_info()[1] * self.offs.itemsize
+
+        if isinstance(self.wght, array.array):
+            size += self.wght.buffer_info()[1] * self.wght.itemsize
+
+        return size
+
+    def append(self, clause, weight=None):
+        """
+            Add a clause to the buffer, with a weight if the buffer is
+            weighted.
+
+            :param clause: a new clause to add.
+            :param weight: weight of the clause.
+
+            :type clause: iterable(int)
+            :type weight: number
+        """
+
+        self._check_owner()
+        weights = self._check_weights(None if weight is None else [weight], 1)
+
+        clause = list(clause)
+        if 0 in clause:
+            raise ValueError('non-zero integer expected')
+
+        self.lits.extend(clause)
+        self.nv = max([abs(l) for l in clause] + [self.nv])
+
+        self.lits.append(0)
+        self.offs.append(len(self.lits))
+
+        self._add_weights(weights)
+
+    def extend(self, clauses, weights=None):
+        """
+            Add several clauses to the buffer. The clauses are packed
+            natively unless they come in another clause buffer, whose
+            literals are copied as they are.
+
+            :param clauses: a list of new clauses to add.
+            :param weights: their weights if the buffer is weighted.
+
+            :type clauses: iterable(iterable(int))
+            :type weights: iterable(number)
+        """
+
+        self._check_owner()
+
+        if isinstance(clauses, ClauseBuffer):
+            if weights is None:
+                weights = clauses.weights()
+
+            self.append_buffer(clauses.buffer(), weights=weights)
+        else:
+            lits, offs, nv = pycard.clauses_pack(clauses, len(self.lits))
+            self._add_packed(lits, offs, nv, weights)
+
+    def append_formula(self, formula, no_return=True):
+        """
+            Add a list of clauses, like :meth:`.Solver.append_formula`.
+        """
+
+        self.extend(formula)
+
+        if not no_return:
+            return True
+
+    def append_buffer(self, buffer, no_return=True, weights=None):
+        """
+            Add a flat zero-terminated buffer of clauses, like
+            :meth:`.Solver.append_buffer`. The buffer is scanned natively
+            for the offsets of the clauses and its literals are copied.
+
+            :param buffer: a zero-terminated buffer of clauses.
+            :param no_return: return ``True`` if set to ``False``.
+            :param weights: the weights of the clauses if the buffer is
+                weighted.
+
+            :type buffer: buffer of int32
+            :type no_return: bool
+            :type weights: iterable(number)
+        """
+
+        self._check_owner()
+
+        offs, nv = pycard.clauses_index(buffer, len(self.lits))
+        self._add_packed(memoryview(buffer).cast('B'), offs, nv, weights)
+
+        if not no_return:
+            return True
+
+    def _add_packed(self, lits, offs, nv, weights):
+        """
+            Add the literals and offsets produced by :mod:`pycard`.
+        """
+
+        weights = self._check_weights(weights, len(offs) // self.offs.itemsize)
+
+        self.lits.frombytes(lits)
+        self.offs.frombytes(offs)
+        self.nv = max(self.nv, nv)
+
+        self._add_weights(weights)
+
+    def _check_weights(self, weights, nof_clauses):
+        """
+            A weighted buffer needs one weight per clause.
+        """
+
+        if self.wght is None:
+            return None
+
+        weights = list(weights) if weights is not None else []
+        if len(weights) != nof_clauses or None in weights:
+            raise ValueError('One weight per clause expected')
+
+        return weights
+
+    def _add_weights(self, weights):
+        """
+            Integral weights are kept in an array, the others in a list.
+        """
+
+        if weights is None:
+            return
+
+        if isinstance(self.wght, array.array):
+            try:
+                weights = array.array('q', weights)
+            except (TypeError, OverflowError):
+                self.wght = self.wght.tolist()
+
+        self.wght.extend(weights)
+
+
 #
 #==============================================================================
 class CNF(object):
@@ -397,6 +854,7 @@ class CNF(object):
         :param from_clauses: a list of clauses to bootstrap the formula with
         :param from_aiger: an AIGER circuit to bootstrap the formula with
         :param comment_lead: a list of characters leading comment lines
+        :param compact: keep the clauses in a :class:`ClauseBuffer`
 
         :type from_file: str
         :type from_fp: file_pointer
@@ -404,16 +862,18 @@ class CNF(object):
         :type from_clauses: list(list(int))
         :type from_aiger: :class:`aiger.AIG` (see `py-aiger package <https://github.com/mvcisback/py-aiger>`__)
         :type comment_lead: list(str)
+        :type compact: bool
     """
 
     def __init__(self, from_file=None, from_fp=None, from_string=None,
-            from_clauses=[], from_aiger=None, comment_lead=['c']):
+            from_clauses=[], from_aiger=None, comment_lead=['c'],
+            compact=False):
         """
             Constructor.
         """
 
         self.nv = 0
-        self.clauses = []
+        self.clauses = ClauseBuffer() if compact else []
         self.comments = []
 
         if from_file:
@@ -427,7 +887,8 @@ class CNF(object):
         elif from_aiger:
             self.from_aiger(from_aiger)
 
-    def from_file(self, fname, comment_lead=['c'], compressed_with='use_ext'):
+    def from_file(self, fname, comment_lead=['c'], compressed_with='use_ext',
+            solver=None):
         """
             Read a CNF formula from a file in the DIMACS format. A file name is
             expected as an argument. A default argument is ``comment_lead`` for
@@ -437,10 +898,12 @@ class CNF(object):
             :param fname: name of a file to parse.
             :param comment_lead: a list of characters leading comment lines
             :param compressed_with: file compression algorithm
+            :param solver: a SAT solver to load the clauses into
 
             :type fname: str
             :type comment_lead: list(str)
             :type compressed_with: str
+            :type solver: :class:`.Solver`
 
             Note that the ``compressed_with`` parameter can be ``None`` (i.e.
             the file is uncompressed), ``'gzip'``, ``'bzip2'``, ``'lzma'``, or
@@ -449,6 +912,12 @@ class CNF(object):
             Using ``'lzma'`` in Python 2 requires the ``backports.lzma``
             package to be additionally installed.
 
+            The file is parsed natively. Uncompressed files are mapped in
+            memory while compressed ones are decompressed in chunks. If a
+            ``solver`` is given, the clauses are added to it directly, as a
+            flat buffer, and are *not* stored in the formula (see
+            :meth:`from_fp`).
+
             Usage example:
 
             .. code-block:: python
@@ -458,12 +927,22 @@ class CNF(object):
                 >>> cnf1.from_file('some-file.cnf.gz', compressed_with='gzip')
                 >>>
                 >>> cnf2 = CNF(from_file='another-file.cnf')
+                >>>
+                >>> from pysat.solvers import Solver
+                >>> with Solver(name='g4') as solver:
+                ...     cnf3 = CNF()
+                ...     cnf3.from_file('huge-file.cnf.xz', solver=solver)
+                ...     print(cnf3.clauses, solver.solve())
+                [] True
         """
 
-        with FileObject(fname, mode='r', compression=compressed_with) as fobj:
-            self.from_fp(fobj.fp, comment_lead)
+        with FileObject(fname, mode='rb', compression=compressed_with) as fobj:
+            if solver is None:
+                self.from_fp(fobj.fp, comment_lead)
+            else:
+                self.from_fp(fobj.fp, comment_lead, solver=solver)
 
-    def from_fp(self, file_pointer, comment_lead=['c']):
+    def from_fp(self, file_pointer, comment_lead=['c'], solver=None):
         """
             Read a CNF formula from a file pointer. A file pointer should be
             specified as an argument. The only default argument is
@@ -472,9 +951,18 @@ class CNF(object):
 
             :param file_pointer: a file pointer to read the formula from.
             :param comment_lead: a list of characters leading comment lines
+            :param solver: a SAT solver to load the clauses into
 
             :type file_pointer: file pointer
             :type comment_lead: list(str)
+            :type solver: :class:`.Solver`
+
+            The formula is parsed natively, one clause per line. In a compact
+            formula, the clauses go to its :class:`ClauseBuffer` as a flat
+            buffer. If a ``solver`` is given, the clauses are passed to
+            :meth:`.Solver.append_buffer` without creating any Python lists;
+            in this case, only the number of variables and the comments are
+            stored in the formula while its list of clauses stays empty.
 
             Usage example:
 
@@ -488,21 +976,17 @@ class CNF(object):
                 ...     cnf2 = CNF(from_fp=fp)
         """
 
-        self.nv = 0
-        self.clauses = []
-        self.comments = []
-        comment_lead = tuple('p') + tuple(comment_lead)
+        compact = isinstance(self.clauses, ClauseBuffer)
+        res = _parse_dimacs('cnf', file_pointer, comment_lead,
+                flat=solver is not None or compact)
 
-        for line in file_pointer:
-            line = line.strip()
-            if line:
-                if line[0] not in comment_lead:
-                    cl = [int(l) for l in line.split()[:-1]]
-                    self.nv = max([abs(l) for l in cl] + [self.nv])
+        self.nv, self.comments = res[0], res[7]
 
-                    self.clauses.append(cl)
-                elif not line.startswith('p cnf '):
-                    self.comments.append(line)
+        if solver is None:
+            self.clauses = ClauseBuffer(from_buffer=res[2][0]) if compact else res[2]
+        else:
+            self.clauses = []
+            solver.append_buffer(res[2][0])
 
     def from_string(self, string, comment_lead=['c']):
         """
@@ -555,6 +1039,11 @@ class CNF(object):
                 5
         """
 
+        if isinstance(self.clauses, ClauseBuffer):
+            self.clauses = ClauseBuffer(from_clauses=clauses)
+            self.nv = max(self.clauses.nv, self.nv)
+            return
+
         self.clauses = copy.deepcopy(clauses)
 
         for cl in self.clauses:
@@ -618,7 +1107,10 @@ class CNF(object):
         # Use py-aiger-cnf to insulate from internal py-aiger details.
         aig_cnf = aiger_cnf.aig2cnf(aig, fresh=self.vpool.id, force_true=False)
 
-        self.clauses = [list(cls) for cls in aig_cnf.clauses]
+        if isinstance(self.clauses, ClauseBuffer):
+            self.clauses = ClauseBuffer(from_clauses=aig_cnf.clauses)
+        else:
+            self.clauses = [list(cls) for cls in aig_cnf.clauses]
         self.comments = ['c ' + c.strip() for c in aig_cnf.comments]
         self.nv = max(map(abs, itertools.chain(*self.clauses)))
 
@@ -687,7 +1179,7 @@ class CNF(object):
                 >>> cnf.to_file('some-file-name.cnf')  # writing to a file
         """
 
-        with FileObject(fname, mode='w', compression=compress_with) as fobj:
+        with FileObject(fname, mode='wb', compression=compress_with) as fobj:
             self.to_fp(fobj.fp, comments)
 
     def to_fp(self, file_pointer, comments=None):
@@ -715,19 +1207,11 @@ class CNF(object):
                 ...     cnf.to_fp(fp)  # writing to the file pointer
         """
 
-        # saving formula's internal comments
-        for c in self.comments:
-            print(c, file=file_pointer)
-
-        # saving externally specified comments
-        if comments:
-            for c in comments:
-                print(c, file=file_pointer)
+        # internal comments go first, followed by the external ones
+        lines = self.comments + list(comments if comments else [])
+        lines.append('p cnf {0} {1}'.format(self.nv, len(self.clauses)))
 
-        print('p cnf', self.nv, len(self.clauses), file=file_pointer)
-
-        for cl in self.clauses:
-            print(' '.join(str(l) for l in cl), '0', file=file_pointer)
+        _write_dimacs(file_pointer, lines, self.clauses)
 
     def to_alien(self, file_pointer, format='opb', comments=None):
         """
@@ -856,6 +1340,11 @@ class CNF(object):
                 [[-1, 2], [3], [-3, 4], [5, 6]]
         """
 
+        if isinstance(self.clauses, ClauseBuffer):
+            self.clauses.extend(clauses)
+            self.nv = max(self.clauses.nv, self.nv)
+            return
+
         for cl in clauses:
             self.append(cl)
 
@@ -897,7 +1386,7 @@ class CNF(object):
         wcnf.nv = self.nv
         wcnf.hard = []
         wcnf.soft = copy.deepcopy(self.clauses)
-        wcnf.wght = [1 for cl in wcnf.soft]
+        wcnf.wght = [1] * len(wcnf.soft)
         wcnf.topw = len(wcnf.wght) + 1
         wcnf.comments = self.comments[:]
 
@@ -913,7 +1402,8 @@ class CNF(object):
 
             **Note** that the negation of each clause is encoded with one
             auxiliary variable if it is not unit size. Otherwise, no auxiliary
-            variable is introduced.
+            variable is introduced. The negation of a compact formula is
+            compact too.
 
             :param topv: top variable identifier if any.
             :type topv: int
@@ -935,13 +1425,12 @@ class CNF(object):
                 [4, -3]
         """
 
-        negated = CNF()
+        negated = CNF(compact=isinstance(self.clauses, ClauseBuffer))
 
         negated.nv = topv
         if not negated.nv:
             negated.nv = self.nv
 
-        negated.clauses = []
         negated.auxvars = []
 
         for cl in self.clauses:
@@ -978,22 +1467,27 @@ class WCNF(object):
         :param from_fp: a file pointer to read from
         :param from_string: a string storing a CNF formula
         :param comment_lead: a list of characters leading comment lines
+        :param compact: keep the clauses in :class:`ClauseBuffer` objects
 
         :type from_file: str
         :type from_fp: file_pointer
         :type from_string: str
         :type comment_lead: list(str)
+        :type compact: bool
+
+        The weights of the soft clauses are kept in list ``wght`` even if
+        the formula is compact.
     """
 
     def __init__(self, from_file=None, from_fp=None, from_string=None,
-            comment_lead=['c']):
+            comment_lead=['c'], compact=False):
         """
             Constructor.
         """
 
         self.nv = 0
-        self.hard = []
-        self.soft = []
+        self.hard = ClauseBuffer() if compact else []
+        self.soft = ClauseBuffer() if compact else []
         self.wght = []
         self.topw = 1
         self.comments = []
@@ -1038,7 +1532,7 @@ class WCNF(object):
                 >>> cnf2 = WCNF(from_file='another-file.wcnf')
         """
 
-        with FileObject(fname, mode='r', compression=compressed_with) as fobj:
+        with FileObject(fname, mode='rb', compression=compressed_with) as fobj:
             self.from_fp(fobj.fp, comment_lead)
 
     def from_fp(self, file_pointer, comment_lead=['c']):
@@ -1066,42 +1560,16 @@ class WCNF(object):
                 ...     cnf2 = WCNF(from_fp=fp)
         """
 
-        def parse_wght(string):
-            wght = float(string)
-            return int(wght) if wght.is_integer() else decimal.Decimal(string)
-
-        self.nv = 0
-        self.hard = []
-        self.soft = []
-        self.wght = []
-        self.topw = 1
-        self.comments = []
-        comment_lead = tuple('p') + tuple(comment_lead)
+        # integral weights are parsed as integers, the others as decimals;
+        # soft clauses with negative weights are returned separately
+        compact = isinstance(self.hard, ClauseBuffer)
+        self.nv, self.topw, self.hard, self.soft, self.wght, _, negs, \
+                self.comments = _parse_dimacs('wcnf', file_pointer,
+                        comment_lead, flat=compact)
 
-        # soft clauses with negative weights
-        negs = []
-
-        for line in file_pointer:
-            line = line.strip()
-            if line:
-                if line[0] not in comment_lead:
-                    items = line.split()[:-1]
-                    w, cl = parse_wght(items[0]), [int(l) for l in items[1:]]
-                    self.nv = max([abs(l) for l in cl] + [self.nv])
-
-                    if w <= 0:
-                        # this clause has a negative weight
-                        # it will be processed later
-                        negs.append(tuple([cl, -w]))
-                    elif w >= self.topw:
-                        self.hard.append(cl)
-                    else:
-                        self.soft.append(cl)
-                        self.wght.append(w)
-                elif not line.startswith('p wcnf '):
-                    self.comments.append(line)
-                else:  # expecting the preamble
-                    self.topw = parse_wght(line.rsplit(' ', 1)[1])
+        if compact:
+            self.hard = ClauseBuffer(from_buffer=self.hard[0])
+            self.soft = ClauseBuffer(from_buffer=self.soft[0])
 
         # if there is any soft clause with negative weight
         # normalize it, i.e. transform into a set of clauses
@@ -1244,7 +1712,7 @@ class WCNF(object):
                 >>> wcnf.to_file('some-file-name.wcnf')  # writing to a file
         """
 
-        with FileObject(fname, mode='w', compression=compress_with) as fobj:
+        with FileObject(fname, mode='wb', compression=compress_with) as fobj:
             self.to_fp(fobj.fp, comments)
 
     def to_fp(self, file_pointer, comments=None):
@@ -1272,24 +1740,15 @@ class WCNF(object):
                 ...     wcnf.to_fp(fp)  # writing to the file pointer
         """
 
-        # saving formula's internal comments
-        for c in self.comments:
-            print(c, file=file_pointer)
-
-        # saving externally specified comments
-        if comments:
-            for c in comments:
-                print(c, file=file_pointer)
-
-        print('p wcnf', self.nv, len(self.hard) + len(self.soft), self.topw, file=file_pointer)
+        # internal comments go first, followed by the external ones
+        lines = self.comments + list(comments if comments else [])
+        lines.append('p wcnf {0} {1} {2}'.format(self.nv,
+            len(self.hard) + len(self.soft), self.topw))
 
         # soft clauses are dumped first because
         # some tools (e.g. LBX) cannot count them properly
-        for i, cl in enumerate(self.soft):
-            print(self.wght[i], ' '.join(str(l) for l in cl), '0', file=file_pointer)
-
-        for cl in self.hard:
-            print(self.topw, ' '.join(str(l) for l in cl), '0', file=file_pointer)
+        _write_dimacs(file_pointer, lines, self.soft, weights=self.wght)
+        _write_dimacs(file_pointer, [], self.hard, prefix=str(self.topw))
 
     def to_alien(self, file_pointer, format='opb', comments=None):
         """
@@ -1560,7 +2019,7 @@ class CNFPlus(CNF, object):
     """
 
     def __init__(self, from_file=None, from_fp=None, from_string=None,
-            comment_lead=['c']):
+            comment_lead=['c'], compact=False):
         """
             Constructor.
         """
@@ -1570,9 +2029,10 @@ class CNFPlus(CNF, object):
 
         # calling the base class constructor
         super(CNFPlus, self).__init__(from_file=from_file, from_fp=from_fp,
-                from_string=from_string, comment_lead=comment_lead)
+                from_string=from_string, comment_lead=comment_lead,
+                compact=compact)
 
-    def from_fp(self, file_pointer, comment_lead=['c']):
+    def from_fp(self, file_pointer, comment_lead=['c'], solver=None):
         """
             Read a CNF+ formula from a file pointer. A file pointer should be
             specified as an argument. The only default argument is
@@ -1581,9 +2041,16 @@ class CNFPlus(CNF, object):
 
             :param file_pointer: a file pointer to read the formula from.
             :param comment_lead: a list of characters leading comment lines
+            :param solver: a SAT solver to load the formula into
 
             :type file_pointer: file pointer
             :type comment_lead: list(str)
+            :type solver: :class:`.Solver`
+
+            If a ``solver`` is given, the clauses and the cardinality
+            constraints are added to it instead of being stored in the
+            formula, similarly to :meth:`CNF.from_fp`. The solver must
+            support native cardinality constraints.
 
             Usage example:
 
@@ -1597,34 +2064,22 @@ class CNFPlus(CNF, object):
                 ...     cnf2 = CNFPlus(from_fp=fp)
         """
 
-        self.nv = 0
-        self.clauses = []
-        self.atmosts = []
-        self.comments = []
-        comment_lead = tuple('p') + tuple(comment_lead)
+        # AtLeastK constraints are turned into AtMostK by the parser
+        compact = isinstance(self.clauses, ClauseBuffer)
+        res = _parse_dimacs('cnf+', file_pointer, comment_lead,
+                flat=solver is not None or compact)
 
-        for line in file_pointer:
-            line = line.strip()
-            if line:
-                if line[0] not in comment_lead:
-                    if int(line.rsplit(' ', 1)[-1]) == 0:  # normal clause
-                        cl = [int(l) for l in line.split()[:-1]]
-                        self.nv = max([abs(l) for l in cl] + [self.nv])
-
-                        self.clauses.append(cl)
-                    else:  # atmost/atleast constraint
-                        items = [i for i in line.split()]
-                        lits = [int(l) for l in items[:-2]]
-                        rhs = int(items[-1])
-                        self.nv = max([abs(l) for l in lits] + [self.nv])
-
-                        if items[-2][0] == '>':
-                            lits = list(map(lambda l: -l, lits))
-                            rhs = len(lits) - rhs
-
-                        self.atmosts.append([lits, rhs])
-                elif not line.startswith('p cnf'):  # cnf is allowed here
-                    self.comments.append(line)
+        self.nv, self.comments = res[0], res[7]
+
+        if solver is None:
+            self.clauses = ClauseBuffer(from_buffer=res[2][0]) if compact else res[2]
+            self.atmosts = res[5]
+        else:
+            self.clauses, self.atmosts = [], []
+            solver.append_buffer(res[2][0])
+
+            for lits, rhs in res[5]:
+                solver.add_atmost(lits, rhs)
 
     def to_fp(self, file_pointer, comments=None):
         """
@@ -1651,24 +2106,13 @@ class CNFPlus(CNF, object):
                 ...     cnf.to_fp(fp)  # writing to the file pointer
         """
 
-        # saving formula's internal comments
-        for c in self.comments:
-            print(c, file=file_pointer)
-
-        # saving externally specified comments
-        if comments:
-            for c in comments:
-                print(c, file=file_pointer)
-
-        ftype = 'cnf+' if self.atmosts else 'cnf'
-        print('p', ftype, self.nv, len(self.clauses) + len(self.atmosts),
-                file=file_pointer)
-
-        for cl in self.clauses:
-            print(' '.join(str(l) for l in cl), '0', file=file_pointer)
+        # internal comments go first, followed by the external ones
+        lines = self.comments + list(comments if comments else [])
+        lines.append('p {0} {1} {2}'.format('cnf+' if self.atmosts else 'cnf',
+            self.nv, len(self.clauses) + len(self.atmosts)))
 
-        for am in self.atmosts:
-            print(' '.join(str(l) for l in am[0]), '<=', am[1], file=file_pointer)
+        _write_dimacs(file_pointer, lines, self.clauses)
+        _write_dimacs(file_pointer, [], self.atmosts, cardinal=True)
 
     def to_alien(self, file_pointer, format='opb', comments=None):
         """
@@ -1902,7 +2346,7 @@ class CNFPlus(CNF, object):
         wcnf.hard = []
         wcnf.soft = copy.deepcopy(self.clauses)
         wcnf.atms = copy.deepcopy(self.atmosts)
-        wcnf.wght = [1 for cl in wcnf.soft]
+        wcnf.wght = [1] * len(wcnf.soft)
         wcnf.topw = len(wcnf.wght) + 1
         wcnf.comments = self.comments[:]
 
@@ -1993,7 +2437,8 @@ class WCNFPlus(WCNF, object):
         For details on the functionality, see :class:`WCNF`.
     """
 
-    def __init__(self, from_file=None, from_fp=None, from_string=None, comment_lead=['c']):
+    def __init__(self, from_file=None, from_fp=None, from_string=None,
+            comment_lead=['c'], compact=False):
         """
             Constructor.
         """
@@ -2003,7 +2448,8 @@ class WCNFPlus(WCNF, object):
 
         # calling the base class constructor
         super(WCNFPlus, self).__init__(from_file=from_file, from_fp=from_fp,
-                from_string=from_string, comment_lead=comment_lead)
+                from_string=from_string, comment_lead=comment_lead,
+                compact=compact)
 
     def from_fp(self, file_pointer, comment_lead=['c']):
         """
@@ -2030,52 +2476,18 @@ class WCNFPlus(WCNF, object):
                 ...     cnf2 = WCNFPlus(from_fp=fp)
         """
 
-        def parse_wght(string):
-            wght = float(string)
-            return int(wght) if wght.is_integer() else decimal.Decimal(string)
+        compact = isinstance(self.hard, ClauseBuffer)
+        self.nv, self.topw, self.hard, self.soft, self.wght, self.atms, \
+                negs, self.comments = _parse_dimacs('wcnf+', file_pointer,
+                        comment_lead, flat=compact)
 
-        self.nv = 0
-        self.hard = []
-        self.atms = []
-        self.soft = []
-        self.wght = []
-        self.topw = 1
-        self.comments = []
-        comment_lead = tuple('p') + tuple(comment_lead)
+        if compact:
+            self.hard = ClauseBuffer(from_buffer=self.hard[0])
+            self.soft = ClauseBuffer(from_buffer=self.soft[0])
 
-        for line in file_pointer:
-            line = line.strip()
-            if line:
-                if line[0] not in comment_lead:
-                    if int(line.rsplit(' ', 1)[-1]) == 0:  # normal clause
-                        items = line.split()[:-1]
-                        w, cl = parse_wght(items[0]), [int(l) for l in items[1:]]
-                        self.nv = max([abs(l) for l in cl] + [self.nv])
-
-                        if w <= 0:
-                            # this clause has a negative weight
-                            # it will be processed later
-                            negs.append(tuple([cl, -w]))
-                        elif w >= self.topw:
-                            self.hard.append(cl)
-                        else:
-                            self.soft.append(cl)
-                            self.wght.append(w)
-                    else:  # atmost/atleast constraint
-                        items = [i for i in line.split()]
-                        lits = [int(l) for l in items[1:-2]]
-                        rhs = int(items[-1])
-                        self.nv = max([abs(l) for l in lits] + [self.nv])
-
-                        if items[-2][0] == '>':
-                            lits = list(map(lambda l: -l, lits))
-                            rhs = len(lits) - rhs
-
-                        self.atms.append([lits, rhs])
-                elif not line.startswith('p wcnf'):  # wcnf is allowed here
-                    self.comments.append(line)
-                else:  # expecting the preamble
-                    self.topw = parse_wght(line.rsplit(' ', 1)[1])
+        # soft clauses with negative weights are normalized as in WCNF
+        if negs:
+            self.normalize_negatives(negs)
 
     def to_fp(self, file_pointer, comments=None):
         """
@@ -2102,30 +2514,20 @@ class WCNFPlus(WCNF, object):
                 ...     cnf.to_fp(fp)  # writing to the file pointer
         """
 
-        # saving formula's internal comments
-        for c in self.comments:
-            print(c, file=file_pointer)
-
-        # saving externally specified comments
-        if comments:
-            for c in comments:
-                print(c, file=file_pointer)
-
-        ftype = 'wcnf+' if self.atms else 'wcnf'
-        print('p', ftype, self.nv, len(self.hard) + len(self.soft) + len(self.atms),
-                self.topw, file=file_pointer)
+        # internal comments go first, followed by the external ones
+        lines = self.comments + list(comments if comments else [])
+        lines.append('p {0} {1} {2} {3}'.format('wcnf+' if self.atms else 'wcnf',
+            self.nv, len(self.hard) + len(self.soft) + len(self.atms),
+            self.topw))
 
         # soft clauses are dumped first because
         # some tools (e.g. LBX) cannot count them properly
-        for i, cl in enumerate(self.soft):
-            print(self.wght[i], ' '.join(str(l) for l in cl), '0', file=file_pointer)
-
-        for cl in self.hard:
-            print(self.topw, ' '.join(str(l) for l in cl), '0', file=file_pointer)
+        _write_dimacs(file_pointer, lines, self.soft, weights=self.wght)
+        _write_dimacs(file_pointer, [], self.hard, prefix=str(self.topw))
 
         # atmost constraints are hard
-        for am in self.atms:
-            print(self.topw, ' '.join(str(l) for l in am[0]), '<=', am[1], file=file_pointer)
+        _write_dimacs(file_pointer, [], self.atms, prefix=str(self.topw),
+                cardinal=True)
 
     def to_alien(self, file_pointer, format='opb', comments=None):
         """
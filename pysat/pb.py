@@ -25,19 +25,23 @@
 
     .. note::
 
-        Functionality of this module is available only if the `PyPBLib`
+        The BDD, sequential weight counter, adder, and generalized
+        totalizer encodings are implemented natively, in the :mod:`pycard`
+        extension. The other encodings are available only if the `PyPBLib`
         package is installed, e.g. from PyPI:
 
         .. code-block::
 
             $ pip install pypblib
 
-    This module provides access to the basic functionality of the `PyPBLib
-    library <https://pypi.org/project/pypblib/>`__ developed by the `Logic
-    Optimization Group <http://ulog.udl.cat/>`__ of the University of Lleida.
-    PyPBLib provides a user with an extensive Python API to the well-known
-    `PBLib library <http://tools.computational-logic.org/content/pblib.php>`__
-    [1]_. Note the PyPBLib has a number of `additional features
+    This module provides access to native implementations of a few
+    pseudo-Boolean encodings as well as to the basic functionality of the
+    `PyPBLib library <https://pypi.org/project/pypblib/>`__ developed by the
+    `Logic Optimization Group <http://ulog.udl.cat/>`__ of the University of
+    Lleida. PyPBLib provides a user with an extensive Python API to the
+    well-known `PBLib library
+    <http://tools.computational-logic.org/content/pblib.php>`__ [1]_. Note the
+    PyPBLib has a number of `additional features
     <http://hardlog.udl.cat/static/doc/pypblib/html/index.html>`__ that cannot
     be accessed through PySAT *at this point*. (One concrete example is a
     range of cardinality encodings, which clash with the internal
@@ -56,7 +60,8 @@
     applications. Thus, several *encodings* of pseudo-Boolean constraints into
     CNF formulas are known [2]_. The list of pseudo-Boolean encodings
     supported by this module include BDD [3]_ [4]_, sequential weight counters
-    [5]_, sorting networks [3]_, adder networks [3]_, and binary merge [6]_.
+    [5]_, sorting networks [3]_, adder networks [3]_, binary merge [6]_, and
+    generalized totalizer [7]_.
     Access to all cardinality encodings can be made through the main class of
     this module, which is :class:`.PBEnc`.
 
@@ -79,6 +84,10 @@
         Translation of Pseudo-Boolean Constraints into CNF Such That
         Generalized Arc Consistency Is Maintained*. KI. 2014. pp. 123-134
 
+    .. [7] Saurabh Joshi, Ruben Martins, Vasco M. Manquinho. *Generalized
+        Totalizer Encoding for Pseudo-Boolean Constraints*. CP. 2015.
+        pp. 200-209
+
     ==============
     Module details
     ==============
@@ -87,7 +96,9 @@
 #
 #==============================================================================
 import math
+from pysat._utils import MainThread
 from pysat.formula import CNF
+import pycard
 
 # checking whether or not pypblib is available and working as expected
 pblib_present = True
@@ -123,6 +134,7 @@ class EncType(object):
             sortnetwrk = 3
             adder      = 4
             binmerge   = 5
+            gtotalizer = 6
 
         The desired encoding can be selected either directly by its integer
         identifier, e.g. ``2``, or by its alphabetical name, e.g.
@@ -132,8 +144,11 @@ class EncType(object):
         the :class:`pysat.formula.CNF` format.
 
         Note that the encoding type can be set to ``best``, in which case the
-        encoder selects one of the other encodings from the list (in most
-        cases, this invokes the ``bdd`` encoder).
+        encoder selects one of the other encodings from the list (currently,
+        this invokes the ``bdd`` encoder).
+
+        The ``bdd``, ``seqcounter``, ``adder``, and ``gtotalizer`` encodings
+        are native, while ``sortnetwrk`` and ``binmerge`` require PyPBLib.
     """
 
     best       = 0
@@ -142,23 +157,28 @@ class EncType(object):
     sortnetwrk = 3
     adder      = 4
     binmerge   = 5
+    gtotalizer = 6
+
+    # encodings that are not implemented natively
+    _pblib = set([sortnetwrk, binmerge])
 
     # mapping from internal encoding identifiers to the ones of PyPBLib
-    _to_pbenc = {
-            best:       pblib.PB_BEST,
-            bdd:        pblib.PB_BDD,
-            seqcounter: pblib.PB_SWC,
-            sortnetwrk: pblib.PB_SORTINGNETWORKS,
-            adder:      pblib.PB_ADDER,
-            binmerge:   pblib.PB_BINARY_MERGE
-        }
+    if pblib_present:
+        _to_pbenc = {
+                sortnetwrk: pblib.PB_SORTINGNETWORKS,
+                binmerge:   pblib.PB_BINARY_MERGE
+            }
 
     # mapping from internal comparator identifiers to the ones of PyPBLib
-    _to_pbcmp = {
-            '<': pblib.LEQ,
-            '>': pblib.GEQ,
-            '=': pblib.BOTH
-        }
+    if pblib_present:
+        _to_pbcmp = {
+                '<': pblib.LEQ,
+                '>': pblib.GEQ,
+                '=': pblib.BOTH
+            }
+
+    # mapping from comparator identifiers to the ones of pycard
+    _to_natcmp = {'<': 0, '>': 1, '=': 2}
 
 
 #
@@ -183,10 +203,10 @@ class PBEnc(object):
             >>> from pysat.pb import *
             >>> cnf = PBEnc.atmost(lits=[1, 2, 3], weights=[1, 2, 3], bound=3)
             >>> print(cnf.clauses)
-            [[4], [-1, -5], [-2, -5], [5, -3, -6], [6]]
+            [[-4, -1], [-5, 4], [-5, -2], [-6, -3, 5], [6]]
             >>> cnf = PBEnc.equals(lits=[1, 2, 3], weights=[1, 2, 3], bound=3, encoding=EncType.bdd)
             >>> print(cnf.clauses)
-            [[4], [-5, -2], [-5, 2, -1], [-5, -1], [-6, 1], [-7, -2, 6], [-7, 2], [-7, 6], [-8, -3, 5], [-8, 3, 7], [-8, 5, 7], [8]]
+            [[-4, -1], [-5, 4], [-5, -2], [-6, -3, 5], [6], [-7, 1], [-8, 7], [-8, 2], [-9, 3, 8], [9]]
     """
 
     @classmethod
@@ -228,10 +248,10 @@ class PBEnc(object):
     def _encode(cls, lits, weights=None, bound=1, top_id=None, vpool=None,
             encoding=EncType.best, comparator='<'):
         """
-            This is the method that wraps the encoder of PyPBLib. Although the
-            method can be invoked directly, a user is expected to call one of
-            the following methods instead: :meth:`atmost`, :meth:`atleast`, or
-            :meth:`equals`.
+            This is the method that wraps the native encoders and the encoder
+            of PyPBLib. Although the method can be invoked directly, a user is
+            expected to call one of the following methods instead:
+            :meth:`atmost`, :meth:`atleast`, or :meth:`equals`.
 
             The list of literals can contain either integers or pairs ``(l,
             w)``, where ``l`` is an integer literal and ``w`` is an integer
@@ -257,9 +277,7 @@ class PBEnc(object):
             :rtype: :class:`pysat.formula.CNF`
         """
 
-        assert pblib_present, 'Package \'pypblib\' is unavailable. Check your installation.'
-
-        if encoding < 0 or encoding > 5:
+        if encoding < 0 or encoding > 6:
             raise(NoSuchEncodingError(encoding))
 
         assert lits, 'No literals are provided.'
@@ -270,15 +288,15 @@ class PBEnc(object):
         # preparing weighted literals
         if weights:
             assert len(lits) == len(weights), 'Same number of literals and weights is expected.'
-            wlits = [pblib.WeightedLit(l, w) for l, w in zip(lits, weights)]
+            lits, weights = list(lits), list(weights)
         else:
             if all(map(lambda lw: (type(lw) in (list, tuple)) and len(lw) == 2, lits)):
                 # literals are already weighted
-                wlits = [pblib.WeightedLit(*wl) for wl in lits]
-                lits = zip(*lits)[0]  # unweighted literals for getting top_id
+                weights = [wl[1] for wl in lits]
+                lits = [wl[0] for wl in lits]
             elif all(map(lambda l: type(l) is int, lits)):
                 # no weights are provided => all weights are units
-                wlits = [pblib.WeightedLit(l, 1) for l in lits]
+                lits, weights = list(lits), [1 for l in lits]
             else:
                 assert 0, 'Incorrect literals given.'
 
@@ -289,6 +307,42 @@ class PBEnc(object):
         if not top_id:
             top_id = max(map(lambda x: abs(x), lits))
 
+        if encoding in EncType._pblib:
+            ret = cls._encode_pblib(lits, weights, bound, top_id, encoding,
+                    comparator)
+        else:
+            res = pycard.encode_pb(lits, weights, bound,
+                    EncType._to_natcmp[comparator], top_id, encoding,
+                    int(MainThread.check()))
+
+            # the constraint is trivially satisfied if no clauses are returned
+            ret = CNF(from_clauses=res[0] if res else [])
+            if res:
+                ret.nv = max(ret.nv, res[1])
+
+        # updating vpool if necessary
+        if vpool and ret.nv > vpool.top:
+            if vpool._occupied and vpool.top <= vpool._occupied[0][0] <= ret.nv:
+                cls._update_vids(ret, vpool)
+            else:
+                vpool.top = ret.nv - 1
+                vpool._next()
+
+        return ret
+
+    @classmethod
+    def _encode_pblib(cls, lits, weights, bound, top_id, encoding,
+            comparator):
+        """
+            Encode a constraint with PyPBLib. This is used for the encodings
+            that are not implemented natively, i.e. sorting networks and
+            binary merge.
+        """
+
+        assert pblib_present, 'Package \'pypblib\' is unavailable. Check your installation.'
+
+        wlits = [pblib.WeightedLit(l, w) for l, w in zip(lits, weights)]
+
         # pseudo-Boolean constraint and variable manager
         constr = pblib.PBConstraint(wlits, EncType._to_pbcmp[comparator], bound)
         varmgr = pblib.AuxVarManager(top_id + 1)
@@ -303,17 +357,7 @@ class PBEnc(object):
         pb2cnf.encode(constr, result, varmgr)
 
         # extracting clauses
-        ret = CNF(from_clauses=result.get_clauses())
-
-        # updating vpool if necessary
-        if vpool:
-            if vpool._occupied and vpool.top <= vpool._occupied[0][0] <= ret.nv:
-                cls._update_vids(ret, vpool)
-            else:
-                vpool.top = ret.nv - 1
-                vpool._next()
-
-        return ret
+        return CNF(from_clauses=result.get_clauses())
 
     @classmethod
     def leq(cls, lits, weights=None, bound=1, top_id=None, vpool=None,
@@ -329,7 +373,7 @@ class PBEnc(object):
             integer weight. The latter can be done only if no ``weights`` are
             specified separately. The type of encoding to use can be specified
             using the ``encoding`` parameter. By default, it is set to
-            ``EncType.best``, i.e. it is up to the PBLib encoder to choose the
+            ``EncType.best``, i.e. it is up to the encoder to choose the
             encoding type.
 
             :param lits: a list of literals in the sum.
@@ -17,6 +17,8 @@
         :nosignatures:
 
         SolverNames
+        ClauseExchange
+        SolveFuture
         Solver
         Cadical
         Gluecard3
@@ -31,6 +33,7 @@
         Minicard
         Minisat22
         MinisatGH
+        Portfolio
 
     ==================
     Module description
@@ -58,6 +61,16 @@
     -  Gluecard3
     -  Gluecard4
 
+    Finally, several of the above solvers can be raced against each other on
+    the same formula by :class:`Portfolio`, each of them running in its own
+    native thread.
+    Alternatively, several instances of :class:`Glucose3`, :class:`Glucose4`,
+    :class:`MapleChrono`, and :class:`Minisat22` solving the same formula in
+    concurrent threads can cooperate by sharing their learnt clauses through
+    a :class:`ClauseExchange` pool. The same solvers can also report their
+    progress and the clauses they learn to Python callbacks, see
+    :meth:`Solver.report_progress` and :meth:`Solver.export_learnts`.
+
     All solvers can be accessed through a unified MiniSat-like [1]_ incremental
     [2]_ interface described below.
 
@@ -153,16 +166,61 @@
 #
 #==============================================================================
 from pysat._utils import MainThread
-from pysat.formula import CNFPlus
+from pysat.formula import ClauseBuffer, CNFPlus
 import pysolvers
 import signal
 import tempfile
+import threading
 
 try:  # for Python < 3.8
     from time import clock as process_time
 except ImportError:  # for Python >= 3.8
     from time import process_time
 
+try:  # for Python >= 3.3
+    from time import perf_counter
+except ImportError:  # for Python < 3.3
+    from time import time as perf_counter
+
+
+#
+#==============================================================================
+def _flat_formula(formula):
+    """
+        Split a formula whose clauses are kept in a :class:`.ClauseBuffer`
+        into the flat buffer of its clauses and the rest of it, i.e. the
+        AtMostK constraints of a CNF+ formula, to be added one by one. Any
+        other formula is returned as it is, with no buffer.
+    """
+
+    if isinstance(formula, ClauseBuffer):
+        return formula.buffer(), []
+
+    if isinstance(getattr(formula, 'clauses', None), ClauseBuffer):
+        return formula.clauses.buffer(), getattr(formula, 'atmosts', [])
+
+    return None, formula
+
+
+#
+#==============================================================================
+def _learnts_callback(callback):
+    """
+        Wrap a callback of :meth:`Solver.export_learnts` so that it gets
+        the batches of learnt clauses as :class:`.ClauseBuffer` objects
+        rather than as flat zero-terminated buffers.
+    """
+
+    if callback is None:
+        return None
+
+    def wrapper(lits):
+        clauses = ClauseBuffer()
+        clauses.append_buffer(lits)
+        callback(clauses)
+
+    return wrapper
+
 
 #
 #==============================================================================
@@ -202,6 +260,7 @@ class SolverNames(object):
             minicard    = ('mc', 'mcard', 'minicard')
             minisat22   = ('m22', 'msat22', 'minisat22')
             minisatgh   = ('mgh', 'msat-gh', 'minisat-gh')
+            portfolio   = ('pf', 'portfolio')
 
         As a result, in order to select Glucose3, a user can specify the
         solver's name: either ``'g3'``, ``'g30'``, ``'glucose3'``, or
@@ -222,6 +281,208 @@ class SolverNames(object):
     minicard    = ('mc', 'mcard', 'minicard')
     minisat22   = ('m22', 'msat22', 'minisat22')
     minisatgh   = ('mgh', 'msat-gh', 'minisat-gh')
+    portfolio   = ('pf', 'portfolio')
+
+
+#
+#==============================================================================
+class ClauseExchange(object):
+    """
+        A pool of learnt clauses to be shared by several solvers running
+        concurrently, see :meth:`Solver.share_clauses`. The pool is a
+        lock-free ring buffer holding up to ``capacity`` clauses of at most
+        ``max_size`` literals each, where the oldest clauses are overwritten
+        by the new ones. Longer clauses are not shared. The pool is freed
+        once the object and all the solvers connected to it are deleted.
+
+        :param capacity: the number of clauses kept in the pool
+        :param max_size: the largest size of a clause to share
+
+        :type capacity: int
+        :type max_size: int
+    """
+
+    def __init__(self, capacity=4096, max_size=30):
+        """
+            Constructor.
+        """
+
+        self.pool = pysolvers.exchange_new(capacity, max_size)
+
+
+#
+#==============================================================================
+class SolveFuture(object):
+    """
+        A handle of a SAT call running in a background thread, as returned
+        by :meth:`Solver.solve_async`. The call is made with
+        :meth:`Solver.solve_limited` and can be cancelled with
+        :meth:`cancel`, which interrupts the solver. The handle is also
+        *awaitable* in :mod:`asyncio` coroutines, where cancelling the
+        awaiting task cancels the call.
+    """
+
+    def __init__(self, solver, assumptions):
+        """
+            Constructor starting the call.
+        """
+
+        self.solver = solver
+        self.status = None
+        self.error = None
+        self.cancelled = False
+        self.callbacks = []
+
+        self.lock = threading.Lock()
+        self.event = threading.Event()
+
+        # the interrupt flag may be left raised by a previous call
+        self.solver.clear_interrupt()
+
+        self.thread = threading.Thread(target=self._run, args=(assumptions, ))
+        self.thread.daemon = True
+        self.thread.start()
+
+    def _run(self, assumptions):
+        """
+            Make the call and record its outcome.
+        """
+
+        try:
+            status = self.solver.solve_limited(assumptions,
+                    expect_interrupt=True)
+            error = None
+        except Exception as e:
+            status, error = None, e
+
+        with self.lock:
+            self.status, self.error = status, error
+
+            # no interrupt can come from cancel() from now on
+            self.solver.clear_interrupt()
+            self.event.set()
+
+            callbacks, self.callbacks = self.callbacks, []
+
+        for callback in callbacks:
+            callback(self)
+
+    def done(self):
+        """
+            Check whether the call is over.
+
+            :rtype: bool
+        """
+
+        return self.event.is_set()
+
+    def poll(self):
+        """
+            Get the result of the call if it is over, without blocking.
+            ``None`` is returned otherwise (as well as if the call was
+            cancelled or interrupted).
+
+            :rtype: Boolean or ``None``.
+        """
+
+        return self.status if self.event.is_set() else None
+
+    def wait(self, timeout=None):
+        """
+            Wait for the call to finish for at most ``timeout`` seconds (or
+            for as long as it takes if ``timeout`` is ``None``) and report
+            whether it is over.
+
+            :param timeout: the number of seconds to wait
+            :type timeout: float
+
+            :rtype: bool
+        """
+
+        self.event.wait(timeout)
+        return self.event.is_set()
+
+    def result(self, timeout=None):
+        """
+            Wait for the call to finish (see :meth:`wait`) and return its
+            result, i.e. ``True``, ``False``, or ``None`` if the call was
+            cancelled or interrupted otherwise. An exception raised by the
+            call is raised again here.
+
+            :param timeout: the number of seconds to wait
+            :type timeout: float
+
+            :rtype: Boolean or ``None``.
+
+            :raises RuntimeError: if the call is still running after
+                ``timeout`` seconds.
+        """
+
+        if not self.wait(timeout):
+            raise RuntimeError('The SAT call is still running')
+
+        if self.error is not None:
+            raise self.error
+
+        return self.status
+
+    def cancel(self):
+        """
+            Interrupt the call unless it is already over. The call then
+            returns ``None`` shortly.
+
+            :rtype: bool (whether the call was running)
+        """
+
+        with self.lock:
+            if self.event.is_set():
+                return False
+
+            self.cancelled = True
+            self.solver.interrupt()
+            return True
+
+    def add_done_callback(self, callback):
+        """
+            Register a function to be called with the handle once the call
+            is over. The function is called by the thread of the call or
+            immediately if the call is already over.
+
+            :param callback: a function of one argument
+        """
+
+        with self.lock:
+            if not self.event.is_set():
+                self.callbacks.append(callback)
+                return
+
+        callback(self)
+
+    def __await__(self):
+        """
+            Wait for the call in the running :mod:`asyncio` event loop.
+        """
+
+        import asyncio
+
+        loop = asyncio.get_event_loop()
+        future = loop.create_future()
+
+        def settle():
+            if not future.done():
+                if self.error is not None:
+                    future.set_exception(self.error)
+                else:
+                    future.set_result(self.status)
+
+        def on_cancel(f):
+            if f.cancelled():
+                self.cancel()
+
+        future.add_done_callback(on_cancel)
+        self.add_done_callback(lambda h: loop.call_soon_threadsafe(settle))
+
+        return future.__await__()
 
 
 #
@@ -318,6 +579,45 @@ class Solver(object):
         .. [3] Gilles Audemard, Jean-Marie Lagniez, Laurent Simon. *Improving
             Glucose for Incremental SAT Solving with Assumptions: Application
             to MUS Extraction*. SAT 2013. pp. 309-317
+
+        :class:`Minisat22` can be created with ``simplify=True`` (``False``
+        by default), in which case the formula is preprocessed by the
+        subsumption and bounded variable elimination of MiniSat's
+        ``SimpSolver`` at the beginning of every SAT call. The variables
+        to be used by the clauses and assumptions given to the solver
+        afterwards must be protected from elimination with
+        :meth:`freeze`, while the models are extended to the eliminated
+        variables automatically (see :meth:`eliminate`). A simplifying
+        solver can neither be cloned nor share its learnt clauses.
+
+        :param simplify: enable variable elimination (MiniSat 2.2 only).
+        :type simplify: bool
+
+        A portfolio of solvers (see :class:`Portfolio`) can be created by
+        setting ``name='portfolio'``. The solvers to race are specified by the
+        ``solvers`` argument, which is a list of solver names (by default,
+        ``['g4', 'mcb', 'cd', 'lgl']``). Every clause is added to each of the
+        solvers. A SAT call runs all of them on native threads and returns the
+        answer of the first solver to finish, the others being interrupted.
+        The model, unsatisfiable core, and statistics reported afterwards are
+        those of the winner:
+
+        :param solvers: names of the solvers to race.
+        :type solvers: list(str)
+
+        .. code-block:: python
+
+            >>> from pysat.solvers import Solver
+            >>> from pysat.examples.genhard import PHP
+            >>>
+            >>> cnf = PHP(nof_holes=6)
+            >>>
+            >>> with Solver(name='portfolio', bootstrap_with=cnf.clauses,
+            ...         solvers=['g4', 'cd', 'lgl']) as s:
+            ...     s.solve()
+            False
+            ...     type(s.solver.get_winner())
+            <class 'pysat.solvers.Cadical'>
     """
 
     def __init__(self, name='m22', bootstrap_with=None, use_timer=False, **kwargs):
@@ -355,7 +655,7 @@ class Solver(object):
         """
 
         # checking keyword arguments
-        kwallowed = set(['incr', 'with_proof'])
+        kwallowed = set(['incr', 'with_proof', 'simplify', 'solvers'])
         for a in kwargs:
             if a not in kwallowed:
                 raise TypeError('Unexpected keyword argument \'{0}\''.format(a))
@@ -385,9 +685,12 @@ class Solver(object):
             elif name_ in SolverNames.minicard:
                 self.solver = Minicard(bootstrap_with, use_timer)
             elif name_ in SolverNames.minisat22:
-                self.solver = Minisat22(bootstrap_with, use_timer)
+                self.solver = Minisat22(bootstrap_with, use_timer,
+                        kwargs.get('simplify', False))
             elif name_ in SolverNames.minisatgh:
                 self.solver = MinisatGH(bootstrap_with, use_timer)
+            elif name_ in SolverNames.portfolio:
+                self.solver = Portfolio(bootstrap_with, use_timer, **kwargs)
             else:
                 raise(NoSuchSolverError(name))
 
@@ -401,6 +704,283 @@ class Solver(object):
             self.solver.delete()
             self.solver = None
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object, which can then be used (and
+            must be deleted) independently of the original one. Unlike
+            adding the formula to another solver from scratch, cloning
+            copies the clause database in native code at once. The clone
+            gets the variables, the top-level units, and the problem clauses
+            (including cardinality constraints) of the original solver. If
+            ``warm`` is set to ``True``, the learnt clauses, the variable
+            activities, and the saved phases are copied as well, and so the
+            clone resumes the search where the original left it.
+
+            Cloning is supported by CaDiCaL (which copies its irredundant
+            clauses only, regardless of ``warm``) and by the MiniSat-like
+            solvers, namely :class:`Gluecard3`, :class:`Gluecard4`,
+            :class:`Glucose3`, :class:`Glucose4`, :class:`Minicard`,
+            :class:`Minisat22`, and :class:`MinisatGH`. Neither assumptions
+            nor proof tracing are copied.
+
+            :param warm: whether or not to copy the learnt clauses and the
+                heuristic state
+            :type warm: bool
+
+            :rtype: :class:`Solver`
+
+            :raises NotImplementedError: if the solver does not support
+                cloning.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> with Solver(name='g4', bootstrap_with=[[-1, 2], [-2, 3]]) as s:
+                ...     with s.clone() as c:
+                ...         c.add_clause([1])
+                ...         c.add_clause([-3])
+                ...         print(c.solve(), s.solve())
+                False True
+        """
+
+        if self.solver:
+            solver = Solver.__new__(Solver)
+            solver.solver = self.solver.clone(warm)
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Connect the solver to a pool of learnt clauses (see
+            :class:`ClauseExchange`) shared with other solvers, or
+            disconnect it from its current pool if ``exchange`` is ``None``.
+            While connected, the solver exports each clause it learns whose
+            LBD does not exceed ``max_lbd`` and whose size does not exceed
+            the pool's ``max_size``, and it imports the clauses exported by
+            the other solvers at every restart. This makes sense when the
+            solvers are run in concurrent threads (each of their ``solve()``
+            calls releases the GIL) on the same formula.
+
+            Note that all the clauses exported to a pool are assumed to hold
+            in every solver connected to it, i.e. the solvers must be given
+            the same formula, possibly over fewer variables (the clauses on
+            unknown variables are ignored). Also, the sharing is best-effort:
+            a clause can be lost if the pool is written to faster than it is
+            read.
+
+            Clause sharing is supported by :class:`Glucose3`,
+            :class:`Glucose4`, :class:`MapleChrono`, and :class:`Minisat22`,
+            unless they trace a proof.
+
+            :param exchange: a pool of clauses or ``None``
+            :param max_lbd: the largest LBD of the clauses to export
+
+            :type exchange: :class:`ClauseExchange`
+            :type max_lbd: int
+
+            :raises NotImplementedError: if the solver does not support
+                clause sharing.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from threading import Thread
+                >>> from pysat.examples.genhard import PHP
+                >>> from pysat.solvers import ClauseExchange, Solver
+                >>>
+                >>> cnf = PHP(nof_holes=7)
+                >>> pool = ClauseExchange()
+                >>> solvers = [Solver(name=n, bootstrap_with=cnf) for n in ('g3', 'g4', 'm22')]
+                >>> for s in solvers:
+                ...     s.share_clauses(pool)
+                >>>
+                >>> threads = [Thread(target=s.solve) for s in solvers]
+                >>> for t in threads:
+                ...     t.start()
+                >>> for t in threads:
+                ...     t.join()
+                >>>
+                >>> print([s.get_status() for s in solvers])
+                [False, False, False]
+                >>> for s in solvers:
+                ...     s.delete()
+        """
+
+        if self.solver:
+            self.solver.share_clauses(exchange, max_lbd)
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass the clauses learnt by the solver whose size does not exceed
+            ``max_size`` and whose LBD does not exceed ``max_lbd`` to a
+            callback, or stop doing so if ``callback`` is ``None``. The
+            clauses are collected natively and handed over in batches of
+            ``batch`` clauses, each as a :class:`.ClauseBuffer`, and so the
+            solver re-enters Python once per batch only. The last batch of a
+            call to the solver is delivered when the call returns. (MiniSat
+            has no LBD and the size of a clause is used as its LBD instead.)
+
+            If the callback raises an exception, the solver is stopped and
+            the exception is raised by the method that ran it, e.g.
+            :meth:`solve`. The callback is invoked in the thread running the
+            solver.
+
+            Learnt clause export is supported by :class:`Glucose3`,
+            :class:`Glucose4`, :class:`MapleChrono`, and :class:`Minisat22`.
+
+            :param callback: a function of one argument or ``None``
+            :param max_size: the largest size of the clauses to export
+            :param max_lbd: the largest LBD of the clauses to export
+            :param batch: the number of clauses in a batch
+
+            :type callback: callable
+            :type max_size: int
+            :type max_lbd: int
+            :type batch: int
+
+            :raises NotImplementedError: if the solver does not support
+                learnt clause export.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.examples.genhard import PHP
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> learnts = []
+                >>> with Solver(name='g3', bootstrap_with=PHP(nof_holes=6)) as s:
+                ...     s.export_learnts(learnts.extend, max_size=5, batch=100)
+                ...     s.solve()
+                ...
+                False
+                >>> print(all(len(cl) <= 5 for cl in learnts))
+                True
+        """
+
+        if self.solver:
+            self.solver.export_learnts(callback, max_size, max_lbd, batch)
+
+    def report_progress(self, callback, every=1000):
+        """
+            Call a function every ``every`` conflicts while the solver is
+            running, or stop doing so if ``callback`` is ``None``. The
+            function gets the same dictionary as returned by
+            :meth:`accum_stats`. The progress is counted natively and so the
+            solver re-enters Python only once per report.
+
+            As with :meth:`export_learnts`, an exception raised by the
+            callback stops the solver and it is raised by the method that
+            ran the solver. This can be used to stop the solver on a
+            condition evaluated in Python.
+
+            Progress reports are supported by :class:`Glucose3`,
+            :class:`Glucose4`, :class:`MapleChrono`, and :class:`Minisat22`.
+
+            :param callback: a function of one argument or ``None``
+            :param every: the number of conflicts between two reports
+
+            :type callback: callable
+            :type every: int
+
+            :raises NotImplementedError: if the solver does not support
+                progress reports.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.examples.genhard import PHP
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> reports = []
+                >>> with Solver(name='m22', bootstrap_with=PHP(nof_holes=7)) as s:
+                ...     s.report_progress(reports.append, every=500)
+                ...     s.solve()
+                ...     print(len(reports) == s.accum_stats()['conflicts'] // 500)
+                ...
+                False
+                True
+        """
+
+        if self.solver:
+            self.solver.report_progress(callback, every)
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect the given variables from variable elimination, or expose
+            them to it again if ``frozen`` is set to ``False``. This is only
+            meaningful for a solver created with ``simplify=True`` (see
+            :class:`Solver`). A variable must be frozen (before it is
+            eliminated) if it is going to be mentioned by the clauses or
+            the assumptions given to the solver later on, since an
+            eliminated variable cannot be brought back. The assumptions of
+            a SAT call are protected during the call automatically.
+
+            Variable elimination is supported by :class:`Minisat22` only.
+
+            :param variables: a list of variables
+            :param frozen: whether to protect the variables or expose them
+
+            :type variables: iterable(int)
+            :type frozen: bool
+
+            :raises NotImplementedError: if the solver does not support
+                variable elimination.
+        """
+
+        if self.solver:
+            self.solver.freeze(variables, frozen)
+
+    def eliminate(self, turn_off=False):
+        """
+            Simplify the formula by subsumption and bounded variable
+            elimination, which a solver created with ``simplify=True`` also
+            does at the beginning of every SAT call. The return value is
+            ``False`` if the formula is found unsatisfiable and ``True``
+            otherwise. If ``turn_off`` is ``True``, simplification is
+            disabled for good afterwards, and so the variables that have
+            not been eliminated by then can be used freely.
+
+            The models returned by :meth:`get_model` are extended to the
+            eliminated variables and so they satisfy the original formula.
+            Clauses and assumptions mentioning an eliminated variable are
+            refused with an error, and so the variables to be used later
+            must be frozen (see :meth:`freeze`) before they are eliminated.
+
+            :param turn_off: whether or not to disable further simplification
+            :type turn_off: bool
+
+            :rtype: bool
+
+            :raises NotImplementedError: if the solver does not support
+                variable elimination.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> with Solver(name='m22', simplify=True) as s:
+                ...     s.append_formula([[-1, 2], [-2, 3], [-3, 4]])
+                ...     s.freeze([1, 4])
+                ...     s.eliminate()
+                True
+                ...     s.solve(assumptions=[1, -4])
+                False
+                ...     s.solve(assumptions=[1])
+                True
+                ...     s.get_model()
+                [1, 2, 3, 4]
+        """
+
+        if self.solver:
+            return self.solver.eliminate(turn_off)
+
     def accum_stats(self):
         """
             Get accumulated low-level stats from the solver. Currently, the
@@ -426,6 +1006,93 @@ class Solver(object):
         if self.solver:
             return self.solver.accum_stats()
 
+    def memory_usage(self):
+        """
+            Get the memory used by the solver, in bytes. For MiniSat-like
+            solvers, the result is a dictionary with the following entries:
+
+            - ``'arena'``: the clause database (original and learnt clauses),
+            - ``'learnts'``: the part of the arena taken by the learnt
+              clauses (approximately),
+            - ``'watches'``: the watcher lists,
+            - ``'total'``: the sum of the arena and the watcher lists.
+
+            :class:`Lingeling` reports the ``'total'`` entry only, which
+            includes all of its data structures. :class:`Cadical` and
+            :class:`Portfolio` do not support memory accounting.
+
+            :rtype: dict.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.examples.genhard import PHP
+                >>> from pysat.solvers import Solver
+                >>> with Solver(name='m22', bootstrap_with=PHP(5)) as s:
+                ...     print(s.solve())
+                ...     print(s.memory_usage())
+                False
+                {'arena': 856, 'learnts': 280, 'watches': 4640, 'total': 5496}
+        """
+
+        if self.solver:
+            return self.solver.memory_usage()
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database
+            of a MiniSat-like solver. The solver drops (roughly) half of the
+            learnt clauses that it would consider dropping on its own, i.e.
+            the least useful ones, and then releases the memory wasted by the
+            removed clauses. This can be done between SAT calls at any time,
+            e.g. when :meth:`memory_usage` grows too large or after a call
+            limited by :meth:`mem_budget` has stopped.
+        """
+
+        if self.solver:
+            self.solver.reduce_learnts()
+
+    def time_calls(self, on=True):
+        """
+            Enable (or disable if ``on`` is ``False``) timing of the calls
+            made to the underlying solver. Once enabled, the dictionary
+            returned by :meth:`accum_stats` gets an additional entry
+            ``'calls'``, which maps the name of every method called so far
+            (e.g. ``'solve'`` or ``'add_clause'``) to the number of its
+            ``'calls'``, the total number of nanoseconds spent in it,
+            ``'total_ns'``, and the number of nanoseconds spent inside the
+            solver itself, ``'solver_ns'``. The difference between the latter
+            two is the time spent translating the arguments and the results
+            between Python and C++, which tells whether batching or buffering
+            the calls (see e.g. :meth:`append_buffer` or
+            :meth:`solve_batch`) is worth it. Disabling timing drops the
+            counters.
+
+            When timing is not enabled for any solver, the overhead is a
+            single check per call.
+
+            :param on: enable or disable timing
+            :type on: bool
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>> with Solver(name='g3') as s:
+                ...     s.time_calls()
+                ...     s.append_formula([[-1, 2], [-2, 3]])
+                ...     print(s.solve(assumptions=[1]))
+                ...     calls = s.accum_stats()['calls']
+                ...     print(calls['add_clause']['calls'], calls['solve']['calls'])
+                True
+                2 1
+        """
+
+        if self.solver:
+            self.solver.time_calls(on)
+
     def solve(self, assumptions=[]):
         """
             This method is used to check satisfiability of a CNF formula given
@@ -437,6 +1104,11 @@ class Solver(object):
             literals. (**Note** that the ``assumptions`` argument is optional
             and disabled by default.)
 
+            The solver releases the Python GIL for the duration of the call.
+            Therefore, independent solver objects can be used concurrently
+            from several Python threads. Only calls made from the main thread
+            handle SIGINT.
+
             :param assumptions: a list of assumption literals.
             :type assumptions: iterable(int)
 
@@ -463,34 +1135,33 @@ class Solver(object):
             This method is used to check satisfiability of a CNF formula given
             to the solver (see methods :meth:`add_clause` and
             :meth:`append_formula`), taking into account the upper bounds on
-            the *number of conflicts* (see :meth:`conf_budget`) and the *number
-            of propagations* (see :meth:`prop_budget`). If the number of
-            conflicts or propagations is set to be larger than 0 then the
-            following SAT call done with :meth:`solve_limited` will not exceed
-            these values, i.e. it will be *incomplete*. Otherwise, such a call
-            will be identical to :meth:`solve`.
-
-            As soon as the given upper bound on the number of conflicts or
-            propagations is reached, the SAT call is dropped returning
-            ``None``, i.e. *unknown*. ``None`` can also be returned if the call
-            is interrupted by SIGINT. Otherwise, the method returns ``True`` or
-            ``False``.
-
-            **Note** that only MiniSat-like solvers support this functionality
-            (e.g. :class:`Cadical` and :class:`Lingeling` do not support it).
+            the *number of conflicts* (see :meth:`conf_budget`), the *number
+            of propagations* (see :meth:`prop_budget`) and the *size of the
+            clause database* (see :meth:`mem_budget`). If any of these is set
+            to be larger than 0 then the following SAT call done with
+            :meth:`solve_limited` will not exceed it, i.e. it will be
+            *incomplete*. Otherwise, such a call will be identical to
+            :meth:`solve`.
+
+            As soon as one of the given upper bounds is reached, the SAT call
+            is dropped returning ``None``, i.e. *unknown*. ``None`` can also
+            be returned if the call is interrupted by SIGINT. Otherwise, the
+            method returns ``True`` or ``False``.
+
+            **Note** that only MiniSat-like solvers support budgets while
+            :class:`Cadical` and :class:`Lingeling` support :meth:`interrupt`
+            only (:class:`Portfolio` supports neither).
 
             Incremental SAT calls can be made with the use of assumption
             literals. (**Note** that the ``assumptions`` argument is optional
             and disabled by default.)
 
-            **Note** that since SIGINT handling and :meth:`interrupt` are not
-            configured to work *together* at this point, additional input
-            parameter ``expect_interrupt`` is assumed to be given, indicating
-            what kind of interruption may happen during the execution of
-            :meth:`solve_limited`: whether a SIGINT signal or internal
-            :meth:`interrupt`. By default, a SIGINT signal handling is
-            assumed. If ``expect_interrupt`` is set to ``True`` and eventually
-            a SIGINT is received, the behavior is **undefined**.
+            **Note** that SIGINT handling and :meth:`interrupt` work
+            *together*: a SIGINT signal received during a call made from the
+            main thread stops the solver through its own interrupt hook and
+            is reported as an exception while :meth:`interrupt` makes the
+            call return ``None``. Parameter ``expect_interrupt`` is therefore
+            kept for backward compatibility only.
 
             :param assumptions: a list of assumption literals.
             :param expect_interrupt: whether :meth:`interrupt` will be called
@@ -533,20 +1204,247 @@ class Solver(object):
         if self.solver:
             return self.solver.solve_limited(assumptions, expect_interrupt)
 
-    def conf_budget(self, budget=-1):
+    def solve_async(self, assumptions=[]):
         """
-            Set limit (i.e. the upper bound) on the number of conflicts in the
-            next limited SAT call (see :meth:`solve_limited`). The limit value
-            is given as a ``budget`` variable and is an integer greater than
-            ``0``.  If the budget is set to ``0`` or ``-1``, the upper bound on
-            the number of conflicts is disabled.
+            Start a SAT call (see :meth:`solve_limited`) in a background
+            thread and return at once. The call can be polled, waited for,
+            and cancelled through the returned :class:`SolveFuture` handle,
+            which can also be awaited in a coroutine (its value is then the
+            result of the call). As the solver releases the GIL while
+            solving, several calls can run in parallel as long as each of
+            them is made on a separate solver.
 
-            :param budget: the upper bound on the number of conflicts.
-            :type budget: int
+            The solver must not be used in any other way until the call is
+            over, i.e. until :meth:`SolveFuture.done` returns ``True``.
+            Afterwards, the model or the core can be obtained as usual. The
+            interrupt flag of the solver is cleared once the call is over.
 
-            Example:
+            All solvers but :class:`Portfolio` support asynchronous calls.
+            Note that budgets set with :meth:`conf_budget` and
+            :meth:`prop_budget` apply to these calls too.
 
-            .. code-block:: python
+            :param assumptions: a list of assumption literals.
+            :type assumptions: iterable(int)
+
+            :rtype: :class:`SolveFuture`
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.examples.genhard import PHP
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> with Solver(name='cadical', bootstrap_with=PHP(nof_holes=20)) as s:
+                ...     call = s.solve_async()
+                ...     if not call.wait(timeout=1.0):
+                ...         call.cancel()
+                ...     print(call.result())
+                None
+
+            A call can also be awaited with a time limit in :mod:`asyncio`,
+            which cancels it on timeout:
+
+            .. code-block:: python
+
+                >>> async def check(s, timeout):
+                ...     try:
+                ...         return await asyncio.wait_for(s.solve_async(), timeout)
+                ...     except asyncio.TimeoutError:
+                ...         return None
+        """
+
+        if self.solver:
+            return self.solver.solve_async(assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve the internal formula under each of the given sets of
+            assumption literals, within a single call to the underlying
+            solver. This is meant for algorithms issuing large numbers of
+            short incremental SAT calls on the same solver, e.g. the
+            enumeration of MCSes or hitting set based checks, which saves on
+            argument conversion, signal handling, and the construction of
+            Python objects for every query.
+
+            The result is a triple of flat buffers ``(status, offsets,
+            literals)``. Here, ``status[i]`` is ``1`` if the formula is
+            satisfiable under the ``i``-th set of assumptions, ``0`` if it
+            is unsatisfiable, and ``-1`` if the budget is exceeded. If
+            parameter ``models`` is ``True``, the model of each satisfiable
+            query is stored in ``literals[offsets[i]:offsets[i + 1]]``.
+            Similarly, if ``cores`` is ``True``, the same slice holds the
+            unsatisfiable core of each unsatisfiable query. Otherwise, the
+            slices are empty.
+
+            In Python 3, the buffers are ``memoryview`` objects of ``int8``,
+            ``int64``, and ``int32``, respectively. In Python 2, they are
+            plain strings of bytes.
+
+            A positive ``conf_budget`` limits the number of conflicts
+            allowed in each of the queries. Note that any budget set with
+            :meth:`conf_budget` is dropped by this method. Since the results
+            are returned directly, :meth:`get_model` and :meth:`get_core`
+            do not refer to any of the queries afterwards.
+
+            This method is not supported by Lingeling and :class:`Portfolio`.
+
+            :param assumption_sets: a sequence of lists of assumption literals.
+            :param models: return the models of satisfiable queries.
+            :param cores: return the cores of unsatisfiable queries.
+            :param conf_budget: conflict budget per query.
+
+            :type assumption_sets: iterable(iterable(int))
+            :type models: bool
+            :type cores: bool
+            :type conf_budget: int
+
+            :rtype: tuple(memoryview, memoryview, memoryview).
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> with Solver(name='g3', bootstrap_with=[[-1, 2], [-2, 3]]) as s:
+                ...     status, offs, lits = s.solve_batch([[1], [1, -3], [-3]],
+                ...             cores=True)
+                ...     for i in range(len(status)):
+                ...         print(status[i], lits[offs[i]:offs[i + 1]].tolist())
+                ...
+                1 []
+                0 [-3, 1]
+                1 []
+        """
+
+        if self.solver:
+            return self.solver.solve_batch(assumption_sets, models, cores,
+                    conf_budget)
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract a *minimal unsatisfiable subset* (MUS) of the clauses
+            activated by the given selector literals. The clauses are
+            expected to be already added to the solver each augmented with
+            the negation of its selector, as done in
+            :class:`pysat.examples.musx.MUSX`. The deletion-based algorithm
+            runs entirely within the underlying solver: the unsatisfiable
+            core of the full set is used as an over-approximation of an MUS,
+            which is then refined by trying to drop one selector at a time.
+            Every time a selector turns out to be unnecessary, the
+            approximation is reduced to the core of the corresponding call
+            (i.e. *clause-set refinement* is applied).
+
+            A positive ``conf_budget`` limits the number of conflicts in each
+            of the checks (but not in the first call over all selectors).
+            Selectors whose check exceeds the budget are kept, and so the
+            result is then an unsatisfiable subset that is not necessarily
+            minimal.
+
+            The method returns ``None`` if the clauses are satisfiable
+            together. Otherwise, the selectors of the MUS are returned in the
+            order they are given. Similarly to :meth:`solve_batch`,
+            :meth:`get_model` and :meth:`get_core` do not refer to any of the
+            calls made afterwards. Lingeling and :class:`Portfolio` do not
+            support this method.
+
+            :param selectors: a list of selector literals.
+            :param conf_budget: conflict budget per check.
+
+            :type selectors: iterable(int)
+            :type conf_budget: int
+
+            :rtype: list(int) or ``None``.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> # clauses (1), (2), (3), (-1, -2), (-1, -3), (-2, -3)
+                >>> # with selectors 4, 5, 6 of the first three of them
+                >>> with Solver(name='m22') as s:
+                ...     s.append_formula([[1, -4], [2, -5], [3, -6],
+                ...             [-1, -2], [-1, -3], [-2, -3]])
+                ...     print(s.extract_mus([4, 5, 6]))
+                [4, 5]
+        """
+
+        if self.solver:
+            return self.solver.extract_mus(selectors, conf_budget)
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Reduce an unsatisfiable core, i.e. a list of assumption literals
+            under which the formula is unsatisfiable, e.g. the result of
+            :meth:`get_core`. All the calls to the solver are made natively
+            and only the reduced core is returned to Python. First, the core
+            is *trimmed* at most ``trim`` times: the solver is called under
+            the core, which is replaced by the core of the call unless it
+            stops shrinking. A negative ``trim`` trims the core until it
+            stops shrinking. Then, if ``minimize`` is ``True``, the core is
+            reduced by the simple deletion-based algorithm: its literals are
+            dropped one at a time, in their order, if the rest of them is
+            still unsatisfiable. Each of these checks gives up after
+            ``conf_budget`` conflicts (a non-positive budget means no limit),
+            in which case the literal is kept.
+
+            This is what :class:`pysat.examples.rc2.RC2` does with its
+            ``trim`` and ``minz`` options. Similarly to :meth:`extract_mus`,
+            :meth:`get_model` and :meth:`get_core` do not refer to any of the
+            calls made here. Gluecard3, Gluecard4, Lingeling, Minicard, and
+            :class:`Portfolio` do not support this method.
+
+            :param core: an unsatisfiable core of assumption literals.
+            :param conf_budget: conflict budget per deletion check.
+            :param trim: the largest number of trimming rounds.
+            :param minimize: apply deletion-based minimization.
+
+            :type core: iterable(int)
+            :type conf_budget: int
+            :type trim: int
+            :type minimize: bool
+
+            :rtype: list(int)
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>>
+                >>> # clauses (1), (2), (3), (-1, -2), (-1, -3), (-2, -3)
+                >>> # with selectors 4, 5, 6 of the first three of them
+                >>> with Solver(name='m22') as s:
+                ...     s.append_formula([[1, -4], [2, -5], [3, -6],
+                ...             [-1, -2], [-1, -3], [-2, -3]])
+                ...     print(s.solve(assumptions=[4, 5, 6]))
+                ...     print(s.minimize_core(s.get_core()))
+                False
+                [5, 4]
+        """
+
+        if self.solver:
+            return self.solver.minimize_core(core, conf_budget, trim,
+                    minimize)
+
+    def conf_budget(self, budget=-1):
+        """
+            Set limit (i.e. the upper bound) on the number of conflicts in the
+            next limited SAT call (see :meth:`solve_limited`). The limit value
+            is given as a ``budget`` variable and is an integer greater than
+            ``0``.  If the budget is set to ``0`` or ``-1``, the upper bound on
+            the number of conflicts is disabled.
+
+            :param budget: the upper bound on the number of conflicts.
+            :type budget: int
+
+            Example:
+
+            .. code-block:: python
 
                 >>> from pysat.solvers import MinisatGH
                 >>> from pysat.examples.genhard import PHP
@@ -593,6 +1491,42 @@ class Solver(object):
         if self.solver:
             self.solver.prop_budget(budget)
 
+    def mem_budget(self, budget=-1):
+        """
+            Set limit (i.e. the upper bound) on the size of the clause
+            database in the next limited SAT call (see
+            :meth:`solve_limited`). The limit is given in bytes and, unlike
+            the other budgets, it is absolute rather than relative to the
+            current state of the solver. The size includes the learnt
+            clauses. A SAT call that makes the database grow beyond the
+            limit stops and returns ``None``. The solver can then be asked to
+            make room with :meth:`reduce_learnts` before being called again.
+            If the budget is set to ``0`` or ``-1``, the limit is disabled.
+
+            **Note** that the limit is disabled by every call to
+            :meth:`solve`, as are the limits set by :meth:`conf_budget` and
+            :meth:`prop_budget`. Only MiniSat-like solvers support it.
+
+            :param budget: the upper bound on the size of the clause database.
+            :type budget: int
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>> from pysat.examples.genhard import PHP
+                >>>
+                >>> with Solver(name='g3', bootstrap_with=PHP(nof_holes=20)) as s:
+                ...     s.mem_budget(s.memory_usage()['arena'] + 2 ** 20)
+                ...     print(s.solve_limited())  # no more than 1MB of learnts
+                ...     s.reduce_learnts()
+                None
+        """
+
+        if self.solver:
+            self.solver.mem_budget(budget)
+
     def interrupt(self):
         """
             Interrupt the execution of the current *limited* SAT call (see
@@ -687,6 +1621,57 @@ class Solver(object):
         if self.solver:
             return self.solver.propagate(assumptions, phase_saving)
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            The method runs :meth:`propagate` for each of the given sets of
+            assumption literals within a single call to the underlying solver.
+            This way, the cost of argument conversion, signal handling and
+            result construction is paid once for the whole batch rather than
+            once per set. The result is a triple of flat buffers ``(status,
+            offsets, literals)``: ``status[i]`` is ``1`` if no conflict arised
+            when propagating the ``i``-th set (and ``0`` otherwise) while the
+            literals assigned are ``literals[offsets[i]:offsets[i + 1]]``.
+
+            In Python 3, the buffers are ``memoryview`` objects of ``int8``,
+            ``int64``, and ``int32``, respectively. In Python 2, they are
+            plain strings of bytes, which can be decoded with the ``array``
+            module.
+
+            As with :meth:`propagate`, only MiniSat-like solvers support this
+            functionality.
+
+            :param assumption_sets: a sequence of lists of assumption literals.
+            :param phase_saving: enable phase saving (can be ``0``, ``1``, and
+                ``2``).
+
+            :type assumption_sets: iterable(iterable(int))
+            :type phase_saving: int
+
+            :rtype: tuple(memoryview, memoryview, memoryview).
+
+            Usage example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Glucose3
+                >>> from pysat.card import *
+                >>>
+                >>> cnf = CardEnc.atmost(lits=range(1, 6), bound=1, encoding=EncType.pairwise)
+                >>> g = Glucose3(bootstrap_with=cnf.clauses)
+                >>>
+                >>> status, offs, lits = g.propagate_batch([[1], [1, 2], [5]])
+                >>> for i in range(len(status)):
+                ...     print(bool(status[i]), lits[offs[i]:offs[i + 1]].tolist())
+                True [1, -2, -3, -4, -5]
+                False [1, -2, -3, -4, -5]
+                True [5, -1, -2, -3, -4]
+                >>>
+                >>> g.delete()
+        """
+
+        if self.solver:
+            return self.solver.propagate_batch(assumption_sets, phase_saving)
+
     def set_phases(self, literals=[]):
         """
             The method takes a list of literals as an argument and sets
@@ -800,6 +1785,64 @@ class Solver(object):
         if self.solver:
             return self.solver.get_core()
 
+    def get_core_buffer(self):
+        """
+            Same as :meth:`get_core` but, instead of a list of Python
+            integers, the core is returned as a compact buffer of 32-bit
+            integer literals. The buffer is a ``memoryview`` with format
+            ``'i'`` (a string of bytes in Python 2) and can be passed directly
+            to ``array.array('i', ...)`` or ``numpy.frombuffer(...,
+            dtype=numpy.int32)``. As with :meth:`get_core`, ``None`` is
+            returned if the previous SAT call did not return ``False``.
+
+            :rtype: memoryview or ``None``.
+
+            Usage example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Minisat22
+                >>> m = Minisat22(bootstrap_with=[[-1, 2], [-2, 3], [-3, 4]])
+                >>> m.solve(assumptions=[1, 2, 3, -4])
+                False
+                >>> print(m.get_core_buffer().tolist())
+                [-4, 1]
+                >>> m.delete()
+        """
+
+        if self.solver:
+            return self.solver.get_core_buffer()
+
+    def get_model_buffer(self):
+        """
+            Same as :meth:`get_model` but the model is returned as a compact
+            buffer of signed bytes, one per variable: element ``i`` is ``1``
+            if variable ``i + 1`` is assigned to true and ``-1`` otherwise.
+            This way, a model of millions of variables is copied into a single
+            allocation rather than boxed into as many Python integers. The
+            buffer is a ``memoryview`` with format ``'b'`` (a string of bytes
+            in Python 2). ``None`` is returned if the previous SAT call did
+            not return ``True``.
+
+            :rtype: memoryview or ``None``.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>> s = Solver(bootstrap_with=[[-1, 2], [-1, -2], [1, -2]])
+                >>> s.solve()
+                True
+                >>> model = s.get_model_buffer()
+                >>> print([(i + 1) * v for i, v in enumerate(model)])
+                [-1, -2]
+                >>> s.delete()
+        """
+
+        if self.solver:
+            return self.solver.get_model_buffer()
+
     def get_proof(self):
         """
             A DRUP proof can be extracted using this method if the solver was
@@ -957,6 +2000,47 @@ class Solver(object):
         if self.solver:
             return self.solver.enum_models(assumptions)
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            This method enumerates models of the formula like
+            :meth:`enum_models` does, but the whole loop of SAT calls and
+            blocking clauses runs inside the solver. Models are produced in
+            batches of at most ``batch`` models, each batch being a flat
+            buffer of 32-bit literals (see :meth:`get_core_buffer`) where
+            every model is terminated with a ``0``.
+
+            If a list of ``projection`` variables is given, each model
+            contains the values of these variables only and the blocking
+            clauses are built over them. Hence, every projected assignment is
+            reported exactly once. Otherwise, complete models are blocked,
+            exactly as in :meth:`enum_models`.
+
+            :param assumptions: a list of assumption literals.
+            :param projection: variables to project the models on.
+            :param batch: maximal number of models per buffer.
+
+            :type assumptions: iterable(int)
+            :type projection: iterable(int) or ``None``
+            :type batch: int
+
+            :rtype: iterator over memoryview buffers.
+
+            Example:
+
+            .. code-block:: python
+
+                >>> from pysat.solvers import Solver
+                >>> with Solver(bootstrap_with=[[-1, 2], [-2, 3]]) as s:
+                ...     for models in s.enum_models_buffer(projection=[1, 3]):
+                ...         print(models.tolist())
+                [-1, -3, 0, -1, 3, 0, 1, 3, 0]
+        """
+
+        if self.solver:
+            return self.solver.enum_models_buffer(assumptions, projection,
+                    batch)
+
     def add_clause(self, clause, no_return=True):
         """
             This method is used to add a single clause to the solver. An
@@ -1040,7 +2124,9 @@ class Solver(object):
             :type formula: iterable(iterable(int))
             :type no_return: bool
 
-            The ``no_return`` argument is set to ``True`` by default.
+            The ``no_return`` argument is set to ``True`` by default. The
+            clauses of a :class:`.ClauseBuffer`, or of a formula keeping its
+            clauses in one, are added with :meth:`append_buffer`.
 
             :rtype: bool if ``no_return`` is set to ``False``.
 
@@ -1058,6 +2144,43 @@ class Solver(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            This method adds a batch of clauses given as a *flat* buffer of
+            32-bit integers to the solver. Each clause in the buffer is
+            terminated with ``0``, as in the DIMACS format, and so the buffer
+            itself must end with ``0``. Any object supporting the buffer
+            protocol can be used, e.g. an ``array.array('i')``, a NumPy array
+            of ``int32`` or a ``memoryview``. The whole buffer is loaded
+            natively, i.e. without converting individual literals into Python
+            objects, which is much faster than :meth:`append_formula` for
+            large formulas.
+
+            :param buffer: a zero-terminated buffer of clauses.
+            :param no_return: check solver's internal formula and return the
+                result, if set to ``False``.
+
+            :type buffer: buffer of int32
+            :type no_return: bool
+
+            :rtype: bool if ``no_return`` is set to ``False``.
+
+            .. code-block:: python
+
+                >>> from array import array
+                >>> s = Solver()
+                >>> s.append_buffer(array('i', [-1, 2, 0, -1, -2, 0]))
+                >>> s.solve()
+                True
+                >>> print(s.get_model())
+                [-1, -2]
+        """
+
+        if self.solver:
+            res = self.solver.append_buffer(buffer, no_return)
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -1197,104 +2320,262 @@ class Cadical(object):
             if self.prfile:
                 self.prfile.close()
 
-    def solve(self, assumptions=[]):
+    def clone(self, warm=False):
         """
-            Solve internal formula.
+            Copy the solver into a new object.
         """
 
         if self.cadical:
-            if self.use_timer:
-                start_time = process_time()
-
-            self.status = pysolvers.cadical_solve(self.cadical, assumptions,
-                    int(MainThread.check()))
-
-            if self.use_timer:
-                self.call_time = process_time() - start_time
-                self.accu_time += self.call_time
-
-            self.prev_assumps = assumptions
-            return self.status
+            solver = Cadical(use_timer=self.use_timer)
+            pysolvers.cadical_del(solver.cadical, None)
+            solver.cadical = pysolvers.cadical_clone(self.cadical, int(warm))
+            return solver
 
-    def solve_limited(self, assumptions=[], expect_interrupt=False):
+    def share_clauses(self, exchange, max_lbd=8):
         """
-            Solve internal formula using given budgets for conflicts and
-            propagations.
+            Share learnt clauses through a clause exchange pool.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by CaDiCaL.')
+        raise NotImplementedError('Clause sharing is not supported by Cadical')
 
-    def conf_budget(self, budget):
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
         """
-            Set limit on the number of conflicts.
+            Pass batches of learnt clauses to a callback.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by CaDiCaL.')
+        raise NotImplementedError('Learnt clause export is not supported by Cadical')
 
-    def prop_budget(self, budget):
+    def report_progress(self, callback, every=1000):
         """
-            Set limit on the number of propagations.
+            Report the progress of the solver to a callback.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by CaDiCaL.')
+        raise NotImplementedError('Progress reports are not supported by Cadical')
 
-    def interrupt(self):
+    def freeze(self, variables, frozen=True):
         """
-            Interrupt solver execution.
+            Protect variables from elimination.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by CaDiCaL.')
+        raise NotImplementedError('Variable elimination is not supported by Cadical')
 
-    def clear_interrupt(self):
+    def eliminate(self, turn_off=False):
         """
-            Clears an interruption.
+            Run variable elimination.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by CaDiCaL.')
+        raise NotImplementedError('Variable elimination is not supported by Cadical')
 
-    def propagate(self, assumptions=[], phase_saving=0):
+    def solve(self, assumptions=[]):
         """
-            Propagate a given set of assumption literals.
+            Solve internal formula.
         """
 
-        raise NotImplementedError('Simple literal propagation is not yet implemented for CaDiCaL.')
+        if self.cadical:
+            if self.use_timer:
+                start_time = process_time()
 
-    def set_phases(self, literals=[]):
-        """
-            Sets polarities of a given list of variables.
-        """
+            self.status = pysolvers.cadical_solve(self.cadical, assumptions,
+                    int(MainThread.check()))
 
-        raise NotImplementedError('Setting preferred phases is not yet implemented for CaDiCaL.')
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
 
-    def get_status(self):
+            self.prev_assumps = assumptions
+            return self.status
+
+    def solve_limited(self, assumptions=[], expect_interrupt=False):
         """
-            Returns solver's status.
+            Solve internal formula, which can be interrupted (budgets are
+            not supported).
         """
 
         if self.cadical:
-            return self.status
+            if self.use_timer:
+                 start_time = process_time()
 
-    def get_model(self):
-        """
-            Get a model if the formula was previously satisfied.
-        """
+            self.status = pysolvers.cadical_solve_lim(self.cadical,
+                    assumptions, int(MainThread.check()), int(expect_interrupt))
 
-        if self.cadical and self.status == True:
-            model = pysolvers.cadical_model(self.cadical)
-            return model if model != None else []
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
 
-    def get_core(self):
+            self.prev_assumps = assumptions
+            return self.status
+
+    def solve_async(self, assumptions=[]):
         """
-            Get an unsatisfiable core if the formula was previously
-            unsatisfied.
+            Solve internal formula in the background.
         """
 
-        if self.cadical and self.status == False:
-            return pysolvers.cadical_core(self.cadical, self.prev_assumps)
+        return SolveFuture(self, assumptions)
 
-    def get_proof(self):
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
         """
-            Get a proof produced when deciding the formula.
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.cadical:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.cadical_solve_batch(self.cadical, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.cadical:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.cadical_extract_mus(self.cadical, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.cadical:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('cadical', self.cadical, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
+    def conf_budget(self, budget):
+        """
+            Set limit on the number of conflicts.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by CaDiCaL.')
+
+    def prop_budget(self, budget):
+        """
+            Set limit on the number of propagations.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by CaDiCaL.')
+
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by CaDiCaL.')
+
+    def interrupt(self):
+        """
+            Interrupt solver execution.
+        """
+
+        if self.cadical:
+            pysolvers.cadical_interrupt(self.cadical)
+
+    def clear_interrupt(self):
+        """
+            Clears an interruption.
+        """
+
+        if self.cadical:
+            pysolvers.cadical_clearint(self.cadical)
+
+    def propagate(self, assumptions=[], phase_saving=0):
+        """
+            Propagate a given set of assumption literals.
+        """
+
+        raise NotImplementedError('Simple literal propagation is not yet implemented for CaDiCaL.')
+
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        raise NotImplementedError('Simple literal propagation is not yet implemented for CaDiCaL.')
+
+    def set_phases(self, literals=[]):
+        """
+            Sets polarities of a given list of variables.
+        """
+
+        raise NotImplementedError('Setting preferred phases is not yet implemented for CaDiCaL.')
+
+    def get_status(self):
+        """
+            Returns solver's status.
+        """
+
+        if self.cadical:
+            return self.status
+
+    def get_model(self):
+        """
+            Get a model if the formula was previously satisfied.
+        """
+
+        if self.cadical and self.status == True:
+            model = pysolvers.cadical_model(self.cadical)
+            return model if model != None else []
+
+    def get_core(self):
+        """
+            Get an unsatisfiable core if the formula was previously
+            unsatisfied.
+        """
+
+        if self.cadical and self.status == False:
+            return pysolvers.cadical_core(self.cadical, self.prev_assumps)
+
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.cadical and self.status == False:
+            return pysolvers.cadical_core_buffer(self.cadical, self.prev_assumps)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.cadical and self.status == True:
+            return pysolvers.cadical_model_buffer(self.cadical)
+
+    def get_proof(self):
+        """
+            Get a proof produced when deciding the formula.
         """
 
         if self.cadical and self.prfile:
@@ -1344,6 +2625,28 @@ class Cadical(object):
         if self.cadical:
             return pysolvers.cadical_acc_stats(self.cadical)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database.
+        """
+
+        raise NotImplementedError('Memory accounting is not supported by CaDiCaL')
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses.
+        """
+
+        raise NotImplementedError('Reducing learnt clauses is not supported by CaDiCaL')
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.cadical:
+            pysolvers.time_calls(self.cadical, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -1361,6 +2664,30 @@ class Cadical(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.cadical:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.cadical_enum_models(self.cadical,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -1393,6 +2720,14 @@ class Cadical(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by CaDiCaL')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -1402,6 +2737,21 @@ class Cadical(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.cadical:
+            res = pysolvers.cadical_add_cls_buffer(self.cadical, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -1486,6 +2836,52 @@ class Gluecard3(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.gluecard:
+            solver = Gluecard3(use_timer=self.use_timer)
+            pysolvers.gluecard3_del(solver.gluecard)
+            solver.gluecard = pysolvers.gluecard3_clone(self.gluecard, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Gluecard3')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Gluecard3')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Gluecard3')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Gluecard3')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Gluecard3')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -1523,6 +2919,62 @@ class Gluecard3(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.gluecard3_solve_batch(self.gluecard, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.gluecard3_extract_mus(self.gluecard, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        raise NotImplementedError('Core minimization is currently unsupported by Gluecard3.')
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -1539,6 +2991,14 @@ class Gluecard3(object):
         if self.gluecard:
             pysolvers.gluecard3_pbudget(self.gluecard, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.gluecard:
+            pysolvers.gluecard3_mbudget(self.gluecard, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -1573,6 +3033,24 @@ class Gluecard3(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.gluecard3_propagate_batch(self.gluecard,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -1607,6 +3085,22 @@ class Gluecard3(object):
         if self.gluecard and self.status == False:
             return pysolvers.gluecard3_core(self.gluecard)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.gluecard and self.status == False:
+            return pysolvers.gluecard3_core_buffer(self.gluecard)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.gluecard and self.status == True:
+            return pysolvers.gluecard3_model_buffer(self.gluecard)
+
     def get_proof(self):
         """
             Get a proof produced when deciding the formula.
@@ -1657,13 +3151,38 @@ class Gluecard3(object):
         if self.gluecard:
             return pysolvers.gluecard3_acc_stats(self.gluecard)
 
-    def enum_models(self, assumptions=[]):
+    def memory_usage(self):
         """
-            Iterate over models of the internal formula.
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
         """
 
         if self.gluecard:
-            done = False
+            return pysolvers.gluecard3_memory(self.gluecard)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.gluecard:
+            pysolvers.gluecard3_reduce(self.gluecard)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.gluecard:
+            pysolvers.time_calls(self.gluecard, int(on))
+
+    def enum_models(self, assumptions=[]):
+        """
+            Iterate over models of the internal formula.
+        """
+
+        if self.gluecard:
+            done = False
             while not done:
                 self.status = self.solve(assumptions=assumptions)
                 model = self.get_model()
@@ -1674,6 +3193,30 @@ class Gluecard3(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.gluecard:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.gluecard3_enum_models(self.gluecard,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -1710,6 +3253,14 @@ class Gluecard3(object):
         if self.gluecard:
             res = None
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             # this loop should work for a list of clauses, CNF, and CNFPlus
             for clause in formula:
                 if len(clause) != 2 or isinstance(clause[0], int):  # it is a clause
@@ -1723,6 +3274,21 @@ class Gluecard3(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.gluecard:
+            res = pysolvers.gluecard3_add_cls_buffer(self.gluecard, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -1807,6 +3373,52 @@ class Gluecard4(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.gluecard:
+            solver = Gluecard4(use_timer=self.use_timer)
+            pysolvers.gluecard41_del(solver.gluecard)
+            solver.gluecard = pysolvers.gluecard41_clone(self.gluecard, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Gluecard4')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Gluecard4')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Gluecard4')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Gluecard4')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Gluecard4')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -1844,6 +3456,62 @@ class Gluecard4(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.gluecard41_solve_batch(self.gluecard, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.gluecard41_extract_mus(self.gluecard, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        raise NotImplementedError('Core minimization is currently unsupported by Gluecard4.')
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -1860,6 +3528,14 @@ class Gluecard4(object):
         if self.gluecard:
             pysolvers.gluecard41_pbudget(self.gluecard, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.gluecard:
+            pysolvers.gluecard41_mbudget(self.gluecard, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -1894,6 +3570,24 @@ class Gluecard4(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.gluecard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.gluecard41_propagate_batch(self.gluecard,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -1928,6 +3622,22 @@ class Gluecard4(object):
         if self.gluecard and self.status == False:
             return pysolvers.gluecard41_core(self.gluecard)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.gluecard and self.status == False:
+            return pysolvers.gluecard41_core_buffer(self.gluecard)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.gluecard and self.status == True:
+            return pysolvers.gluecard41_model_buffer(self.gluecard)
+
     def get_proof(self):
         """
             Get a proof produced when deciding the formula.
@@ -1978,6 +3688,31 @@ class Gluecard4(object):
         if self.gluecard:
             return pysolvers.gluecard41_acc_stats(self.gluecard)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.gluecard:
+            return pysolvers.gluecard41_memory(self.gluecard)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.gluecard:
+            pysolvers.gluecard41_reduce(self.gluecard)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.gluecard:
+            pysolvers.time_calls(self.gluecard, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -1995,6 +3730,30 @@ class Gluecard4(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.gluecard:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.gluecard41_enum_models(self.gluecard,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -2031,6 +3790,14 @@ class Gluecard4(object):
         if self.gluecard:
             res = None
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             # this loop should work for a list of clauses, CNF, and CNFPlus
             for clause in formula:
                 if len(clause) != 2 or isinstance(clause[0], int):  # it is a clause
@@ -2044,6 +3811,21 @@ class Gluecard4(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.gluecard:
+            res = pysolvers.gluecard41_add_cls_buffer(self.gluecard, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -2128,6 +3910,57 @@ class Glucose3(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.glucose:
+            solver = Glucose3(use_timer=self.use_timer)
+            pysolvers.glucose3_del(solver.glucose)
+            solver.glucose = pysolvers.glucose3_clone(self.glucose, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_share(self.glucose,
+                    exchange.pool if exchange else None, max_lbd)
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_learnts(self.glucose, _learnts_callback(callback),
+                    max_size, max_lbd, batch)
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_progress(self.glucose, callback, every)
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Glucose3')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Glucose3')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -2165,6 +3998,74 @@ class Glucose3(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.glucose3_solve_batch(self.glucose, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.glucose3_extract_mus(self.glucose, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('glucose3', self.glucose, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -2181,6 +4082,14 @@ class Glucose3(object):
         if self.glucose:
             pysolvers.glucose3_pbudget(self.glucose, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_mbudget(self.glucose, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -2215,17 +4124,35 @@ class Glucose3(object):
 
             return bool(st), props if props != None else []
 
-    def set_phases(self, literals=[]):
+    def propagate_batch(self, assumption_sets, phase_saving=0):
         """
-            Sets polarities of a given list of variables.
+            Propagate each of the given sets of assumption literals.
         """
 
         if self.glucose:
-            pysolvers.glucose3_setphases(self.glucose, literals)
+            if self.use_timer:
+                 start_time = process_time()
 
-    def get_status(self):
-        """
-            Returns solver's status.
+            res = pysolvers.glucose3_propagate_batch(self.glucose,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
+    def set_phases(self, literals=[]):
+        """
+            Sets polarities of a given list of variables.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_setphases(self.glucose, literals)
+
+    def get_status(self):
+        """
+            Returns solver's status.
         """
 
         if self.glucose:
@@ -2249,6 +4176,22 @@ class Glucose3(object):
         if self.glucose and self.status == False:
             return pysolvers.glucose3_core(self.glucose)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.glucose and self.status == False:
+            return pysolvers.glucose3_core_buffer(self.glucose)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.glucose and self.status == True:
+            return pysolvers.glucose3_model_buffer(self.glucose)
+
     def get_proof(self):
         """
             Get a proof produced when deciding the formula.
@@ -2299,6 +4242,31 @@ class Glucose3(object):
         if self.glucose:
             return pysolvers.glucose3_acc_stats(self.glucose)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.glucose:
+            return pysolvers.glucose3_memory(self.glucose)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.glucose:
+            pysolvers.glucose3_reduce(self.glucose)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.glucose:
+            pysolvers.time_calls(self.glucose, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -2316,6 +4284,30 @@ class Glucose3(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.glucose:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.glucose3_enum_models(self.glucose,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -2348,6 +4340,14 @@ class Glucose3(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by Glucose3')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -2357,6 +4357,21 @@ class Glucose3(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.glucose:
+            res = pysolvers.glucose3_add_cls_buffer(self.glucose, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -2441,6 +4456,57 @@ class Glucose4(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.glucose:
+            solver = Glucose4(use_timer=self.use_timer)
+            pysolvers.glucose41_del(solver.glucose)
+            solver.glucose = pysolvers.glucose41_clone(self.glucose, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        if self.glucose:
+            pysolvers.glucose41_share(self.glucose,
+                    exchange.pool if exchange else None, max_lbd)
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        if self.glucose:
+            pysolvers.glucose41_learnts(self.glucose, _learnts_callback(callback),
+                    max_size, max_lbd, batch)
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        if self.glucose:
+            pysolvers.glucose41_progress(self.glucose, callback, every)
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Glucose4')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Glucose4')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -2478,6 +4544,74 @@ class Glucose4(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.glucose41_solve_batch(self.glucose, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.glucose41_extract_mus(self.glucose, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('glucose41', self.glucose, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -2494,6 +4628,14 @@ class Glucose4(object):
         if self.glucose:
             pysolvers.glucose41_pbudget(self.glucose, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.glucose:
+            pysolvers.glucose41_mbudget(self.glucose, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -2528,6 +4670,24 @@ class Glucose4(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.glucose:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.glucose41_propagate_batch(self.glucose,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -2562,6 +4722,22 @@ class Glucose4(object):
         if self.glucose and self.status == False:
             return pysolvers.glucose41_core(self.glucose)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.glucose and self.status == False:
+            return pysolvers.glucose41_core_buffer(self.glucose)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.glucose and self.status == True:
+            return pysolvers.glucose41_model_buffer(self.glucose)
+
     def get_proof(self):
         """
             Get a proof produced when deciding the formula.
@@ -2612,6 +4788,31 @@ class Glucose4(object):
         if self.glucose:
             return pysolvers.glucose41_acc_stats(self.glucose)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.glucose:
+            return pysolvers.glucose41_memory(self.glucose)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.glucose:
+            pysolvers.glucose41_reduce(self.glucose)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.glucose:
+            pysolvers.time_calls(self.glucose, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -2629,6 +4830,30 @@ class Glucose4(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.glucose:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.glucose41_enum_models(self.glucose,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -2661,6 +4886,14 @@ class Glucose4(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by Glucose4')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -2670,6 +4903,21 @@ class Glucose4(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.glucose:
+            res = pysolvers.glucose41_add_cls_buffer(self.glucose, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -2751,6 +4999,48 @@ class Lingeling(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        raise NotImplementedError('Cloning is not supported by Lingeling')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Lingeling')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Lingeling')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Lingeling')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Lingeling')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Lingeling')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -2772,46 +5062,104 @@ class Lingeling(object):
 
     def solve_limited(self, assumptions=[], expect_interrupt=False):
         """
-            Solve internal formula using given budgets for conflicts and
-            propagations.
+            Solve internal formula, which can be interrupted (budgets are
+            not supported).
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by Lingeling.')
+        if self.lingeling:
+            if self.use_timer:
+                 start_time = process_time()
 
-    def conf_budget(self, budget):
-        """
-            Set limit on the number of conflicts.
-        """
+            self.status = pysolvers.lingeling_solve_lim(self.lingeling,
+                    assumptions, int(MainThread.check()), int(expect_interrupt))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
 
-        raise NotImplementedError('Limited solve is currently unsupported by Lingeling.')
+            self.prev_assumps = assumptions
+            return self.status
 
-    def prop_budget(self, budget):
+    def solve_async(self, assumptions=[]):
         """
-            Set limit on the number of propagations.
+            Solve internal formula in the background.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by Lingeling.')
+        return SolveFuture(self, assumptions)
 
-    def interrupt(self):
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
         """
-            Interrupt solver execution.
+            Solve internal formula under each of the given sets of
+            assumption literals.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by Lingeling.')
+        raise NotImplementedError('Batched solving is currently unsupported by Lingeling.')
 
-    def clear_interrupt(self):
+    def extract_mus(self, selectors, conf_budget=-1):
         """
-            Clears an interruption.
+            Extract an MUS over the given selectors.
         """
 
-        raise NotImplementedError('Limited solve is currently unsupported by Lingeling.')
+        raise NotImplementedError('MUS extraction is currently unsupported by Lingeling.')
 
-    def propagate(self, assumptions=[], phase_saving=0):
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
         """
-            Propagate a given set of assumption literals.
+            Trim and minimize an unsatisfiable core.
         """
 
-        raise NotImplementedError('Simple literal propagation is not yet implemented for Lingeling.')
+        raise NotImplementedError('Core minimization is currently unsupported by Lingeling.')
+
+    def conf_budget(self, budget):
+        """
+            Set limit on the number of conflicts.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by Lingeling.')
+
+    def prop_budget(self, budget):
+        """
+            Set limit on the number of propagations.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by Lingeling.')
+
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        raise NotImplementedError('Budgets are currently unsupported by Lingeling.')
+
+    def interrupt(self):
+        """
+            Interrupt solver execution.
+        """
+
+        if self.lingeling:
+            pysolvers.lingeling_interrupt(self.lingeling)
+
+    def clear_interrupt(self):
+        """
+            Clears an interruption.
+        """
+
+        if self.lingeling:
+            pysolvers.lingeling_clearint(self.lingeling)
+
+    def propagate(self, assumptions=[], phase_saving=0):
+        """
+            Propagate a given set of assumption literals.
+        """
+
+        raise NotImplementedError('Simple literal propagation is not yet implemented for Lingeling.')
+
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        raise NotImplementedError('Simple literal propagation is not yet implemented for Lingeling.')
 
     def set_phases(self, literals=[]):
         """
@@ -2847,6 +5195,22 @@ class Lingeling(object):
         if self.lingeling and self.status == False:
             return pysolvers.lingeling_core(self.lingeling, self.prev_assumps)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.lingeling and self.status == False:
+            return pysolvers.lingeling_core_buffer(self.lingeling, self.prev_assumps)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.lingeling and self.status == True:
+            return pysolvers.lingeling_model_buffer(self.lingeling)
+
     def get_proof(self):
         """
             Get a proof produced when deciding the formula.
@@ -2897,6 +5261,29 @@ class Lingeling(object):
         if self.lingeling:
             return pysolvers.lingeling_acc_stats(self.lingeling)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the solver.
+        """
+
+        if self.lingeling:
+            return pysolvers.lingeling_memory(self.lingeling)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses.
+        """
+
+        raise NotImplementedError('Reducing learnt clauses is not supported by Lingeling')
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.lingeling:
+            pysolvers.time_calls(self.lingeling, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -2914,6 +5301,30 @@ class Lingeling(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.lingeling:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.lingeling_enum_models(self.lingeling,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -2938,9 +5349,29 @@ class Lingeling(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by Lingeling')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                self.append_buffer(buf)
+
             for clause in formula:
                 self.add_clause(clause, no_return)
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.lingeling:
+            res = pysolvers.lingeling_add_cls_buffer(self.lingeling, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -3022,6 +5453,53 @@ class MapleChrono(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        raise NotImplementedError('Cloning is not supported by MapleChrono')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        if self.maplesat:
+            pysolvers.maplechrono_share(self.maplesat,
+                    exchange.pool if exchange else None, max_lbd)
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        if self.maplesat:
+            pysolvers.maplechrono_learnts(self.maplesat, _learnts_callback(callback),
+                    max_size, max_lbd, batch)
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        if self.maplesat:
+            pysolvers.maplechrono_progress(self.maplesat, callback, every)
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MapleChrono')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MapleChrono')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -3059,6 +5537,74 @@ class MapleChrono(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplechrono_solve_batch(self.maplesat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.maplechrono_extract_mus(self.maplesat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('maplechrono', self.maplesat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -3075,6 +5621,14 @@ class MapleChrono(object):
         if self.maplesat:
             pysolvers.maplechrono_pbudget(self.maplesat, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplechrono_mbudget(self.maplesat, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -3109,6 +5663,24 @@ class MapleChrono(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplechrono_propagate_batch(self.maplesat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -3143,6 +5715,22 @@ class MapleChrono(object):
         if self.maplesat and self.status == False:
             return pysolvers.maplechrono_core(self.maplesat)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.maplesat and self.status == False:
+            return pysolvers.maplechrono_core_buffer(self.maplesat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.maplesat and self.status == True:
+            return pysolvers.maplechrono_model_buffer(self.maplesat)
+
     def get_proof(self):
         """
             Get a proof produced while deciding the formula.
@@ -3193,6 +5781,31 @@ class MapleChrono(object):
         if self.maplesat:
             return pysolvers.maplechrono_acc_stats(self.maplesat)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.maplesat:
+            return pysolvers.maplechrono_memory(self.maplesat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplechrono_reduce(self.maplesat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.maplesat:
+            pysolvers.time_calls(self.maplesat, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -3210,6 +5823,30 @@ class MapleChrono(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.maplesat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.maplechrono_enum_models(self.maplesat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -3242,6 +5879,14 @@ class MapleChrono(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by MapleChrono')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -3251,6 +5896,21 @@ class MapleChrono(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.maplesat:
+            res = pysolvers.maplechrono_add_cls_buffer(self.maplesat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -3332,6 +5992,48 @@ class MapleCM(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        raise NotImplementedError('Cloning is not supported by MapleCM')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by MapleCM')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by MapleCM')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by MapleCM')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MapleCM')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MapleCM')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -3369,15 +6071,83 @@ class MapleCM(object):
 
             return self.status
 
-    def conf_budget(self, budget):
+    def solve_async(self, assumptions=[]):
         """
-            Set limit on the number of conflicts.
+            Solve internal formula in the background.
         """
 
-        if self.maplesat:
-            pysolvers.maplecm_cbudget(self.maplesat, budget)
+        return SolveFuture(self, assumptions)
 
-    def prop_budget(self, budget):
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplecm_solve_batch(self.maplesat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.maplecm_extract_mus(self.maplesat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('maplecm', self.maplesat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
+    def conf_budget(self, budget):
+        """
+            Set limit on the number of conflicts.
+        """
+
+        if self.maplesat:
+            pysolvers.maplecm_cbudget(self.maplesat, budget)
+
+    def prop_budget(self, budget):
         """
             Set limit on the number of propagations.
         """
@@ -3385,6 +6155,14 @@ class MapleCM(object):
         if self.maplesat:
             pysolvers.maplecm_pbudget(self.maplesat, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplecm_mbudget(self.maplesat, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -3419,6 +6197,24 @@ class MapleCM(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplecm_propagate_batch(self.maplesat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -3453,6 +6249,22 @@ class MapleCM(object):
         if self.maplesat and self.status == False:
             return pysolvers.maplecm_core(self.maplesat)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.maplesat and self.status == False:
+            return pysolvers.maplecm_core_buffer(self.maplesat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.maplesat and self.status == True:
+            return pysolvers.maplecm_model_buffer(self.maplesat)
+
     def get_proof(self):
         """
             Get a proof produced while deciding the formula.
@@ -3503,6 +6315,31 @@ class MapleCM(object):
         if self.maplesat:
             return pysolvers.maplecm_acc_stats(self.maplesat)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.maplesat:
+            return pysolvers.maplecm_memory(self.maplesat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplecm_reduce(self.maplesat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.maplesat:
+            pysolvers.time_calls(self.maplesat, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -3520,6 +6357,30 @@ class MapleCM(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.maplesat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.maplecm_enum_models(self.maplesat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -3552,6 +6413,14 @@ class MapleCM(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by MapleCM')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -3561,6 +6430,21 @@ class MapleCM(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.maplesat:
+            res = pysolvers.maplecm_add_cls_buffer(self.maplesat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -3642,6 +6526,48 @@ class Maplesat(object):
             if self.prfile:
                 self.prfile.close()
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        raise NotImplementedError('Cloning is not supported by Maplesat')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Maplesat')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Maplesat')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Maplesat')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Maplesat')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Maplesat')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -3679,6 +6605,74 @@ class Maplesat(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplesat_solve_batch(self.maplesat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.maplesat_extract_mus(self.maplesat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('maplesat', self.maplesat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -3695,6 +6689,14 @@ class Maplesat(object):
         if self.maplesat:
             pysolvers.maplesat_pbudget(self.maplesat, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplesat_mbudget(self.maplesat, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -3729,6 +6731,24 @@ class Maplesat(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.maplesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.maplesat_propagate_batch(self.maplesat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -3763,6 +6783,22 @@ class Maplesat(object):
         if self.maplesat and self.status == False:
             return pysolvers.maplesat_core(self.maplesat)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.maplesat and self.status == False:
+            return pysolvers.maplesat_core_buffer(self.maplesat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.maplesat and self.status == True:
+            return pysolvers.maplesat_model_buffer(self.maplesat)
+
     def get_proof(self):
         """
             Get a proof produced while deciding the formula.
@@ -3813,6 +6849,31 @@ class Maplesat(object):
         if self.maplesat:
             return pysolvers.maplesat_acc_stats(self.maplesat)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.maplesat:
+            return pysolvers.maplesat_memory(self.maplesat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.maplesat:
+            pysolvers.maplesat_reduce(self.maplesat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.maplesat:
+            pysolvers.time_calls(self.maplesat, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -3830,6 +6891,30 @@ class Maplesat(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.maplesat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.maplesat_enum_models(self.maplesat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -3862,6 +6947,14 @@ class Maplesat(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by Maplesat')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -3871,6 +6964,21 @@ class Maplesat(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.maplesat:
+            res = pysolvers.maplesat_add_cls_buffer(self.maplesat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -3940,12 +7048,54 @@ class Mergesat3(object):
             pysolvers.mergesat3_del(self.mergesat)
             self.mergesat = None
 
-    def solve(self, assumptions=[]):
+    def clone(self, warm=False):
         """
-            Solve internal formula.
+            Copy the solver into a new object.
         """
 
-        if self.mergesat:
+        raise NotImplementedError('Cloning is not supported by Mergesat3')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Mergesat3')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Mergesat3')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Mergesat3')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Mergesat3')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Mergesat3')
+
+    def solve(self, assumptions=[]):
+        """
+            Solve internal formula.
+        """
+
+        if self.mergesat:
             if self.use_timer:
                  start_time = process_time()
 
@@ -3977,6 +7127,74 @@ class Mergesat3(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.mergesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.mergesat3_solve_batch(self.mergesat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.mergesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.mergesat3_extract_mus(self.mergesat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.mergesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('mergesat3', self.mergesat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -3993,6 +7211,14 @@ class Mergesat3(object):
         if self.mergesat:
             pysolvers.mergesat3_pbudget(self.mergesat, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.mergesat:
+            pysolvers.mergesat3_mbudget(self.mergesat, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -4027,6 +7253,24 @@ class Mergesat3(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.mergesat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.mergesat3_propagate_batch(self.mergesat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -4061,6 +7305,22 @@ class Mergesat3(object):
         if self.mergesat and self.status == False:
             return pysolvers.mergesat3_core(self.mergesat)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.mergesat and self.status == False:
+            return pysolvers.mergesat3_core_buffer(self.mergesat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.mergesat and self.status == True:
+            return pysolvers.mergesat3_model_buffer(self.mergesat)
+
     def get_proof(self):
         """
             Get a proof produced while deciding the formula.
@@ -4109,6 +7369,31 @@ class Mergesat3(object):
         if self.mergesat:
             return pysolvers.mergesat3_acc_stats(self.mergesat)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.mergesat:
+            return pysolvers.mergesat3_memory(self.mergesat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.mergesat:
+            pysolvers.mergesat3_reduce(self.mergesat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.mergesat:
+            pysolvers.time_calls(self.mergesat, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -4126,6 +7411,30 @@ class Mergesat3(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.mergesat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.mergesat3_enum_models(self.mergesat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -4158,6 +7467,14 @@ class Mergesat3(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by Mergesat3')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -4167,6 +7484,21 @@ class Mergesat3(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.mergesat:
+            res = pysolvers.mergesat3_add_cls_buffer(self.mergesat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -4236,6 +7568,52 @@ class Minicard(object):
             pysolvers.minicard_del(self.minicard)
             self.minicard = None
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.minicard:
+            solver = Minicard(use_timer=self.use_timer)
+            pysolvers.minicard_del(solver.minicard)
+            solver.minicard = pysolvers.minicard_clone(self.minicard, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Minicard')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Minicard')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Minicard')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Minicard')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Minicard')
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -4273,6 +7651,62 @@ class Minicard(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.minicard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minicard_solve_batch(self.minicard, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.minicard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.minicard_extract_mus(self.minicard, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        raise NotImplementedError('Core minimization is currently unsupported by Minicard.')
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -4289,6 +7723,14 @@ class Minicard(object):
         if self.minicard:
             pysolvers.minicard_pbudget(self.minicard, budget)
 
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.minicard:
+            pysolvers.minicard_mbudget(self.minicard, budget)
+
     def interrupt(self):
         """
             Interrupt solver execution.
@@ -4323,6 +7765,24 @@ class Minicard(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.minicard:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minicard_propagate_batch(self.minicard,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
@@ -4357,6 +7817,22 @@ class Minicard(object):
         if self.minicard and self.status == False:
             return pysolvers.minicard_core(self.minicard)
 
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.minicard and self.status == False:
+            return pysolvers.minicard_core_buffer(self.minicard)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.minicard and self.status == True:
+            return pysolvers.minicard_model_buffer(self.minicard)
+
     def get_proof(self):
         """
             Get a proof produced while deciding the formula.
@@ -4405,6 +7881,31 @@ class Minicard(object):
         if self.minicard:
             return pysolvers.minicard_acc_stats(self.minicard)
 
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.minicard:
+            return pysolvers.minicard_memory(self.minicard)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.minicard:
+            pysolvers.minicard_reduce(self.minicard)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.minicard:
+            pysolvers.time_calls(self.minicard, int(on))
+
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
@@ -4422,6 +7923,30 @@ class Minicard(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.minicard:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.minicard_enum_models(self.minicard,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
@@ -4458,6 +7983,14 @@ class Minicard(object):
         if self.minicard:
             res = None
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             # this loop should work for a list of clauses, CNF, and CNFPlus
             for clause in formula:
                 if len(clause) != 2 or isinstance(clause[0], int):  # it is a clause
@@ -4471,6 +8004,21 @@ class Minicard(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.minicard:
+            res = pysolvers.minicard_add_cls_buffer(self.minicard, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -4487,7 +8035,7 @@ class Minisat22(object):
         MiniSat 2.2 SAT solver.
     """
 
-    def __init__(self, bootstrap_with=None, use_timer=False):
+    def __init__(self, bootstrap_with=None, use_timer=False, simplify=False):
         """
             Basic constructor.
         """
@@ -4495,7 +8043,7 @@ class Minisat22(object):
         self.minisat = None
         self.status = None
 
-        self.new(bootstrap_with, use_timer)
+        self.new(bootstrap_with, use_timer, simplify)
 
     def __enter__(self):
         """
@@ -4512,13 +8060,13 @@ class Minisat22(object):
         self.delete()
         self.minisat = None
 
-    def new(self, bootstrap_with=None, use_timer=False):
+    def new(self, bootstrap_with=None, use_timer=False, simplify=False):
         """
             Actual constructor of the solver.
         """
 
         if not self.minisat:
-            self.minisat = pysolvers.minisat22_new()
+            self.minisat = pysolvers.minisat22_new(int(simplify))
 
             if bootstrap_with:
                 if type(bootstrap_with) == CNFPlus and bootstrap_with.atmosts:
@@ -4540,6 +8088,59 @@ class Minisat22(object):
             pysolvers.minisat22_del(self.minisat)
             self.minisat = None
 
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.minisat:
+            solver = Minisat22(use_timer=self.use_timer)
+            pysolvers.minisat22_del(solver.minisat)
+            solver.minisat = pysolvers.minisat22_clone(self.minisat, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_share(self.minisat,
+                    exchange.pool if exchange else None, max_lbd)
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_learnts(self.minisat, _learnts_callback(callback),
+                    max_size, max_lbd, batch)
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_progress(self.minisat, callback, every)
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_freeze(self.minisat, variables, int(frozen))
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        if self.minisat:
+            return pysolvers.minisat22_eliminate(self.minisat, int(turn_off))
+
     def solve(self, assumptions=[]):
         """
             Solve internal formula.
@@ -4577,6 +8178,74 @@ class Minisat22(object):
 
             return self.status
 
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minisat22_solve_batch(self.minisat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.minisat22_extract_mus(self.minisat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('minisat22', self.minisat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
@@ -4585,13 +8254,545 @@ class Minisat22(object):
         if self.minisat:
             pysolvers.minisat22_cbudget(self.minisat, budget)
 
-    def prop_budget(self, budget):
+    def prop_budget(self, budget):
+        """
+            Set limit on the number of propagations.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_pbudget(self.minisat, budget)
+
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_mbudget(self.minisat, budget)
+
+    def interrupt(self):
+        """
+            Interrupt solver execution.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_interrupt(self.minisat)
+
+    def clear_interrupt(self):
+        """
+            Clears an interruption.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_clearint(self.minisat)
+
+    def propagate(self, assumptions=[], phase_saving=0):
+        """
+            Propagate a given set of assumption literals.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            st, props = pysolvers.minisat22_propagate(self.minisat,
+                    assumptions, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return bool(st), props if props != None else []
+
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minisat22_propagate_batch(self.minisat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
+    def set_phases(self, literals=[]):
+        """
+            Sets polarities of a given list of variables.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_setphases(self.minisat, literals)
+
+    def get_status(self):
+        """
+            Returns solver's status.
+        """
+
+        if self.minisat:
+            return self.status
+
+    def get_model(self):
+        """
+            Get a model if the formula was previously satisfied.
+        """
+
+        if self.minisat and self.status == True:
+            model = pysolvers.minisat22_model(self.minisat)
+            return model if model != None else []
+
+    def get_core(self):
+        """
+            Get an unsatisfiable core if the formula was previously
+            unsatisfied.
+        """
+
+        if self.minisat and self.status == False:
+            return pysolvers.minisat22_core(self.minisat)
+
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.minisat and self.status == False:
+            return pysolvers.minisat22_core_buffer(self.minisat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.minisat and self.status == True:
+            return pysolvers.minisat22_model_buffer(self.minisat)
+
+    def get_proof(self):
+        """
+            Get a proof produced while deciding the formula.
+        """
+
+        raise NotImplementedError('Proof tracing is not supported by MiniSat.')
+
+    def time(self):
+        """
+            Get time spent for the last call to oracle.
+        """
+
+        if self.minisat:
+            return self.call_time
+
+    def time_accum(self):
+        """
+            Get time accumulated for all calls to oracle.
+        """
+
+        if self.minisat:
+            return self.accu_time
+
+    def nof_vars(self):
+        """
+            Get number of variables currently used by the solver.
+        """
+
+        if self.minisat:
+            return pysolvers.minisat22_nof_vars(self.minisat)
+
+    def nof_clauses(self):
+        """
+            Get number of clauses currently used by the solver.
+        """
+
+        if self.minisat:
+            return pysolvers.minisat22_nof_cls(self.minisat)
+
+    def accum_stats(self):
+        """
+            Get accumulated low-level stats from the solver. This includes
+            the number of restarts, conflicts, decisions and propagations.
+        """
+
+        if self.minisat:
+            return pysolvers.minisat22_acc_stats(self.minisat)
+
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.minisat:
+            return pysolvers.minisat22_memory(self.minisat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.minisat:
+            pysolvers.minisat22_reduce(self.minisat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.minisat:
+            pysolvers.time_calls(self.minisat, int(on))
+
+    def enum_models(self, assumptions=[]):
+        """
+            Iterate over models of the internal formula.
+        """
+
+        if self.minisat:
+            done = False
+            while not done:
+                self.status = self.solve(assumptions=assumptions)
+                model = self.get_model()
+
+                if model is not None:
+                    self.add_clause([-l for l in model])  # blocking model
+                    yield model
+                else:
+                    done = True
+
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.minisat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.minisat22_enum_models(self.minisat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
+    def add_clause(self, clause, no_return=True):
+        """
+            Add a new clause to solver's internal formula.
+        """
+
+        if self.minisat:
+            res = pysolvers.minisat22_add_cl(self.minisat, clause)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
+    def add_atmost(self, lits, k, no_return=True):
+        """
+            Atmost constraints are not supported by MiniSat.
+        """
+
+        raise NotImplementedError('Atmost constraints are not supported by MiniSat.')
+
+    def append_formula(self, formula, no_return=True):
+        """
+            Appends list of clauses to solver's internal formula.
+        """
+
+        if self.minisat:
+            res = None
+
+            if type(formula) == CNFPlus and formula.atmosts:
+                raise NotImplementedError('Atmost constraints are not supported by MiniSat')
+
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
+            for clause in formula:
+                res = self.add_clause(clause, no_return)
+
+                if not no_return and res == False:
+                    return res
+
+            if not no_return:
+                return res
+
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.minisat:
+            res = pysolvers.minisat22_add_cls_buffer(self.minisat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
+    def supports_atmost(self):
+        """
+            This method can be called to determine whether the solver supports
+            native AtMostK (see :mod:`pysat.card`) constraints.
+        """
+
+        return False
+
+
+#
+#==============================================================================
+class MinisatGH(object):
+    """
+        MiniSat SAT solver (version from github).
+    """
+
+    def __init__(self, bootstrap_with=None, use_timer=False):
+        """
+            Basic constructor.
+        """
+
+        self.minisat = None
+        self.status = None
+
+        self.new(bootstrap_with, use_timer)
+
+    def __enter__(self):
+        """
+            'with' constructor.
+        """
+
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        """
+            'with' destructor.
+        """
+
+        self.delete()
+        self.minisat = None
+
+    def new(self, bootstrap_with=None, use_timer=False):
+        """
+            Actual constructor of the solver.
+        """
+
+        if not self.minisat:
+            self.minisat = pysolvers.minisatgh_new()
+
+            if bootstrap_with:
+                if type(bootstrap_with) == CNFPlus and bootstrap_with.atmosts:
+                    raise NotImplementedError('Atmost constraints are not supported by MiniSat')
+
+                for clause in bootstrap_with:
+                    self.add_clause(clause)
+
+            self.use_timer = use_timer
+            self.call_time = 0.0  # time spent for the last call to oracle
+            self.accu_time = 0.0  # time accumulated for all calls to oracle
+
+    def delete(self):
+        """
+            Destructor.
+        """
+
+        if self.minisat:
+            pysolvers.minisatgh_del(self.minisat)
+            self.minisat = None
+
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        if self.minisat:
+            solver = MinisatGH(use_timer=self.use_timer)
+            pysolvers.minisatgh_del(solver.minisat)
+            solver.minisat = pysolvers.minisatgh_clone(self.minisat, int(warm))
+            return solver
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by MinisatGH')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by MinisatGH')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by MinisatGH')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MinisatGH')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by MinisatGH')
+
+    def solve(self, assumptions=[]):
+        """
+            Solve internal formula.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            self.status = pysolvers.minisatgh_solve(self.minisat, assumptions,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return self.status
+
+    def solve_limited(self, assumptions=[], expect_interrupt=False):
+        """
+            Solve internal formula using given budgets for conflicts and
+            propagations.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            self.status = pysolvers.minisatgh_solve_lim(self.minisat,
+                    assumptions, int(MainThread.check()), int(expect_interrupt))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return self.status
+
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
+
+        return SolveFuture(self, assumptions)
+
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minisatgh_solve_batch(self.minisat, assumption_sets,
+                    int(models), int(cores), conf_budget,
+                    int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            # the results of the batch are only available in res
+            self.status = None
+            return res
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            mus = pysolvers.minisatgh_extract_mus(self.minisat, selectors,
+                    conf_budget, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return mus
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            core = pysolvers.minimize_core('minisatgh', self.minisat, core,
+                    conf_budget, trim, int(minimize), int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            self.status = None
+            return core
+
+    def conf_budget(self, budget):
+        """
+            Set limit on the number of conflicts.
+        """
+
+        if self.minisat:
+            pysolvers.minisatgh_cbudget(self.minisat, budget)
+
+    def prop_budget(self, budget):
+        """
+            Set limit on the number of propagations.
+        """
+
+        if self.minisat:
+            pysolvers.minisatgh_pbudget(self.minisat, budget)
+
+    def mem_budget(self, budget):
         """
-            Set limit on the number of propagations.
+            Set limit on the size of the clause database.
         """
 
         if self.minisat:
-            pysolvers.minisat22_pbudget(self.minisat, budget)
+            pysolvers.minisatgh_mbudget(self.minisat, budget)
 
     def interrupt(self):
         """
@@ -4599,7 +8800,7 @@ class Minisat22(object):
         """
 
         if self.minisat:
-            pysolvers.minisat22_interrupt(self.minisat)
+            pysolvers.minisatgh_interrupt(self.minisat)
 
     def clear_interrupt(self):
         """
@@ -4607,7 +8808,7 @@ class Minisat22(object):
         """
 
         if self.minisat:
-            pysolvers.minisat22_clearint(self.minisat)
+            pysolvers.minisatgh_clearint(self.minisat)
 
     def propagate(self, assumptions=[], phase_saving=0):
         """
@@ -4618,7 +8819,7 @@ class Minisat22(object):
             if self.use_timer:
                  start_time = process_time()
 
-            st, props = pysolvers.minisat22_propagate(self.minisat,
+            st, props = pysolvers.minisatgh_propagate(self.minisat,
                     assumptions, phase_saving, int(MainThread.check()))
 
             if self.use_timer:
@@ -4627,13 +8828,31 @@ class Minisat22(object):
 
             return bool(st), props if props != None else []
 
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
+
+        if self.minisat:
+            if self.use_timer:
+                 start_time = process_time()
+
+            res = pysolvers.minisatgh_propagate_batch(self.minisat,
+                    assumption_sets, phase_saving, int(MainThread.check()))
+
+            if self.use_timer:
+                self.call_time = process_time() - start_time
+                self.accu_time += self.call_time
+
+            return res
+
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
         """
 
         if self.minisat:
-            pysolvers.minisat22_setphases(self.minisat, literals)
+            pysolvers.minisatgh_setphases(self.minisat, literals)
 
     def get_status(self):
         """
@@ -4649,7 +8868,7 @@ class Minisat22(object):
         """
 
         if self.minisat and self.status == True:
-            model = pysolvers.minisat22_model(self.minisat)
+            model = pysolvers.minisatgh_model(self.minisat)
             return model if model != None else []
 
     def get_core(self):
@@ -4659,7 +8878,23 @@ class Minisat22(object):
         """
 
         if self.minisat and self.status == False:
-            return pysolvers.minisat22_core(self.minisat)
+            return pysolvers.minisatgh_core(self.minisat)
+
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.minisat and self.status == False:
+            return pysolvers.minisatgh_core_buffer(self.minisat)
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.minisat and self.status == True:
+            return pysolvers.minisatgh_model_buffer(self.minisat)
 
     def get_proof(self):
         """
@@ -4690,7 +8925,7 @@ class Minisat22(object):
         """
 
         if self.minisat:
-            return pysolvers.minisat22_nof_vars(self.minisat)
+            return pysolvers.minisatgh_nof_vars(self.minisat)
 
     def nof_clauses(self):
         """
@@ -4698,7 +8933,7 @@ class Minisat22(object):
         """
 
         if self.minisat:
-            return pysolvers.minisat22_nof_cls(self.minisat)
+            return pysolvers.minisatgh_nof_cls(self.minisat)
 
     def accum_stats(self):
         """
@@ -4707,7 +8942,32 @@ class Minisat22(object):
         """
 
         if self.minisat:
-            return pysolvers.minisat22_acc_stats(self.minisat)
+            return pysolvers.minisatgh_acc_stats(self.minisat)
+
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database, by the
+            learnt clauses in it and by the watcher lists.
+        """
+
+        if self.minisat:
+            return pysolvers.minisatgh_memory(self.minisat)
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses and compact the clause database.
+        """
+
+        if self.minisat:
+            pysolvers.minisatgh_reduce(self.minisat)
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to the solver.
+        """
+
+        if self.minisat:
+            pysolvers.time_calls(self.minisat, int(on))
 
     def enum_models(self, assumptions=[]):
         """
@@ -4726,13 +8986,37 @@ class Minisat22(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Iterate over batches of models of the internal formula, each
+            given as a flat zero-terminated buffer of literals.
+        """
+
+        if self.minisat:
+            done = False
+            while not done:
+                if self.use_timer:
+                    start_time = process_time()
+
+                models, done = pysolvers.minisatgh_enum_models(self.minisat,
+                        assumptions, projection, batch, int(MainThread.check()))
+
+                if self.use_timer:
+                    self.call_time = process_time() - start_time
+                    self.accu_time += self.call_time
+
+                self.status = not done
+                if len(models):
+                    yield models
+
     def add_clause(self, clause, no_return=True):
         """
             Add a new clause to solver's internal formula.
         """
 
         if self.minisat:
-            res = pysolvers.minisat22_add_cl(self.minisat, clause)
+            res = pysolvers.minisatgh_add_cl(self.minisat, clause)
 
             if res == False:
                 self.status = False
@@ -4758,6 +9042,14 @@ class Minisat22(object):
             if type(formula) == CNFPlus and formula.atmosts:
                 raise NotImplementedError('Atmost constraints are not supported by MiniSat')
 
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
+
             for clause in formula:
                 res = self.add_clause(clause, no_return)
 
@@ -4767,6 +9059,21 @@ class Minisat22(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to solver's
+            internal formula.
+        """
+
+        if self.minisat:
+            res = pysolvers.minisatgh_add_cls_buffer(self.minisat, buffer)
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -4778,20 +9085,39 @@ class Minisat22(object):
 
 #
 #==============================================================================
-class MinisatGH(object):
+class Portfolio(object):
     """
-        MiniSat SAT solver (version from github).
+        Portfolio of SAT solvers racing on the same formula in native threads.
     """
 
-    def __init__(self, bootstrap_with=None, use_timer=False):
+    # function prefix and solver attribute of every backend class
+    racers = {
+        Cadical:     ('cadical',     'cadical'),
+        Gluecard3:   ('gluecard3',   'gluecard'),
+        Gluecard4:   ('gluecard41',  'gluecard'),
+        Glucose3:    ('glucose3',    'glucose'),
+        Glucose4:    ('glucose41',   'glucose'),
+        Lingeling:   ('lingeling',   'lingeling'),
+        MapleChrono: ('maplechrono', 'maplesat'),
+        MapleCM:     ('maplecm',     'maplesat'),
+        Maplesat:    ('maplesat',    'maplesat'),
+        Mergesat3:   ('mergesat3',   'mergesat'),
+        Minicard:    ('minicard',    'minicard'),
+        Minisat22:   ('minisat22',   'minisat'),
+        MinisatGH:   ('minisatgh',   'minisat')
+    }
+
+    def __init__(self, bootstrap_with=None, use_timer=False,
+            solvers=['g4', 'mcb', 'cd', 'lgl']):
         """
             Basic constructor.
         """
 
-        self.minisat = None
+        self.members = None
+        self.winner = None
         self.status = None
 
-        self.new(bootstrap_with, use_timer)
+        self.new(bootstrap_with, use_timer, solvers)
 
     def __enter__(self):
         """
@@ -4806,19 +9132,25 @@ class MinisatGH(object):
         """
 
         self.delete()
-        self.minisat = None
+        self.members = None
 
-    def new(self, bootstrap_with=None, use_timer=False):
+    def new(self, bootstrap_with=None, use_timer=False,
+            solvers=['g4', 'mcb', 'cd', 'lgl']):
         """
             Actual constructor of the solver.
         """
 
-        if not self.minisat:
-            self.minisat = pysolvers.minisatgh_new()
+        if not self.members:
+            self.members = []
+            for name in solvers:
+                if name.lower() in SolverNames.portfolio:
+                    raise NotImplementedError('Portfolios cannot be nested')
+
+                self.members.append(Solver(name=name).solver)
 
             if bootstrap_with:
                 if type(bootstrap_with) == CNFPlus and bootstrap_with.atmosts:
-                    raise NotImplementedError('Atmost constraints are not supported by MiniSat')
+                    raise NotImplementedError('Atmost constraints are not supported by Portfolio')
 
                 for clause in bootstrap_with:
                     self.add_clause(clause)
@@ -4832,26 +9164,84 @@ class MinisatGH(object):
             Destructor.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_del(self.minisat)
-            self.minisat = None
+        if self.members:
+            for member in self.members:
+                member.delete()
+
+            self.members = None
+            self.winner = None
+
+    def clone(self, warm=False):
+        """
+            Copy the solver into a new object.
+        """
+
+        raise NotImplementedError('Cloning is not supported by Portfolio')
+
+    def share_clauses(self, exchange, max_lbd=8):
+        """
+            Share learnt clauses through a clause exchange pool.
+        """
+
+        raise NotImplementedError('Clause sharing is not supported by Portfolio')
+
+    def export_learnts(self, callback, max_size=30, max_lbd=8, batch=1024):
+        """
+            Pass batches of learnt clauses to a callback.
+        """
+
+        raise NotImplementedError('Learnt clause export is not supported by Portfolio')
+
+    def report_progress(self, callback, every=1000):
+        """
+            Report the progress of the solver to a callback.
+        """
+
+        raise NotImplementedError('Progress reports are not supported by Portfolio')
+
+    def freeze(self, variables, frozen=True):
+        """
+            Protect variables from elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Portfolio')
+
+    def eliminate(self, turn_off=False):
+        """
+            Run variable elimination.
+        """
+
+        raise NotImplementedError('Variable elimination is not supported by Portfolio')
 
     def solve(self, assumptions=[]):
         """
-            Solve internal formula.
+            Solve internal formula by racing all the solvers.
         """
 
-        if self.minisat:
+        if self.members:
+            # the CPU time of the race is summed over all of its threads,
+            # and so the wall-clock time is measured instead
             if self.use_timer:
-                 start_time = process_time()
+                start_time = perf_counter()
 
-            self.status = pysolvers.minisatgh_solve(self.minisat, assumptions,
-                    int(MainThread.check()))
+            assumptions = list(assumptions)
+            res = pysolvers.portfolio_solve([(self.racers[type(m)][0],
+                getattr(m, self.racers[type(m)][1])) for m in self.members],
+                assumptions, int(MainThread.check()))
 
             if self.use_timer:
-                self.call_time = process_time() - start_time
+                self.call_time = perf_counter() - start_time
                 self.accu_time += self.call_time
 
+            for member in self.members:
+                member.status = None
+
+            self.winner, self.status = None, None
+            if res != None:
+                self.winner = self.members[res[0]]
+                self.winner.status = self.status = res[1]
+                self.winner.prev_assumps = assumptions
+
             return self.status
 
     def solve_limited(self, assumptions=[], expect_interrupt=False):
@@ -4860,93 +9250,117 @@ class MinisatGH(object):
             propagations.
         """
 
-        if self.minisat:
-            if self.use_timer:
-                 start_time = process_time()
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
 
-            self.status = pysolvers.minisatgh_solve_lim(self.minisat,
-                    assumptions, int(MainThread.check()), int(expect_interrupt))
+    def solve_async(self, assumptions=[]):
+        """
+            Solve internal formula in the background.
+        """
 
-            if self.use_timer:
-                self.call_time = process_time() - start_time
-                self.accu_time += self.call_time
+        raise NotImplementedError('Asynchronous solving is currently unsupported by Portfolio.')
 
-            return self.status
+    def solve_batch(self, assumption_sets, models=False, cores=False,
+            conf_budget=-1):
+        """
+            Solve internal formula under each of the given sets of
+            assumption literals.
+        """
+
+        raise NotImplementedError('Batched solving is currently unsupported by Portfolio.')
+
+    def extract_mus(self, selectors, conf_budget=-1):
+        """
+            Extract an MUS over the given selectors.
+        """
+
+        raise NotImplementedError('MUS extraction is currently unsupported by Portfolio.')
+
+    def minimize_core(self, core, conf_budget=1000, trim=0, minimize=True):
+        """
+            Trim and minimize an unsatisfiable core.
+        """
+
+        raise NotImplementedError('Core minimization is currently unsupported by Portfolio.')
 
     def conf_budget(self, budget):
         """
             Set limit on the number of conflicts.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_cbudget(self.minisat, budget)
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
 
     def prop_budget(self, budget):
         """
             Set limit on the number of propagations.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_pbudget(self.minisat, budget)
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
+
+    def mem_budget(self, budget):
+        """
+            Set limit on the size of the clause database.
+        """
+
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
 
     def interrupt(self):
         """
             Interrupt solver execution.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_interrupt(self.minisat)
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
 
     def clear_interrupt(self):
         """
             Clears an interruption.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_clearint(self.minisat)
+        raise NotImplementedError('Limited solve is currently unsupported by Portfolio.')
 
     def propagate(self, assumptions=[], phase_saving=0):
         """
             Propagate a given set of assumption literals.
         """
 
-        if self.minisat:
-            if self.use_timer:
-                 start_time = process_time()
-
-            st, props = pysolvers.minisatgh_propagate(self.minisat,
-                    assumptions, phase_saving, int(MainThread.check()))
+        raise NotImplementedError('Simple literal propagation is not yet implemented for Portfolio.')
 
-            if self.use_timer:
-                self.call_time = process_time() - start_time
-                self.accu_time += self.call_time
+    def propagate_batch(self, assumption_sets, phase_saving=0):
+        """
+            Propagate each of the given sets of assumption literals.
+        """
 
-            return bool(st), props if props != None else []
+        raise NotImplementedError('Simple literal propagation is not yet implemented for Portfolio.')
 
     def set_phases(self, literals=[]):
         """
             Sets polarities of a given list of variables.
         """
 
-        if self.minisat:
-            pysolvers.minisatgh_setphases(self.minisat, literals)
+        raise NotImplementedError('Setting preferred phases is not yet implemented for Portfolio.')
 
     def get_status(self):
         """
             Returns solver's status.
         """
 
-        if self.minisat:
+        if self.members:
             return self.status
 
+    def get_winner(self):
+        """
+            Get the solver object that won the last race.
+        """
+
+        if self.members:
+            return self.winner
+
     def get_model(self):
         """
             Get a model if the formula was previously satisfied.
         """
 
-        if self.minisat and self.status == True:
-            model = pysolvers.minisatgh_model(self.minisat)
-            return model if model != None else []
+        if self.members and self.status == True:
+            return self.winner.get_model()
 
     def get_core(self):
         """
@@ -4954,30 +9368,49 @@ class MinisatGH(object):
             unsatisfied.
         """
 
-        if self.minisat and self.status == False:
-            return pysolvers.minisatgh_core(self.minisat)
+        if self.members and self.status == False:
+            return self.winner.get_core()
+
+    def get_core_buffer(self):
+        """
+            Get an unsatisfiable core as a buffer of int32 literals.
+        """
+
+        if self.members and self.status == False:
+            return self.winner.get_core_buffer()
+
+    def get_model_buffer(self):
+        """
+            Get a model as a buffer of int8 signs of the variables.
+        """
+
+        if self.members and self.status == True:
+            return self.winner.get_model_buffer()
 
     def get_proof(self):
         """
-            Get a proof produced while deciding the formula.
+            Get a proof produced when deciding the formula.
         """
 
-        raise NotImplementedError('Proof tracing is not supported by MiniSat.')
+        raise NotImplementedError('Proof tracing is not supported by Portfolio.')
 
     def time(self):
         """
-            Get time spent for the last call to oracle.
+            Get time spent for the last call to oracle. Unlike the other
+            solvers, which report CPU time, this is the wall-clock time of
+            the race.
         """
 
-        if self.minisat:
+        if self.members:
             return self.call_time
 
     def time_accum(self):
         """
-            Get time accumulated for all calls to oracle.
+            Get time accumulated for all calls to oracle, measured as
+            wall-clock time.
         """
 
-        if self.minisat:
+        if self.members:
             return self.accu_time
 
     def nof_vars(self):
@@ -4985,32 +9418,57 @@ class MinisatGH(object):
             Get number of variables currently used by the solver.
         """
 
-        if self.minisat:
-            return pysolvers.minisatgh_nof_vars(self.minisat)
+        if self.members:
+            return max(member.nof_vars() for member in self.members)
 
     def nof_clauses(self):
         """
-            Get number of clauses currently used by the solver.
+            Get number of clauses currently used by the winner of the last
+            race or by the first solver if there was none.
         """
 
-        if self.minisat:
-            return pysolvers.minisatgh_nof_cls(self.minisat)
+        if self.members:
+            return (self.winner or self.members[0]).nof_clauses()
 
     def accum_stats(self):
         """
-            Get accumulated low-level stats from the solver. This includes
-            the number of restarts, conflicts, decisions and propagations.
+            Get accumulated low-level stats from the winner of the last race.
+            This includes the number of restarts, conflicts, decisions and
+            propagations.
         """
 
-        if self.minisat:
-            return pysolvers.minisatgh_acc_stats(self.minisat)
+        if self.members and self.winner:
+            return self.winner.accum_stats()
+
+    def memory_usage(self):
+        """
+            Get the number of bytes used by the clause database.
+        """
+
+        raise NotImplementedError('Memory accounting is not supported by Portfolio')
+
+    def reduce_learnts(self):
+        """
+            Reduce the set of learnt clauses.
+        """
+
+        raise NotImplementedError('Reducing learnt clauses is not supported by Portfolio')
+
+    def time_calls(self, on=True):
+        """
+            Enable or disable timing of the calls to all the members.
+        """
+
+        if self.members:
+            for m in self.members:
+                m.time_calls(on)
 
     def enum_models(self, assumptions=[]):
         """
             Iterate over models of the internal formula.
         """
 
-        if self.minisat:
+        if self.members:
             done = False
             while not done:
                 self.status = self.solve(assumptions=assumptions)
@@ -5022,13 +9480,26 @@ class MinisatGH(object):
                 else:
                     done = True
 
+    def enum_models_buffer(self, assumptions=[], projection=None,
+            batch=1024):
+        """
+            Native model enumeration is not supported by Portfolio.
+        """
+
+        raise NotImplementedError('Native model enumeration is not supported by Portfolio.')
+
     def add_clause(self, clause, no_return=True):
         """
-            Add a new clause to solver's internal formula.
+            Add a new clause to the internal formula of every solver.
         """
 
-        if self.minisat:
-            res = pysolvers.minisatgh_add_cl(self.minisat, clause)
+        if self.members:
+            clause = list(clause)
+
+            res = True
+            for member in self.members:
+                if member.add_clause(clause, no_return=False) == False:
+                    res = False
 
             if res == False:
                 self.status = False
@@ -5038,21 +9509,29 @@ class MinisatGH(object):
 
     def add_atmost(self, lits, k, no_return=True):
         """
-            Atmost constraints are not supported by MiniSat.
+            Atmost constraints are not supported by Portfolio.
         """
 
-        raise NotImplementedError('Atmost constraints are not supported by MiniSat.')
+        raise NotImplementedError('Atmost constraints are not supported by Portfolio.')
 
     def append_formula(self, formula, no_return=True):
         """
-            Appends list of clauses to solver's internal formula.
+            Appends list of clauses to the internal formula of every solver.
         """
 
-        if self.minisat:
+        if self.members:
             res = None
 
             if type(formula) == CNFPlus and formula.atmosts:
-                raise NotImplementedError('Atmost constraints are not supported by MiniSat')
+                raise NotImplementedError('Atmost constraints are not supported by Portfolio')
+
+            # clauses kept in a ClauseBuffer are added as a flat buffer
+            buf, formula = _flat_formula(formula)
+            if buf is not None:
+                res = self.append_buffer(buf, no_return=False)
+
+                if not no_return and res == False:
+                    return res
 
             for clause in formula:
                 res = self.add_clause(clause, no_return)
@@ -5063,6 +9542,24 @@ class MinisatGH(object):
             if not no_return:
                 return res
 
+    def append_buffer(self, buffer, no_return=True):
+        """
+            Appends a flat zero-terminated buffer of clauses to the internal
+            formula of every solver.
+        """
+
+        if self.members:
+            res = True
+            for member in self.members:
+                if member.append_buffer(buffer, no_return=False) == False:
+                    res = False
+
+            if res == False:
+                self.status = False
+
+            if not no_return:
+                return res
+
     def supports_atmost(self):
         """
             This method can be called to determine whether the solver supports
@@ -22,14 +22,18 @@ except ImportError:
     from distutils.core import setup, Extension
     HAVE_SETUPTOOLS = False
 
+import distutils.ccompiler
+import distutils.cmd
 import distutils.command.build
 import distutils.command.build_ext
 import distutils.command.install
+import distutils.sysconfig
 
 import inspect, os, sys
 sys.path.insert(0, os.path.join(os.path.realpath(os.path.abspath(os.path.split(inspect.getfile(inspect.currentframe()))[0])), 'solvers/'))
 import platform
 import prepare
+import subprocess
 
 from pysat import __version__
 
@@ -160,13 +164,76 @@ pysolvers_ext = Extension('pysolvers',
     sources=pysolvers_sources,
     extra_compile_args=compile_flags + \
         list(map(lambda x: '-DWITH_{0}'.format(x.upper()), to_install)),
-    include_dirs=['solvers'],
+    include_dirs=['solvers', 'cardenc'],
     language='c++',
     libraries=libraries,
     library_dirs=library_dirs
 )
 
 
+# benchmarks of the encoders and the solver bindings
+#==============================================================================
+class bench(distutils.cmd.Command):
+    """
+        Run the benchmarks under benchmarks/, each of which prints its
+        results as JSON objects, one per line.
+    """
+
+    description = 'run the benchmarks of the encoders and the solver bindings'
+    user_options = [
+        ('output=', 'o', 'file to write the results to (default: stdout)'),
+        ('quick', 'q', 'run on small instances only')
+    ]
+    boolean_options = ['quick']
+
+    def initialize_options(self):
+        self.output = None
+        self.quick = 0
+
+    def finalize_options(self):
+        pass
+
+    def run(self):
+        """
+            Build the extensions in place and the driver of cardenc, and
+            then run both benchmarks.
+        """
+        build_ext = self.reinitialize_command('build_ext')
+        build_ext.inplace = 1
+        self.run_command('build_ext')
+
+        build_temp = self.get_finalized_command('build').build_temp
+        self.mkpath(build_temp)
+
+        # the driver includes the headers of cardenc directly
+        compiler = distutils.ccompiler.new_compiler()
+        distutils.sysconfig.customize_compiler(compiler)
+        objects = compiler.compile(['benchmarks/cardenc.cc'],
+                output_dir=build_temp, include_dirs=['cardenc'],
+                extra_postargs=compile_flags + ['-O2'])
+        compiler.link_executable(objects, 'bench_cardenc', output_dir=build_temp,
+                libraries=cpplib, target_lang='c++')
+
+        driver = os.path.join(build_temp, 'bench_cardenc')
+        if self.quick:
+            runs = [[driver, '1', '16,64', '1,2,8'],
+                    [sys.executable, 'benchmarks/solvers.py', '-v', '2000',
+                        '-R', '1', '-c', '10']]
+        else:
+            runs = [[driver], [sys.executable, 'benchmarks/solvers.py']]
+
+        env = dict(os.environ, PYTHONPATH=os.pathsep.join([ROOT,
+            os.environ.get('PYTHONPATH', '')]))
+        out = open(self.output, 'w') if self.output else None
+
+        try:
+            for args in runs:
+                subprocess.check_call(args, cwd=ROOT, env=env, stdout=out)
+        finally:
+            if out:
+                out.close()
+
+
 # finally, calling standard setuptools.setup() (or distutils.core.setup())
 #==============================================================================
 setup(name='python-sat',
@@ -182,7 +249,7 @@ setup(name='python-sat',
     url='https://github.com/pysathq/pysat',
     ext_modules=[pycard_ext, pysolvers_ext],
     scripts=['examples/{0}.py'.format(s) for s in scripts],
-    cmdclass={'build': build, 'build_ext': build_ext},
+    cmdclass={'build': build, 'build_ext': build_ext, 'bench': bench},
     install_requires=['six'],
     extras_require = {
         'aiger': ['py-aiger-cnf>=2.0.0'],
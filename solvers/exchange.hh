@@ -0,0 +1,205 @@
+/*
+ * exchange.hh
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef EXCHANGE_HH_
+#define EXCHANGE_HH_
+
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+// a pool of learnt clauses shared by solvers running in concurrent threads;
+// it is a ring of fixed-width slots, each guarded by a sequence lock: the
+// sequence number of a slot is odd while the slot is being written and it
+// encodes the ticket of the clause stored in it otherwise; neither writers
+// nor readers ever wait, i.e. a writer drops its clause if the slot is taken
+// by another writer and a reader skips the slots that were overwritten while
+// it was reading them, and so sharing is a best-effort affair
+//=============================================================================
+class ClauseExchange {
+public:
+	ClauseExchange(unsigned capacity, unsigned max_size)
+	: refs(1), ids(0), head(0), cap(capacity), width(max_size),
+	slots(capacity), lits(capacity * max_size)
+	{
+		for (size_t i = 0; i < slots.size(); ++i) {
+			slots[i].seq.store(0, memory_order_relaxed);
+			slots[i].size.store(0, memory_order_relaxed);
+			slots[i].lbd.store(0, memory_order_relaxed);
+			slots[i].owner.store(-1, memory_order_relaxed);
+		}
+
+		for (size_t i = 0; i < lits.size(); ++i)
+			lits[i].store(0, memory_order_relaxed);
+	}
+
+	// the pool is deleted once the last of its users releases it
+	void retain() { refs.fetch_add(1, memory_order_relaxed); }
+
+	void release()
+	{
+		if (refs.fetch_sub(1, memory_order_acq_rel) == 1)
+			delete this;
+	}
+
+	// a fresh identifier of a solver joining the pool
+	int join() { return ids.fetch_add(1, memory_order_relaxed); }
+
+	// the ticket to be given to the next clause
+	uint64_t tail() const { return head.load(memory_order_acquire); }
+
+	unsigned capacity() const { return cap; }
+
+	unsigned max_size() const { return width; }
+
+	// publish a clause of at most max_size() literals; returns false if the
+	// clause was dropped because its slot was busy
+	bool put(int owner, const int *cl, int size, int lbd)
+	{
+		if (size <= 0 || (unsigned)size > width)
+			return false;
+
+		uint64_t ticket = head.fetch_add(1, memory_order_relaxed);
+		Slot& slot = slots[ticket % cap];
+
+		// the slot can only be claimed if it holds an older clause
+		uint64_t seq = slot.seq.load(memory_order_relaxed);
+		if ((seq & 1) || seq >= 2 * ticket + 2 ||
+				!slot.seq.compare_exchange_strong(seq, 2 * ticket + 1,
+					memory_order_acquire, memory_order_relaxed))
+			return false;
+		atomic_thread_fence(memory_order_release);
+
+		atomic<int> *dst = &lits[(ticket % cap) * width];
+		for (int i = 0; i < size; ++i)
+			dst[i].store(cl[i], memory_order_relaxed);
+
+		slot.size.store(size, memory_order_relaxed);
+		slot.lbd.store(lbd, memory_order_relaxed);
+		slot.owner.store(owner, memory_order_relaxed);
+		slot.seq.store(2 * ticket + 2, memory_order_release);
+		return true;
+	}
+
+	// read the clause of a given ticket published by a solver other than
+	// the reader into a buffer; returns 1 if the clause was read, 0 if it
+	// is unavailable for good (i.e. it was dropped, overwritten, or it is
+	// the reader's own clause), and -1 if it is still being written
+	int get(int reader, uint64_t ticket, vector<int>& cl, int& lbd) const
+	{
+		const Slot& slot = slots[ticket % cap];
+
+		uint64_t seq = slot.seq.load(memory_order_acquire);
+		if (seq == 2 * ticket + 1)
+			return -1;
+		if (seq != 2 * ticket + 2)
+			return 0;
+
+		int owner = slot.owner.load(memory_order_relaxed);
+		int size  = slot.size.load(memory_order_relaxed);
+		lbd = slot.lbd.load(memory_order_relaxed);
+
+		// a torn read is detected below but it must stay within the slot
+		if (size < 0 || (unsigned)size > width)
+			return 0;
+
+		const atomic<int> *src = &lits[(ticket % cap) * width];
+		cl.resize(size);
+		for (int i = 0; i < size; ++i)
+			cl[i] = src[i].load(memory_order_relaxed);
+
+		// the slot must not have been reused while it was being read
+		atomic_thread_fence(memory_order_acquire);
+		if (slot.seq.load(memory_order_relaxed) != seq)
+			return 0;
+
+		return owner != reader;
+	}
+private:
+	~ClauseExchange() {}
+
+	struct Slot {
+		atomic<uint64_t> seq;
+		atomic<int> size;
+		atomic<int> lbd;
+		atomic<int> owner;
+	};
+
+	atomic<int> refs;
+	atomic<int> ids;
+	atomic<uint64_t> head;
+	unsigned cap;
+	unsigned width;
+	vector<Slot> slots;
+	vector<atomic<int> > lits;
+};
+
+// the view of a pool taken by one of the solvers sharing it; this is what
+// the 'exchange' pointer of a patched solver points to
+//=============================================================================
+class ExchangeMember {
+public:
+	ExchangeMember(ClauseExchange *exchange, int max_lbd)
+	: pool(exchange), max_lbd(max_lbd)
+	{
+		pool->retain();
+		id = pool->join();
+
+		// only the clauses learnt from now on are imported
+		cursor = pool->tail();
+	}
+
+	~ExchangeMember()
+	{
+		pool->release();
+	}
+
+	// the callback used by a solver to export a learnt clause
+	static void put(void *member, const int *cl, int size, int lbd)
+	{
+		ExchangeMember *m = (ExchangeMember *)member;
+
+		if (lbd <= m->max_lbd)
+			m->pool->put(m->id, cl, size, lbd);
+	}
+
+	// the callback used by a solver to import the next clause; returns the
+	// size of the clause or -1 if there is nothing left to import for now
+	static int get(void *member, const int **cl, int *lbd)
+	{
+		ExchangeMember *m = (ExchangeMember *)member;
+		uint64_t tail = m->pool->tail();
+
+		// the clauses we were lapped on are lost
+		if (tail - m->cursor > m->pool->capacity())
+			m->cursor = tail - m->pool->capacity();
+
+		while (m->cursor < tail) {
+			int res = m->pool->get(m->id, m->cursor, m->buffer, *lbd);
+			if (res < 0)
+				break;
+
+			++m->cursor;
+
+			if (res > 0) {
+				*cl = m->buffer.data();
+				return (int)m->buffer.size();
+			}
+		}
+
+		return -1;
+	}
+private:
+	ClauseExchange *pool;
+	int id;
+	int max_lbd;
+	uint64_t cursor;
+	vector<int> buffer;
+};
+
+#endif // EXCHANGE_HH_
@@ -485,7 +485,8 @@ to_remove = {
         'doc',
         'mtl/config.mk',
         'mtl/template.mk',
-        'simp',
+        'simp/Main.cc',
+        'simp/Makefile',
         'utils/Makefile',
         'LICENSE',
         'README'
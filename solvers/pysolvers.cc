@@ -11,10 +11,21 @@
 
 #define PY_SSIZE_T_CLEAN
 
+// Glucose 4.1 and Gluecard 4.1 are compiled in the incremental mode, which
+// changes the layout of their clauses (these are read when cloning a solver)
+#ifndef INCREMENTAL
+#define INCREMENTAL
+#endif
+
 #include <Python.h>
-#include <setjmp.h>
+#include <climits>
 #include <signal.h>
 #include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #ifdef WITH_CADICAL
@@ -63,12 +74,17 @@
 
 #ifdef WITH_MINISAT22
 #include "minisat22/core/Solver.h"
+#include "minisat22/simp/SimpSolver.h"
 #endif
 
 #ifdef WITH_MINISATGH
 #include "minisatgh/core/Solver.h"
 #endif
 
+// included after the solvers, as std::hash would clash with their hash()
+#include "rc2.hh"
+#include "exchange.hh"
+
 using namespace std;
 
 // docstrings
@@ -76,39 +92,505 @@ using namespace std;
 static char    module_docstring[] = "This module provides a wrapper interface "
 				    "for several SAT solvers.";
 static char       new_docstring[] = "Create a new solver object.";
+static char     clone_docstring[] = "Copy a solver object, optionally with its learnt clauses, activities and phases.";
 static char     addcl_docstring[] = "Add a clause to formula.";
 static char     addam_docstring[] = "Add an atmost constraint to formula "
 				    "(for Minicard only).";
+static char    addbuf_docstring[] = "Add a zero-terminated buffer of clauses to formula.";
 static char     solve_docstring[] = "Solve a given CNF instance.";
 static char       lim_docstring[] = "Solve a given CNF instance within a budget.";
+static char      sbat_docstring[] = "Solve a given CNF instance under each of a number of assumption sets.";
+static char      musx_docstring[] = "Extract an MUS over a given list of selectors.";
 static char      prop_docstring[] = "Propagate a given set of literals.";
+static char      pbat_docstring[] = "Propagate each of a number of sets of literals.";
 static char    phases_docstring[] = "Set variable polarities.";
 static char   cbudget_docstring[] = "Set limit on the number of conflicts.";
 static char   pbudget_docstring[] = "Set limit on the number of propagations.";
-static char interrupt_docstring[] = "Interrupt SAT solver execution (not supported by lingeling and CaDiCaL).";
+static char   mbudget_docstring[] = "Set limit on the size of the clause database.";
+static char interrupt_docstring[] = "Interrupt SAT solver execution.";
 static char  clearint_docstring[] = "Clear interrupt indicator flag.";
 static char   setincr_docstring[] = "Set incremental mode (for Glucose3 only).";
 static char   tracepr_docstring[] = "Trace resolution proof.";
 static char      core_docstring[] = "Get an unsatisfiable core if formula is UNSAT.";
 static char     model_docstring[] = "Get a model if formula is SAT.";
+static char      mbuf_docstring[] = "Get a model as a buffer of int8 signs if formula is SAT.";
+static char      cbuf_docstring[] = "Get an unsatisfiable core as a buffer of int32 literals.";
+static char      enum_docstring[] = "Enumerate a batch of models, blocking each of them.";
 static char     nvars_docstring[] = "Get number of variables used by the solver.";
 static char      ncls_docstring[] = "Get number of clauses used by the solver.";
 static char       del_docstring[] = "Delete a previously created solver object.";
 static char  acc_stat_docstring[] = "Get accumulated stats from the solver.";
+static char    memory_docstring[] = "Get the memory used by the solver.";
+static char    reduce_docstring[] = "Reduce the set of learnt clauses.";
+static char     share_docstring[] = "Share learnt clauses through a pool (or stop sharing them).";
+static char   learnts_docstring[] = "Pass batches of learnt clauses to a callback (or stop doing so).";
+static char  progress_docstring[] = "Report the statistics of the solver to a callback every few conflicts.";
+static char    freeze_docstring[] = "Protect variables from (or expose them to) elimination.";
+static char      elim_docstring[] = "Run variable elimination on the current formula.";
+static char     exnew_docstring[] = "Create a pool of learnt clauses to be shared by several solvers.";
+static char      race_docstring[] = "Race several solvers in native threads.";
+static char    rc2new_docstring[] = "Create an RC2 engine working on a given solver.";
+static char    rc2add_docstring[] = "Add a soft clause selector to an RC2 engine.";
+static char    rc2cmp_docstring[] = "Run the core-guided loop of an RC2 engine.";
+static char      minz_docstring[] = "Trim and minimize an unsatisfiable core of assumptions.";
+static char     timer_docstring[] = "Enable or disable timing of the calls to a solver.";
 
 static PyObject *SATError;
-static jmp_buf env;
+
+// interruption state of a solver called from the main thread; instead of
+// jumping out of the solver, SIGINT is delivered through its interrupt hook
+//=============================================================================
+typedef struct {
+	void (*interrupt)(void *);  // backend-specific interrupt function
+	void *solver;               // the solver object to interrupt
+	volatile sig_atomic_t caught;
+} SigIntState;
+
+static SigIntState *volatile sigint_state = NULL;
+
+// timed entry points of the solver wrappers, named after the Python methods
+//=============================================================================
+enum TimedCall {
+	TC_ADD_CL = 0, TC_ADD_AM, TC_ADD_BUF, TC_SOLVE, TC_SOLVE_LIM,
+	TC_SOLVE_BATCH, TC_MUS, TC_PROPAGATE, TC_PROPAGATE_BATCH, TC_PHASES,
+	TC_CORE, TC_MODEL, TC_CORE_BUF, TC_MODEL_BUF, TC_ENUM, TC_MINZ, TC_NOF
+};
+
+static const char *timed_names[TC_NOF] = {
+	"add_clause", "add_atmost", "append_buffer", "solve",
+	"solve_limited", "solve_batch", "extract_mus", "propagate",
+	"propagate_batch", "set_phases", "get_core", "get_model",
+	"get_core_buffer", "get_model_buffer", "enum_models_buffer",
+	"minimize_core"
+};
+
+// cumulative counters of a solver whose calls are timed; the time spent in
+// a wrapper minus the time spent inside the solver itself is the cost of
+// translating the arguments and the results between Python and C++
+//=============================================================================
+typedef struct {
+	unsigned long long calls [TC_NOF];
+	unsigned long long total [TC_NOF];  // nanoseconds spent in the wrapper
+	unsigned long long solver[TC_NOF];  // nanoseconds spent in the solver
+} CallStats;
+
+// the table is indexed by solver pointers and, as it is only accessed with
+// the GIL held, it needs no lock; it is empty unless timing is enabled
+static unordered_map<void *, CallStats> call_stats;
+
+// interruption flags of Lingeling solvers, which have no interrupt() of their
+// own and poll them through their termination hook; a flag stays raised until
+// it is cleared, as in MiniSat; the table is only accessed with the GIL held,
+// and so a call takes the address of its flag before releasing the GIL and
+// polls it through that address only, which stays valid until the solver is
+// deleted, as rehashing does not move the elements of an unordered_map
+static unordered_map<void *, volatile sig_atomic_t> interrupt_flags;
+
+// timing of a single call to a wrapper, which is recorded on destruction;
+// enter() and leave() may be called with the GIL released
+//=============================================================================
+class CallTimer {
+public:
+	CallTimer(void *solver, TimedCall call)
+	: s(solver), call(call), on(false), start(0), mark(0), inside(0)
+	{
+		if (!call_stats.empty() && call_stats.count(s)) {
+			on = true;
+			start = now();
+		}
+	}
+
+	~CallTimer()
+	{
+		if (!on)
+			return;
+
+		// timing may have been disabled in the meantime
+		unordered_map<void *, CallStats>::iterator it = call_stats.find(s);
+		if (it == call_stats.end())
+			return;
+
+		it->second.calls [call] += 1;
+		it->second.total [call] += now() - start;
+		it->second.solver[call] += inside;
+	}
+
+	void enter()
+	{
+		if (on)
+			mark = now();
+	}
+
+	void leave()
+	{
+		if (on)
+			inside += now() - mark;
+	}
+private:
+	static unsigned long long now()
+	{
+		return chrono::duration_cast<chrono::nanoseconds>(
+				chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void *s;
+	TimedCall call;
+	bool on;
+	unsigned long long start;
+	unsigned long long mark;
+	unsigned long long inside;
+};
+
+// a backend taking part in a portfolio race; the solving function returns
+// 10 (SAT), 20 (UNSAT), or 0 if the solver was stopped before answering
+//=============================================================================
+typedef struct {
+	const char *name;  // the prefix of the backend's functions
+	int (*solve)(void *, const vector<int>&, int, volatile sig_atomic_t *);
+	void (*interrupt)(void *);  // NULL if the solver polls the stop flag
+	void (*clear)(void *);      // NULL if there is nothing to clear
+} RaceBackend;
+
+// the API shared by the MiniSat-like solvers is generated from a traits
+// struct of each solver, which names its types and its literal functions;
+// this way, a fast path added to the adapter benefits all of the solvers
+//=============================================================================
+class SolverCallbacks;
+
+template <class T>
+struct MinisatAdapter {
+	typedef typename T::Solver   Solver;
+	typedef typename T::Lit      Lit;
+	typedef typename T::lbool    lbool;
+	typedef typename T::Lits     Lits;
+	typedef typename T::Model    Model;
+	typedef typename T::Conflict Conflict;
+	typedef typename T::Polarity Polarity;
+
+	// auxiliary functions, also used by the portfolio and the RC2 engine
+	static void declare_vars(Solver *s, const int max_id);
+	static void sigint  (void *s);
+	static void clearint(void *s);
+	static int  race    (void *ptr, const vector<int>& assumps, int max_var,
+			volatile sig_atomic_t *stop);
+	static void rc2_add  (void *ptr, const vector<int>& cl);
+	static int  rc2_solve(void *ptr, const vector<int>& assumps, int64_t budget);
+	static void rc2_core (void *ptr, const vector<int>& assumps,
+			vector<int>& core);
+	static void rc2_model(void *ptr, vector<int>& model);
+	static bool iterate(PyObject *obj, Lits& v, int& max_var);
+	static bool active (Solver *s, const Lits& v);
+	static bool active (Solver *s, const int *lits, size_t size);
+	static int  check(Solver *s, Lits& a, int64_t budget);
+	static PyObject *stats(void *s);
+
+	// callbacks of the solvers patched for clause exchange
+	static SolverCallbacks *callbacks(Solver *s);
+	static void release(Solver *s);
+	static bool finish (Solver *s);
+
+	// functions available in module
+	static PyObject *py_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_add_cls_buffer (PyObject *, PyObject *);
+	static PyObject *py_solve     (PyObject *, PyObject *);
+	static PyObject *py_solve_lim (PyObject *, PyObject *);
+	static PyObject *py_solve_batch (PyObject *, PyObject *);
+	static PyObject *py_extract_mus (PyObject *, PyObject *);
+	static PyObject *py_propagate (PyObject *, PyObject *);
+	static PyObject *py_propagate_batch (PyObject *, PyObject *);
+	static PyObject *py_setphases (PyObject *, PyObject *);
+	static PyObject *py_cbudget   (PyObject *, PyObject *);
+	static PyObject *py_pbudget   (PyObject *, PyObject *);
+	static PyObject *py_mbudget   (PyObject *, PyObject *);
+	static PyObject *py_interrupt (PyObject *, PyObject *);
+	static PyObject *py_clearint  (PyObject *, PyObject *);
+	static PyObject *py_core      (PyObject *, PyObject *);
+	static PyObject *py_model     (PyObject *, PyObject *);
+	static PyObject *py_core_buffer (PyObject *, PyObject *);
+	static PyObject *py_model_buffer (PyObject *, PyObject *);
+	static PyObject *py_enum_models  (PyObject *, PyObject *);
+	static PyObject *py_nof_vars  (PyObject *, PyObject *);
+	static PyObject *py_nof_cls   (PyObject *, PyObject *);
+	static PyObject *py_acc_stats (PyObject *, PyObject *);
+	static PyObject *py_memory    (PyObject *, PyObject *);
+	static PyObject *py_reduce    (PyObject *, PyObject *);
+	static PyObject *py_learnts   (PyObject *, PyObject *);
+	static PyObject *py_progress  (PyObject *, PyObject *);
+};
+
+// traits of the MiniSat-like solvers
+//=============================================================================
+#ifdef WITH_GLUECARD30
+struct Gluecard30Traits {
+	typedef Gluecard30::Solver Solver;
+	typedef Gluecard30::Lit Lit;
+	typedef Gluecard30::lbool lbool;
+	typedef Gluecard30::vec<Gluecard30::Lit> Lits;
+	typedef Gluecard30::vec<Gluecard30::lbool> Model;
+	typedef Gluecard30::vec<Gluecard30::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Gluecard30::mkLit(v, neg); }
+	static int var(Lit p) { return Gluecard30::var(p); }
+	static bool sign(Lit p) { return Gluecard30::sign(p); }
+	static int toInt(lbool b) { return Gluecard30::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<Gluecard30Traits> Gluecard30Api;
+#endif
+
+#ifdef WITH_GLUECARD41
+struct Gluecard41Traits {
+	typedef Gluecard41::Solver Solver;
+	typedef Gluecard41::Lit Lit;
+	typedef Gluecard41::lbool lbool;
+	typedef Gluecard41::vec<Gluecard41::Lit> Lits;
+	typedef Gluecard41::vec<Gluecard41::lbool> Model;
+	typedef Gluecard41::vec<Gluecard41::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Gluecard41::mkLit(v, neg); }
+	static int var(Lit p) { return Gluecard41::var(p); }
+	static bool sign(Lit p) { return Gluecard41::sign(p); }
+	static int toInt(lbool b) { return Gluecard41::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<Gluecard41Traits> Gluecard41Api;
+#endif
+
+#ifdef WITH_GLUCOSE30
+struct Glucose30Traits {
+	typedef Glucose30::Solver Solver;
+	typedef Glucose30::Lit Lit;
+	typedef Glucose30::lbool lbool;
+	typedef Glucose30::vec<Glucose30::Lit> Lits;
+	typedef Glucose30::vec<Glucose30::lbool> Model;
+	typedef Glucose30::vec<Glucose30::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Glucose30::mkLit(v, neg); }
+	static int var(Lit p) { return Glucose30::var(p); }
+	static bool sign(Lit p) { return Glucose30::sign(p); }
+	static int toInt(lbool b) { return Glucose30::toInt(b); }
+	static void *exchange(Solver *s) { return s->exchange; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<Glucose30Traits> Glucose30Api;
+#endif
+
+#ifdef WITH_GLUCOSE41
+struct Glucose41Traits {
+	typedef Glucose41::Solver Solver;
+	typedef Glucose41::Lit Lit;
+	typedef Glucose41::lbool lbool;
+	typedef Glucose41::vec<Glucose41::Lit> Lits;
+	typedef Glucose41::vec<Glucose41::lbool> Model;
+	typedef Glucose41::vec<Glucose41::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Glucose41::mkLit(v, neg); }
+	static int var(Lit p) { return Glucose41::var(p); }
+	static bool sign(Lit p) { return Glucose41::sign(p); }
+	static int toInt(lbool b) { return Glucose41::toInt(b); }
+	static void *exchange(Solver *s) { return s->exchange; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<Glucose41Traits> Glucose41Api;
+#endif
+
+#ifdef WITH_MAPLECHRONO
+struct MapleChronoTraits {
+	typedef MapleChrono::Solver Solver;
+	typedef MapleChrono::Lit Lit;
+	typedef MapleChrono::lbool lbool;
+	typedef MapleChrono::vec<MapleChrono::Lit> Lits;
+	typedef MapleChrono::vec<MapleChrono::lbool> Model;
+	typedef MapleChrono::vec<MapleChrono::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return MapleChrono::mkLit(v, neg); }
+	static int var(Lit p) { return MapleChrono::var(p); }
+	static bool sign(Lit p) { return MapleChrono::sign(p); }
+	static int toInt(lbool b) { return MapleChrono::toInt(b); }
+	static void *exchange(Solver *s) { return s->exchange; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MapleChronoTraits> MapleChronoApi;
+#endif
+
+#ifdef WITH_MAPLECM
+struct MapleCMTraits {
+	typedef MapleCM::Solver Solver;
+	typedef MapleCM::Lit Lit;
+	typedef MapleCM::lbool lbool;
+	typedef MapleCM::vec<MapleCM::Lit> Lits;
+	typedef MapleCM::vec<MapleCM::lbool> Model;
+	typedef MapleCM::vec<MapleCM::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return MapleCM::mkLit(v, neg); }
+	static int var(Lit p) { return MapleCM::var(p); }
+	static bool sign(Lit p) { return MapleCM::sign(p); }
+	static int toInt(lbool b) { return MapleCM::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MapleCMTraits> MapleCMApi;
+#endif
+
+#ifdef WITH_MAPLESAT
+struct MaplesatTraits {
+	typedef Maplesat::Solver Solver;
+	typedef Maplesat::Lit Lit;
+	typedef Maplesat::lbool lbool;
+	typedef Maplesat::vec<Maplesat::Lit> Lits;
+	typedef Maplesat::vec<Maplesat::lbool> Model;
+	typedef Maplesat::vec<Maplesat::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Maplesat::mkLit(v, neg); }
+	static int var(Lit p) { return Maplesat::var(p); }
+	static bool sign(Lit p) { return Maplesat::sign(p); }
+	static int toInt(lbool b) { return Maplesat::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MaplesatTraits> MaplesatApi;
+#endif
+
+#ifdef WITH_MERGESAT3
+struct MergeSat3Traits {
+	typedef MergeSat3::Solver Solver;
+	typedef MergeSat3::Lit Lit;
+	typedef MergeSat3::lbool lbool;
+	typedef MergeSat3::vec<MergeSat3::Lit> Lits;
+	typedef MergeSat3::vec<MergeSat3::lbool> Model;
+	typedef MergeSat3::vec<MergeSat3::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return MergeSat3::mkLit(v, neg); }
+	static int var(Lit p) { return MergeSat3::var(p); }
+	static bool sign(Lit p) { return MergeSat3::sign(p); }
+	static int toInt(lbool b) { return MergeSat3::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MergeSat3Traits> MergeSat3Api;
+#endif
+
+#ifdef WITH_MINICARD
+struct MinicardTraits {
+	typedef Minicard::Solver Solver;
+	typedef Minicard::Lit Lit;
+	typedef Minicard::lbool lbool;
+	typedef Minicard::vec<Minicard::Lit> Lits;
+	typedef Minicard::vec<Minicard::lbool> Model;
+	typedef Minicard::vec<Minicard::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Minicard::mkLit(v, neg); }
+	static int var(Lit p) { return Minicard::var(p); }
+	static bool sign(Lit p) { return Minicard::sign(p); }
+	static int toInt(lbool b) { return Minicard::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MinicardTraits> MinicardApi;
+#endif
+
+#ifdef WITH_MINISAT22
+struct Minisat22Traits {
+	typedef Minisat22::Solver Solver;
+	typedef Minisat22::Lit Lit;
+	typedef Minisat22::lbool lbool;
+	typedef Minisat22::vec<Minisat22::Lit> Lits;
+	typedef Minisat22::vec<Minisat22::lbool> Model;
+	typedef Minisat22::vec<Minisat22::Lit> Conflict;
+	typedef bool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return Minisat22::mkLit(v, neg); }
+	static int var(Lit p) { return Minisat22::var(p); }
+	static bool sign(Lit p) { return Minisat22::sign(p); }
+	static int toInt(lbool b) { return Minisat22::toInt(b); }
+	static void *exchange(Solver *s) { return s->exchange; }
+
+	// a simplifying solver is used through the interface of the core one
+	static void *simp(Solver *s)
+	{
+		return dynamic_cast<Minisat22::SimpSolver *>(s);
+	}
+
+	static bool eliminated(void *simp, int v)
+	{
+		return ((Minisat22::SimpSolver *)simp)->isEliminated(v);
+	}
+};
+
+typedef MinisatAdapter<Minisat22Traits> Minisat22Api;
+#endif
+
+#ifdef WITH_MINISATGH
+struct MinisatGHTraits {
+	typedef MinisatGH::Solver Solver;
+	typedef MinisatGH::Lit Lit;
+	typedef MinisatGH::lbool lbool;
+	typedef MinisatGH::vec<MinisatGH::Lit> Lits;
+	typedef MinisatGH::vec<MinisatGH::lbool> Model;
+	typedef MinisatGH::LSet Conflict;
+	typedef MinisatGH::lbool Polarity;
+
+	static Lit mkLit(int v, bool neg) { return MinisatGH::mkLit(v, neg); }
+	static int var(Lit p) { return MinisatGH::var(p); }
+	static bool sign(Lit p) { return MinisatGH::sign(p); }
+	static int toInt(lbool b) { return MinisatGH::toInt(b); }
+	static void *exchange(Solver *s) { return NULL; }
+	static void *simp(Solver *s) { return NULL; }
+	static bool eliminated(void *simp, int v) { return false; }
+};
+
+typedef MinisatAdapter<MinisatGHTraits> MinisatGHApi;
+#endif
 
 // function declaration for functions available in module
 //=============================================================================
 extern "C" {
 #ifdef WITH_CADICAL
 	static PyObject *py_cadical_new       (PyObject *, PyObject *);
+	static PyObject *py_cadical_clone     (PyObject *, PyObject *);
 	static PyObject *py_cadical_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_cadical_add_cls_buffer (PyObject *, PyObject *);
 	static PyObject *py_cadical_solve     (PyObject *, PyObject *);
+	static PyObject *py_cadical_solve_lim (PyObject *, PyObject *);
+	static PyObject *py_cadical_solve_batch (PyObject *, PyObject *);
+	static PyObject *py_cadical_interrupt (PyObject *, PyObject *);
+	static PyObject *py_cadical_clearint  (PyObject *, PyObject *);
+	static PyObject *py_cadical_extract_mus (PyObject *, PyObject *);
 	static PyObject *py_cadical_tracepr   (PyObject *, PyObject *);
 	static PyObject *py_cadical_core      (PyObject *, PyObject *);
 	static PyObject *py_cadical_model     (PyObject *, PyObject *);
+	static PyObject *py_cadical_core_buffer (PyObject *, PyObject *);
+	static PyObject *py_cadical_model_buffer (PyObject *, PyObject *);
+	static PyObject *py_cadical_enum_models  (PyObject *, PyObject *);
 	static PyObject *py_cadical_nof_vars  (PyObject *, PyObject *);
 	static PyObject *py_cadical_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_cadical_del       (PyObject *, PyObject *);
@@ -116,229 +598,103 @@ extern "C" {
 #endif
 #ifdef WITH_GLUECARD30
 	static PyObject *py_gluecard3_new       (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_gluecard3_clone     (PyObject *, PyObject *);
 	static PyObject *py_gluecard3_add_am    (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_solve     (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_propagate (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_setphases (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_interrupt (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_clearint  (PyObject *, PyObject *);
 	static PyObject *py_gluecard3_setincr   (PyObject *, PyObject *);
 	static PyObject *py_gluecard3_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_core      (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_model     (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_gluecard3_del       (PyObject *, PyObject *);
-	static PyObject *py_gluecard3_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_GLUECARD41
 	static PyObject *py_gluecard41_new       (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_gluecard41_clone     (PyObject *, PyObject *);
 	static PyObject *py_gluecard41_add_am    (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_solve     (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_propagate (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_setphases (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_interrupt (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_clearint  (PyObject *, PyObject *);
 	static PyObject *py_gluecard41_setincr   (PyObject *, PyObject *);
 	static PyObject *py_gluecard41_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_core      (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_model     (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_gluecard41_del       (PyObject *, PyObject *);
-	static PyObject *py_gluecard41_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_GLUCOSE30
 	static PyObject *py_glucose3_new       (PyObject *, PyObject *);
-	static PyObject *py_glucose3_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_glucose3_solve     (PyObject *, PyObject *);
-	static PyObject *py_glucose3_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_glucose3_propagate (PyObject *, PyObject *);
-	static PyObject *py_glucose3_setphases (PyObject *, PyObject *);
-	static PyObject *py_glucose3_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_glucose3_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_glucose3_interrupt (PyObject *, PyObject *);
-	static PyObject *py_glucose3_clearint  (PyObject *, PyObject *);
+	static PyObject *py_glucose3_clone     (PyObject *, PyObject *);
+	static PyObject *py_glucose3_share     (PyObject *, PyObject *);
 	static PyObject *py_glucose3_setincr   (PyObject *, PyObject *);
 	static PyObject *py_glucose3_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_glucose3_core      (PyObject *, PyObject *);
-	static PyObject *py_glucose3_model     (PyObject *, PyObject *);
-	static PyObject *py_glucose3_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_glucose3_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_glucose3_del       (PyObject *, PyObject *);
-	static PyObject *py_glucose3_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_GLUCOSE41
 	static PyObject *py_glucose41_new       (PyObject *, PyObject *);
-	static PyObject *py_glucose41_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_glucose41_solve     (PyObject *, PyObject *);
-	static PyObject *py_glucose41_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_glucose41_propagate (PyObject *, PyObject *);
-	static PyObject *py_glucose41_setphases (PyObject *, PyObject *);
-	static PyObject *py_glucose41_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_glucose41_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_glucose41_interrupt (PyObject *, PyObject *);
-	static PyObject *py_glucose41_clearint  (PyObject *, PyObject *);
+	static PyObject *py_glucose41_clone     (PyObject *, PyObject *);
+	static PyObject *py_glucose41_share     (PyObject *, PyObject *);
 	static PyObject *py_glucose41_setincr   (PyObject *, PyObject *);
 	static PyObject *py_glucose41_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_glucose41_core      (PyObject *, PyObject *);
-	static PyObject *py_glucose41_model     (PyObject *, PyObject *);
-	static PyObject *py_glucose41_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_glucose41_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_glucose41_del       (PyObject *, PyObject *);
-	static PyObject *py_glucose41_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_LINGELING
 	static PyObject *py_lingeling_new       (PyObject *, PyObject *);
 	static PyObject *py_lingeling_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_lingeling_add_cls_buffer (PyObject *, PyObject *);
 	static PyObject *py_lingeling_solve     (PyObject *, PyObject *);
+	static PyObject *py_lingeling_solve_lim (PyObject *, PyObject *);
+	static PyObject *py_lingeling_interrupt (PyObject *, PyObject *);
+	static PyObject *py_lingeling_clearint  (PyObject *, PyObject *);
 	static PyObject *py_lingeling_setphases (PyObject *, PyObject *);
 	static PyObject *py_lingeling_tracepr   (PyObject *, PyObject *);
 	static PyObject *py_lingeling_core      (PyObject *, PyObject *);
 	static PyObject *py_lingeling_model     (PyObject *, PyObject *);
+	static PyObject *py_lingeling_core_buffer (PyObject *, PyObject *);
+	static PyObject *py_lingeling_model_buffer (PyObject *, PyObject *);
+	static PyObject *py_lingeling_enum_models  (PyObject *, PyObject *);
 	static PyObject *py_lingeling_nof_vars  (PyObject *, PyObject *);
 	static PyObject *py_lingeling_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_lingeling_del       (PyObject *, PyObject *);
 	static PyObject *py_lingeling_acc_stats (PyObject *, PyObject *);
+	static PyObject *py_lingeling_memory    (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MAPLECHRONO
 	static PyObject *py_maplechrono_new       (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_solve     (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_propagate (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_setphases (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_interrupt (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_clearint  (PyObject *, PyObject *);
+	static PyObject *py_maplechrono_share     (PyObject *, PyObject *);
 	static PyObject *py_maplechrono_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_core      (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_model     (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_maplechrono_del       (PyObject *, PyObject *);
-	static PyObject *py_maplechrono_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MAPLECM
 	static PyObject *py_maplecm_new       (PyObject *, PyObject *);
-	static PyObject *py_maplecm_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_maplecm_solve     (PyObject *, PyObject *);
-	static PyObject *py_maplecm_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_maplecm_propagate (PyObject *, PyObject *);
-	static PyObject *py_maplecm_setphases (PyObject *, PyObject *);
-	static PyObject *py_maplecm_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplecm_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplecm_interrupt (PyObject *, PyObject *);
-	static PyObject *py_maplecm_clearint  (PyObject *, PyObject *);
 	static PyObject *py_maplecm_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_maplecm_core      (PyObject *, PyObject *);
-	static PyObject *py_maplecm_model     (PyObject *, PyObject *);
-	static PyObject *py_maplecm_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_maplecm_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_maplecm_del       (PyObject *, PyObject *);
-	static PyObject *py_maplecm_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MAPLESAT
 	static PyObject *py_maplesat_new       (PyObject *, PyObject *);
-	static PyObject *py_maplesat_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_maplesat_solve     (PyObject *, PyObject *);
-	static PyObject *py_maplesat_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_maplesat_propagate (PyObject *, PyObject *);
-	static PyObject *py_maplesat_setphases (PyObject *, PyObject *);
-	static PyObject *py_maplesat_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplesat_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_maplesat_interrupt (PyObject *, PyObject *);
-	static PyObject *py_maplesat_clearint  (PyObject *, PyObject *);
 	static PyObject *py_maplesat_tracepr   (PyObject *, PyObject *);
-	static PyObject *py_maplesat_core      (PyObject *, PyObject *);
-	static PyObject *py_maplesat_model     (PyObject *, PyObject *);
-	static PyObject *py_maplesat_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_maplesat_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_maplesat_del       (PyObject *, PyObject *);
-	static PyObject *py_maplesat_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MERGESAT3
 	static PyObject *py_mergesat3_new       (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_solve     (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_propagate (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_setphases (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_interrupt (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_clearint  (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_core      (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_model     (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_mergesat3_del       (PyObject *, PyObject *);
-	static PyObject *py_mergesat3_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MINICARD
 	static PyObject *py_minicard_new       (PyObject *, PyObject *);
-	static PyObject *py_minicard_add_cl    (PyObject *, PyObject *);
+	static PyObject *py_minicard_clone     (PyObject *, PyObject *);
 	static PyObject *py_minicard_add_am    (PyObject *, PyObject *);
-	static PyObject *py_minicard_solve     (PyObject *, PyObject *);
-	static PyObject *py_minicard_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_minicard_propagate (PyObject *, PyObject *);
-	static PyObject *py_minicard_setphases (PyObject *, PyObject *);
-	static PyObject *py_minicard_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_minicard_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_minicard_interrupt (PyObject *, PyObject *);
-	static PyObject *py_minicard_clearint  (PyObject *, PyObject *);
-	static PyObject *py_minicard_core      (PyObject *, PyObject *);
-	static PyObject *py_minicard_model     (PyObject *, PyObject *);
-	static PyObject *py_minicard_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_minicard_nof_cls   (PyObject *, PyObject *);
 	static PyObject *py_minicard_del       (PyObject *, PyObject *);
-	static PyObject *py_minicard_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MINISAT22
 	static PyObject *py_minisat22_new       (PyObject *, PyObject *);
-	static PyObject *py_minisat22_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_minisat22_solve     (PyObject *, PyObject *);
-	static PyObject *py_minisat22_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_minisat22_propagate (PyObject *, PyObject *);
-	static PyObject *py_minisat22_setphases (PyObject *, PyObject *);
-	static PyObject *py_minisat22_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_minisat22_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_minisat22_interrupt (PyObject *, PyObject *);
-	static PyObject *py_minisat22_clearint  (PyObject *, PyObject *);
-	static PyObject *py_minisat22_core      (PyObject *, PyObject *);
-	static PyObject *py_minisat22_model     (PyObject *, PyObject *);
-	static PyObject *py_minisat22_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_minisat22_nof_cls   (PyObject *, PyObject *);
+	static PyObject *py_minisat22_clone     (PyObject *, PyObject *);
+	static PyObject *py_minisat22_share     (PyObject *, PyObject *);
+	static PyObject *py_minisat22_freeze    (PyObject *, PyObject *);
+	static PyObject *py_minisat22_eliminate (PyObject *, PyObject *);
 	static PyObject *py_minisat22_del       (PyObject *, PyObject *);
-	static PyObject *py_minisat22_acc_stats (PyObject *, PyObject *);
 #endif
 #ifdef WITH_MINISATGH
 	static PyObject *py_minisatgh_new       (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_add_cl    (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_solve     (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_solve_lim (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_propagate (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_setphases (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_cbudget   (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_pbudget   (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_interrupt (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_clearint  (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_core      (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_model     (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_nof_vars  (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_nof_cls   (PyObject *, PyObject *);
+	static PyObject *py_minisatgh_clone     (PyObject *, PyObject *);
 	static PyObject *py_minisatgh_del       (PyObject *, PyObject *);
-	static PyObject *py_minisatgh_acc_stats (PyObject *, PyObject *);
 #endif
+	static PyObject *py_portfolio_solve(PyObject *, PyObject *);
+	static PyObject *py_rc2_new        (PyObject *, PyObject *);
+	static PyObject *py_rc2_add        (PyObject *, PyObject *);
+	static PyObject *py_rc2_compute    (PyObject *, PyObject *);
+	static PyObject *py_minimize_core  (PyObject *, PyObject *);
+	static PyObject *py_time_calls     (PyObject *, PyObject *);
+	static PyObject *py_exchange_new   (PyObject *, PyObject *);
 }
 
 // module specification
@@ -346,11 +702,21 @@ extern "C" {
 static PyMethodDef module_methods[] = {
 #ifdef WITH_CADICAL
 	{ "cadical_new",       py_cadical_new,       METH_VARARGS,      new_docstring },
+	{ "cadical_clone",     py_cadical_clone,     METH_VARARGS,    clone_docstring },
 	{ "cadical_add_cl",    py_cadical_add_cl,    METH_VARARGS,    addcl_docstring },
+	{ "cadical_add_cls_buffer", py_cadical_add_cls_buffer, METH_VARARGS, addbuf_docstring },
 	{ "cadical_solve",     py_cadical_solve,     METH_VARARGS,    solve_docstring },
+	{ "cadical_solve_lim", py_cadical_solve_lim, METH_VARARGS,      lim_docstring },
+	{ "cadical_solve_batch", py_cadical_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "cadical_interrupt", py_cadical_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "cadical_clearint",  py_cadical_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "cadical_extract_mus", py_cadical_extract_mus, METH_VARARGS, musx_docstring },
 	{ "cadical_tracepr",   py_cadical_tracepr,   METH_VARARGS,  tracepr_docstring },
 	{ "cadical_core",      py_cadical_core,      METH_VARARGS,     core_docstring },
 	{ "cadical_model",     py_cadical_model,     METH_VARARGS,    model_docstring },
+	{ "cadical_core_buffer", py_cadical_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "cadical_model_buffer", py_cadical_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "cadical_enum_models",  py_cadical_enum_models,  METH_VARARGS, enum_docstring },
 	{ "cadical_nof_vars",  py_cadical_nof_vars,  METH_VARARGS,    nvars_docstring },
 	{ "cadical_nof_cls",   py_cadical_nof_cls,   METH_VARARGS,     ncls_docstring },
 	{ "cadical_del",       py_cadical_del,       METH_VARARGS,      del_docstring },
@@ -358,229 +724,375 @@ static PyMethodDef module_methods[] = {
 #endif
 #ifdef WITH_GLUECARD30
 	{ "gluecard3_new",       py_gluecard3_new,       METH_VARARGS,       new_docstring },
-	{ "gluecard3_add_cl",    py_gluecard3_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "gluecard3_clone",     py_gluecard3_clone,     METH_VARARGS,     clone_docstring },
+	{ "gluecard3_add_cl",    Gluecard30Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "gluecard3_add_cls_buffer", Gluecard30Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
 	{ "gluecard3_add_am",    py_gluecard3_add_am,    METH_VARARGS,     addam_docstring },
-	{ "gluecard3_solve",     py_gluecard3_solve,     METH_VARARGS,     solve_docstring },
-	{ "gluecard3_solve_lim", py_gluecard3_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "gluecard3_propagate", py_gluecard3_propagate, METH_VARARGS,      prop_docstring },
-	{ "gluecard3_setphases", py_gluecard3_setphases, METH_VARARGS,    phases_docstring },
-	{ "gluecard3_cbudget",   py_gluecard3_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "gluecard3_pbudget",   py_gluecard3_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "gluecard3_interrupt", py_gluecard3_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "gluecard3_clearint",  py_gluecard3_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "gluecard3_solve",     Gluecard30Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "gluecard3_solve_lim", Gluecard30Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "gluecard3_solve_batch", Gluecard30Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "gluecard3_extract_mus", Gluecard30Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "gluecard3_propagate", Gluecard30Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "gluecard3_propagate_batch", Gluecard30Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "gluecard3_setphases", Gluecard30Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "gluecard3_cbudget",   Gluecard30Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "gluecard3_pbudget",   Gluecard30Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "gluecard3_mbudget",   Gluecard30Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "gluecard3_interrupt", Gluecard30Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "gluecard3_clearint",  Gluecard30Api::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "gluecard3_setincr",   py_gluecard3_setincr,   METH_VARARGS,   setincr_docstring },
 	{ "gluecard3_tracepr",   py_gluecard3_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "gluecard3_core",      py_gluecard3_core,      METH_VARARGS,      core_docstring },
-	{ "gluecard3_model",     py_gluecard3_model,     METH_VARARGS,     model_docstring },
-	{ "gluecard3_nof_vars",  py_gluecard3_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "gluecard3_nof_cls",   py_gluecard3_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "gluecard3_core",      Gluecard30Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "gluecard3_model",     Gluecard30Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "gluecard3_core_buffer", Gluecard30Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "gluecard3_model_buffer", Gluecard30Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "gluecard3_enum_models",  Gluecard30Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "gluecard3_nof_vars",  Gluecard30Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "gluecard3_nof_cls",   Gluecard30Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "gluecard3_del",       py_gluecard3_del,       METH_VARARGS,       del_docstring },
-	{ "gluecard3_acc_stats", py_gluecard3_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "gluecard3_acc_stats", Gluecard30Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "gluecard3_memory",    Gluecard30Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "gluecard3_reduce",    Gluecard30Api::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_GLUECARD41
 	{ "gluecard41_new",       py_gluecard41_new,       METH_VARARGS,       new_docstring },
-	{ "gluecard41_add_cl",    py_gluecard41_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "gluecard41_clone",     py_gluecard41_clone,     METH_VARARGS,     clone_docstring },
+	{ "gluecard41_add_cl",    Gluecard41Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "gluecard41_add_cls_buffer", Gluecard41Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
 	{ "gluecard41_add_am",    py_gluecard41_add_am,    METH_VARARGS,     addam_docstring },
-	{ "gluecard41_solve",     py_gluecard41_solve,     METH_VARARGS,     solve_docstring },
-	{ "gluecard41_solve_lim", py_gluecard41_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "gluecard41_propagate", py_gluecard41_propagate, METH_VARARGS,      prop_docstring },
-	{ "gluecard41_setphases", py_gluecard41_setphases, METH_VARARGS,    phases_docstring },
-	{ "gluecard41_cbudget",   py_gluecard41_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "gluecard41_pbudget",   py_gluecard41_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "gluecard41_interrupt", py_gluecard41_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "gluecard41_clearint",  py_gluecard41_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "gluecard41_solve",     Gluecard41Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "gluecard41_solve_lim", Gluecard41Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "gluecard41_solve_batch", Gluecard41Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "gluecard41_extract_mus", Gluecard41Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "gluecard41_propagate", Gluecard41Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "gluecard41_propagate_batch", Gluecard41Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "gluecard41_setphases", Gluecard41Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "gluecard41_cbudget",   Gluecard41Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "gluecard41_pbudget",   Gluecard41Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "gluecard41_mbudget",   Gluecard41Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "gluecard41_interrupt", Gluecard41Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "gluecard41_clearint",  Gluecard41Api::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "gluecard41_setincr",   py_gluecard41_setincr,   METH_VARARGS,   setincr_docstring },
 	{ "gluecard41_tracepr",   py_gluecard41_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "gluecard41_core",      py_gluecard41_core,      METH_VARARGS,      core_docstring },
-	{ "gluecard41_model",     py_gluecard41_model,     METH_VARARGS,     model_docstring },
-	{ "gluecard41_nof_vars",  py_gluecard41_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "gluecard41_nof_cls",   py_gluecard41_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "gluecard41_core",      Gluecard41Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "gluecard41_model",     Gluecard41Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "gluecard41_core_buffer", Gluecard41Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "gluecard41_model_buffer", Gluecard41Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "gluecard41_enum_models",  Gluecard41Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "gluecard41_nof_vars",  Gluecard41Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "gluecard41_nof_cls",   Gluecard41Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "gluecard41_del",       py_gluecard41_del,       METH_VARARGS,       del_docstring },
-	{ "gluecard41_acc_stats", py_gluecard41_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "gluecard41_acc_stats", Gluecard41Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "gluecard41_memory",    Gluecard41Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "gluecard41_reduce",    Gluecard41Api::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_GLUCOSE30
 	{ "glucose3_new",       py_glucose3_new,       METH_VARARGS,       new_docstring },
-	{ "glucose3_add_cl",    py_glucose3_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "glucose3_solve",     py_glucose3_solve,     METH_VARARGS,     solve_docstring },
-	{ "glucose3_solve_lim", py_glucose3_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "glucose3_propagate", py_glucose3_propagate, METH_VARARGS,      prop_docstring },
-	{ "glucose3_setphases", py_glucose3_setphases, METH_VARARGS,    phases_docstring },
-	{ "glucose3_cbudget",   py_glucose3_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "glucose3_pbudget",   py_glucose3_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "glucose3_interrupt", py_glucose3_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "glucose3_clearint",  py_glucose3_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "glucose3_clone",     py_glucose3_clone,     METH_VARARGS,     clone_docstring },
+	{ "glucose3_share",     py_glucose3_share,     METH_VARARGS,     share_docstring },
+	{ "glucose3_add_cl",    Glucose30Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "glucose3_add_cls_buffer", Glucose30Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "glucose3_solve",     Glucose30Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "glucose3_solve_lim", Glucose30Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "glucose3_solve_batch", Glucose30Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "glucose3_extract_mus", Glucose30Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "glucose3_propagate", Glucose30Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "glucose3_propagate_batch", Glucose30Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "glucose3_setphases", Glucose30Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "glucose3_cbudget",   Glucose30Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "glucose3_pbudget",   Glucose30Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "glucose3_mbudget",   Glucose30Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "glucose3_interrupt", Glucose30Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "glucose3_clearint",  Glucose30Api::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "glucose3_setincr",   py_glucose3_setincr,   METH_VARARGS,   setincr_docstring },
 	{ "glucose3_tracepr",   py_glucose3_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "glucose3_core",      py_glucose3_core,      METH_VARARGS,      core_docstring },
-	{ "glucose3_model",     py_glucose3_model,     METH_VARARGS,     model_docstring },
-	{ "glucose3_nof_vars",  py_glucose3_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "glucose3_nof_cls",   py_glucose3_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "glucose3_core",      Glucose30Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "glucose3_model",     Glucose30Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "glucose3_core_buffer", Glucose30Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "glucose3_model_buffer", Glucose30Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "glucose3_enum_models",  Glucose30Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "glucose3_nof_vars",  Glucose30Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "glucose3_nof_cls",   Glucose30Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "glucose3_del",       py_glucose3_del,       METH_VARARGS,       del_docstring },
-	{ "glucose3_acc_stats", py_glucose3_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "glucose3_acc_stats", Glucose30Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "glucose3_memory",    Glucose30Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "glucose3_reduce",    Glucose30Api::py_reduce,    METH_VARARGS,    reduce_docstring },
+	{ "glucose3_learnts",  Glucose30Api::py_learnts,  METH_VARARGS,  learnts_docstring },
+	{ "glucose3_progress", Glucose30Api::py_progress, METH_VARARGS, progress_docstring },
 #endif
 #ifdef WITH_GLUCOSE41
 	{ "glucose41_new",       py_glucose41_new,       METH_VARARGS,       new_docstring },
-	{ "glucose41_add_cl",    py_glucose41_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "glucose41_solve",     py_glucose41_solve,     METH_VARARGS,     solve_docstring },
-	{ "glucose41_solve_lim", py_glucose41_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "glucose41_propagate", py_glucose41_propagate, METH_VARARGS,      prop_docstring },
-	{ "glucose41_setphases", py_glucose41_setphases, METH_VARARGS,    phases_docstring },
-	{ "glucose41_cbudget",   py_glucose41_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "glucose41_pbudget",   py_glucose41_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "glucose41_interrupt", py_glucose41_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "glucose41_clearint",  py_glucose41_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "glucose41_clone",     py_glucose41_clone,     METH_VARARGS,     clone_docstring },
+	{ "glucose41_share",     py_glucose41_share,     METH_VARARGS,     share_docstring },
+	{ "glucose41_add_cl",    Glucose41Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "glucose41_add_cls_buffer", Glucose41Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "glucose41_solve",     Glucose41Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "glucose41_solve_lim", Glucose41Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "glucose41_solve_batch", Glucose41Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "glucose41_extract_mus", Glucose41Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "glucose41_propagate", Glucose41Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "glucose41_propagate_batch", Glucose41Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "glucose41_setphases", Glucose41Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "glucose41_cbudget",   Glucose41Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "glucose41_pbudget",   Glucose41Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "glucose41_mbudget",   Glucose41Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "glucose41_interrupt", Glucose41Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "glucose41_clearint",  Glucose41Api::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "glucose41_setincr",   py_glucose41_setincr,   METH_VARARGS,   setincr_docstring },
 	{ "glucose41_tracepr",   py_glucose41_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "glucose41_core",      py_glucose41_core,      METH_VARARGS,      core_docstring },
-	{ "glucose41_model",     py_glucose41_model,     METH_VARARGS,     model_docstring },
-	{ "glucose41_nof_vars",  py_glucose41_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "glucose41_nof_cls",   py_glucose41_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "glucose41_core",      Glucose41Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "glucose41_model",     Glucose41Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "glucose41_core_buffer", Glucose41Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "glucose41_model_buffer", Glucose41Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "glucose41_enum_models",  Glucose41Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "glucose41_nof_vars",  Glucose41Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "glucose41_nof_cls",   Glucose41Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "glucose41_del",       py_glucose41_del,       METH_VARARGS,       del_docstring },
-	{ "glucose41_acc_stats", py_glucose41_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "glucose41_acc_stats", Glucose41Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "glucose41_memory",    Glucose41Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "glucose41_reduce",    Glucose41Api::py_reduce,    METH_VARARGS,    reduce_docstring },
+	{ "glucose41_learnts",  Glucose41Api::py_learnts,  METH_VARARGS,  learnts_docstring },
+	{ "glucose41_progress", Glucose41Api::py_progress, METH_VARARGS, progress_docstring },
 #endif
 #ifdef WITH_LINGELING
 	{ "lingeling_new",       py_lingeling_new,       METH_VARARGS,      new_docstring },
 	{ "lingeling_add_cl",    py_lingeling_add_cl,    METH_VARARGS,    addcl_docstring },
+	{ "lingeling_add_cls_buffer", py_lingeling_add_cls_buffer, METH_VARARGS, addbuf_docstring },
 	{ "lingeling_solve",     py_lingeling_solve,     METH_VARARGS,    solve_docstring },
+	{ "lingeling_solve_lim", py_lingeling_solve_lim, METH_VARARGS,      lim_docstring },
+	{ "lingeling_interrupt", py_lingeling_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "lingeling_clearint",  py_lingeling_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "lingeling_setphases", py_lingeling_setphases, METH_VARARGS,   phases_docstring },
 	{ "lingeling_tracepr",   py_lingeling_tracepr,   METH_VARARGS,  tracepr_docstring },
 	{ "lingeling_core",      py_lingeling_core,      METH_VARARGS,     core_docstring },
 	{ "lingeling_model",     py_lingeling_model,     METH_VARARGS,    model_docstring },
+	{ "lingeling_core_buffer", py_lingeling_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "lingeling_model_buffer", py_lingeling_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "lingeling_enum_models",  py_lingeling_enum_models,  METH_VARARGS, enum_docstring },
 	{ "lingeling_nof_vars",  py_lingeling_nof_vars,  METH_VARARGS,    nvars_docstring },
 	{ "lingeling_nof_cls",   py_lingeling_nof_cls,   METH_VARARGS,     ncls_docstring },
 	{ "lingeling_del",       py_lingeling_del,       METH_VARARGS,      del_docstring },
 	{ "lingeling_acc_stats", py_lingeling_acc_stats, METH_VARARGS, acc_stat_docstring },
+	{ "lingeling_memory",    py_lingeling_memory,    METH_VARARGS,   memory_docstring },
 #endif
 #ifdef WITH_MAPLECHRONO
 	{ "maplechrono_new",       py_maplechrono_new,       METH_VARARGS,       new_docstring },
-	{ "maplechrono_add_cl",    py_maplechrono_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "maplechrono_solve",     py_maplechrono_solve,     METH_VARARGS,     solve_docstring },
-	{ "maplechrono_solve_lim", py_maplechrono_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "maplechrono_propagate", py_maplechrono_propagate, METH_VARARGS,      prop_docstring },
-	{ "maplechrono_setphases", py_maplechrono_setphases, METH_VARARGS,    phases_docstring },
-	{ "maplechrono_cbudget",   py_maplechrono_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "maplechrono_pbudget",   py_maplechrono_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "maplechrono_interrupt", py_maplechrono_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "maplechrono_clearint",  py_maplechrono_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "maplechrono_share",     py_maplechrono_share,     METH_VARARGS,     share_docstring },
+	{ "maplechrono_add_cl",    MapleChronoApi::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "maplechrono_add_cls_buffer", MapleChronoApi::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "maplechrono_solve",     MapleChronoApi::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "maplechrono_solve_lim", MapleChronoApi::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "maplechrono_solve_batch", MapleChronoApi::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "maplechrono_extract_mus", MapleChronoApi::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "maplechrono_propagate", MapleChronoApi::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "maplechrono_propagate_batch", MapleChronoApi::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "maplechrono_setphases", MapleChronoApi::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "maplechrono_cbudget",   MapleChronoApi::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "maplechrono_pbudget",   MapleChronoApi::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "maplechrono_mbudget",   MapleChronoApi::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "maplechrono_interrupt", MapleChronoApi::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "maplechrono_clearint",  MapleChronoApi::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "maplechrono_tracepr",   py_maplechrono_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "maplechrono_core",      py_maplechrono_core,      METH_VARARGS,      core_docstring },
-	{ "maplechrono_model",     py_maplechrono_model,     METH_VARARGS,     model_docstring },
-	{ "maplechrono_nof_vars",  py_maplechrono_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "maplechrono_nof_cls",   py_maplechrono_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "maplechrono_core",      MapleChronoApi::py_core,      METH_VARARGS,      core_docstring },
+	{ "maplechrono_model",     MapleChronoApi::py_model,     METH_VARARGS,     model_docstring },
+	{ "maplechrono_core_buffer", MapleChronoApi::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "maplechrono_model_buffer", MapleChronoApi::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "maplechrono_enum_models",  MapleChronoApi::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "maplechrono_nof_vars",  MapleChronoApi::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "maplechrono_nof_cls",   MapleChronoApi::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "maplechrono_del",       py_maplechrono_del,       METH_VARARGS,       del_docstring },
-	{ "maplechrono_acc_stats", py_maplechrono_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplechrono_acc_stats", MapleChronoApi::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplechrono_memory",    MapleChronoApi::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "maplechrono_reduce",    MapleChronoApi::py_reduce,    METH_VARARGS,    reduce_docstring },
+	{ "maplechrono_learnts",  MapleChronoApi::py_learnts,  METH_VARARGS,  learnts_docstring },
+	{ "maplechrono_progress", MapleChronoApi::py_progress, METH_VARARGS, progress_docstring },
 #endif
 #ifdef WITH_MAPLECM
 	{ "maplecm_new",       py_maplecm_new,       METH_VARARGS,       new_docstring },
-	{ "maplecm_add_cl",    py_maplecm_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "maplecm_solve",     py_maplecm_solve,     METH_VARARGS,     solve_docstring },
-	{ "maplecm_solve_lim", py_maplecm_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "maplecm_propagate", py_maplecm_propagate, METH_VARARGS,      prop_docstring },
-	{ "maplecm_setphases", py_maplecm_setphases, METH_VARARGS,    phases_docstring },
-	{ "maplecm_cbudget",   py_maplecm_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "maplecm_pbudget",   py_maplecm_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "maplecm_interrupt", py_maplecm_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "maplecm_clearint",  py_maplecm_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "maplecm_add_cl",    MapleCMApi::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "maplecm_add_cls_buffer", MapleCMApi::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "maplecm_solve",     MapleCMApi::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "maplecm_solve_lim", MapleCMApi::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "maplecm_solve_batch", MapleCMApi::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "maplecm_extract_mus", MapleCMApi::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "maplecm_propagate", MapleCMApi::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "maplecm_propagate_batch", MapleCMApi::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "maplecm_setphases", MapleCMApi::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "maplecm_cbudget",   MapleCMApi::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "maplecm_pbudget",   MapleCMApi::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "maplecm_mbudget",   MapleCMApi::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "maplecm_interrupt", MapleCMApi::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "maplecm_clearint",  MapleCMApi::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "maplecm_tracepr",   py_maplecm_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "maplecm_core",      py_maplecm_core,      METH_VARARGS,      core_docstring },
-	{ "maplecm_model",     py_maplecm_model,     METH_VARARGS,     model_docstring },
-	{ "maplecm_nof_vars",  py_maplecm_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "maplecm_nof_cls",   py_maplecm_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "maplecm_core",      MapleCMApi::py_core,      METH_VARARGS,      core_docstring },
+	{ "maplecm_model",     MapleCMApi::py_model,     METH_VARARGS,     model_docstring },
+	{ "maplecm_core_buffer", MapleCMApi::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "maplecm_model_buffer", MapleCMApi::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "maplecm_enum_models",  MapleCMApi::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "maplecm_nof_vars",  MapleCMApi::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "maplecm_nof_cls",   MapleCMApi::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "maplecm_del",       py_maplecm_del,       METH_VARARGS,       del_docstring },
-	{ "maplecm_acc_stats", py_maplecm_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplecm_acc_stats", MapleCMApi::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplecm_memory",    MapleCMApi::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "maplecm_reduce",    MapleCMApi::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_MAPLESAT
 	{ "maplesat_new",       py_maplesat_new,       METH_VARARGS,       new_docstring },
-	{ "maplesat_add_cl",    py_maplesat_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "maplesat_solve",     py_maplesat_solve,     METH_VARARGS,     solve_docstring },
-	{ "maplesat_solve_lim", py_maplesat_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "maplesat_propagate", py_maplesat_propagate, METH_VARARGS,      prop_docstring },
-	{ "maplesat_setphases", py_maplesat_setphases, METH_VARARGS,    phases_docstring },
-	{ "maplesat_cbudget",   py_maplesat_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "maplesat_pbudget",   py_maplesat_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "maplesat_interrupt", py_maplesat_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "maplesat_clearint",  py_maplesat_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "maplesat_add_cl",    MaplesatApi::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "maplesat_add_cls_buffer", MaplesatApi::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "maplesat_solve",     MaplesatApi::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "maplesat_solve_lim", MaplesatApi::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "maplesat_solve_batch", MaplesatApi::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "maplesat_extract_mus", MaplesatApi::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "maplesat_propagate", MaplesatApi::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "maplesat_propagate_batch", MaplesatApi::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "maplesat_setphases", MaplesatApi::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "maplesat_cbudget",   MaplesatApi::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "maplesat_pbudget",   MaplesatApi::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "maplesat_mbudget",   MaplesatApi::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "maplesat_interrupt", MaplesatApi::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "maplesat_clearint",  MaplesatApi::py_clearint,  METH_VARARGS,  clearint_docstring },
 	{ "maplesat_tracepr",   py_maplesat_tracepr,   METH_VARARGS,   tracepr_docstring },
-	{ "maplesat_core",      py_maplesat_core,      METH_VARARGS,      core_docstring },
-	{ "maplesat_model",     py_maplesat_model,     METH_VARARGS,     model_docstring },
-	{ "maplesat_nof_vars",  py_maplesat_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "maplesat_nof_cls",   py_maplesat_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "maplesat_core",      MaplesatApi::py_core,      METH_VARARGS,      core_docstring },
+	{ "maplesat_model",     MaplesatApi::py_model,     METH_VARARGS,     model_docstring },
+	{ "maplesat_core_buffer", MaplesatApi::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "maplesat_model_buffer", MaplesatApi::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "maplesat_enum_models",  MaplesatApi::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "maplesat_nof_vars",  MaplesatApi::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "maplesat_nof_cls",   MaplesatApi::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "maplesat_del",       py_maplesat_del,       METH_VARARGS,       del_docstring },
-	{ "maplesat_acc_stats", py_maplesat_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplesat_acc_stats", MaplesatApi::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "maplesat_memory",    MaplesatApi::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "maplesat_reduce",    MaplesatApi::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_MERGESAT3
 	{ "mergesat3_new",       py_mergesat3_new,       METH_VARARGS,       new_docstring },
-	{ "mergesat3_add_cl",    py_mergesat3_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "mergesat3_solve",     py_mergesat3_solve,     METH_VARARGS,     solve_docstring },
-	{ "mergesat3_solve_lim", py_mergesat3_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "mergesat3_propagate", py_mergesat3_propagate, METH_VARARGS,      prop_docstring },
-	{ "mergesat3_setphases", py_mergesat3_setphases, METH_VARARGS,    phases_docstring },
-	{ "mergesat3_cbudget",   py_mergesat3_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "mergesat3_pbudget",   py_mergesat3_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "mergesat3_interrupt", py_mergesat3_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "mergesat3_clearint",  py_mergesat3_clearint,  METH_VARARGS,  clearint_docstring },
-	{ "mergesat3_core",      py_mergesat3_core,      METH_VARARGS,      core_docstring },
-	{ "mergesat3_model",     py_mergesat3_model,     METH_VARARGS,     model_docstring },
-	{ "mergesat3_nof_vars",  py_mergesat3_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "mergesat3_nof_cls",   py_mergesat3_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "mergesat3_add_cl",    MergeSat3Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "mergesat3_add_cls_buffer", MergeSat3Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "mergesat3_solve",     MergeSat3Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "mergesat3_solve_lim", MergeSat3Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "mergesat3_solve_batch", MergeSat3Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "mergesat3_extract_mus", MergeSat3Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "mergesat3_propagate", MergeSat3Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "mergesat3_propagate_batch", MergeSat3Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "mergesat3_setphases", MergeSat3Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "mergesat3_cbudget",   MergeSat3Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "mergesat3_pbudget",   MergeSat3Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "mergesat3_mbudget",   MergeSat3Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "mergesat3_interrupt", MergeSat3Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "mergesat3_clearint",  MergeSat3Api::py_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "mergesat3_core",      MergeSat3Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "mergesat3_model",     MergeSat3Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "mergesat3_core_buffer", MergeSat3Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "mergesat3_model_buffer", MergeSat3Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "mergesat3_enum_models",  MergeSat3Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "mergesat3_nof_vars",  MergeSat3Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "mergesat3_nof_cls",   MergeSat3Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "mergesat3_del",       py_mergesat3_del,       METH_VARARGS,       del_docstring },
-	{ "mergesat3_acc_stats", py_mergesat3_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "mergesat3_acc_stats", MergeSat3Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "mergesat3_memory",    MergeSat3Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "mergesat3_reduce",    MergeSat3Api::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_MINICARD
 	{ "minicard_new",       py_minicard_new,       METH_VARARGS,       new_docstring },
-	{ "minicard_add_cl",    py_minicard_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "minicard_solve",     py_minicard_solve,     METH_VARARGS,     solve_docstring },
-	{ "minicard_solve_lim", py_minicard_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "minicard_propagate", py_minicard_propagate, METH_VARARGS,      prop_docstring },
-	{ "minicard_setphases", py_minicard_setphases, METH_VARARGS,    phases_docstring },
-	{ "minicard_cbudget",   py_minicard_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "minicard_pbudget",   py_minicard_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "minicard_interrupt", py_minicard_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "minicard_clearint",  py_minicard_clearint,  METH_VARARGS,  clearint_docstring },
-	{ "minicard_core",      py_minicard_core,      METH_VARARGS,      core_docstring },
-	{ "minicard_model",     py_minicard_model,     METH_VARARGS,     model_docstring },
-	{ "minicard_nof_vars",  py_minicard_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "minicard_nof_cls",   py_minicard_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "minicard_clone",     py_minicard_clone,     METH_VARARGS,     clone_docstring },
+	{ "minicard_add_cl",    MinicardApi::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "minicard_add_cls_buffer", MinicardApi::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "minicard_solve",     MinicardApi::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "minicard_solve_lim", MinicardApi::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "minicard_solve_batch", MinicardApi::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "minicard_extract_mus", MinicardApi::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "minicard_propagate", MinicardApi::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "minicard_propagate_batch", MinicardApi::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "minicard_setphases", MinicardApi::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "minicard_cbudget",   MinicardApi::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "minicard_pbudget",   MinicardApi::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "minicard_mbudget",   MinicardApi::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "minicard_interrupt", MinicardApi::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "minicard_clearint",  MinicardApi::py_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "minicard_core",      MinicardApi::py_core,      METH_VARARGS,      core_docstring },
+	{ "minicard_model",     MinicardApi::py_model,     METH_VARARGS,     model_docstring },
+	{ "minicard_core_buffer", MinicardApi::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "minicard_model_buffer", MinicardApi::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "minicard_enum_models",  MinicardApi::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "minicard_nof_vars",  MinicardApi::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "minicard_nof_cls",   MinicardApi::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "minicard_del",       py_minicard_del,       METH_VARARGS,       del_docstring },
 	{ "minicard_add_am",    py_minicard_add_am,    METH_VARARGS,     addam_docstring },
-	{ "minicard_acc_stats", py_minicard_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minicard_acc_stats", MinicardApi::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minicard_memory",    MinicardApi::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "minicard_reduce",    MinicardApi::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
 #ifdef WITH_MINISAT22
 	{ "minisat22_new",       py_minisat22_new,       METH_VARARGS,       new_docstring },
-	{ "minisat22_add_cl",    py_minisat22_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "minisat22_solve",     py_minisat22_solve,     METH_VARARGS,     solve_docstring },
-	{ "minisat22_solve_lim", py_minisat22_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "minisat22_propagate", py_minisat22_propagate, METH_VARARGS,      prop_docstring },
-	{ "minisat22_setphases", py_minisat22_setphases, METH_VARARGS,    phases_docstring },
-	{ "minisat22_cbudget",   py_minisat22_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "minisat22_pbudget",   py_minisat22_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "minisat22_interrupt", py_minisat22_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "minisat22_clearint",  py_minisat22_clearint,  METH_VARARGS,  clearint_docstring },
-	{ "minisat22_core",      py_minisat22_core,      METH_VARARGS,      core_docstring },
-	{ "minisat22_model",     py_minisat22_model,     METH_VARARGS,     model_docstring },
-	{ "minisat22_nof_vars",  py_minisat22_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "minisat22_nof_cls",   py_minisat22_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "minisat22_clone",     py_minisat22_clone,     METH_VARARGS,     clone_docstring },
+	{ "minisat22_share",     py_minisat22_share,     METH_VARARGS,     share_docstring },
+	{ "minisat22_freeze",    py_minisat22_freeze,    METH_VARARGS,    freeze_docstring },
+	{ "minisat22_eliminate", py_minisat22_eliminate, METH_VARARGS,      elim_docstring },
+	{ "minisat22_add_cl",    Minisat22Api::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "minisat22_add_cls_buffer", Minisat22Api::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "minisat22_solve",     Minisat22Api::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "minisat22_solve_lim", Minisat22Api::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "minisat22_solve_batch", Minisat22Api::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "minisat22_extract_mus", Minisat22Api::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "minisat22_propagate", Minisat22Api::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "minisat22_propagate_batch", Minisat22Api::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "minisat22_setphases", Minisat22Api::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "minisat22_cbudget",   Minisat22Api::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "minisat22_pbudget",   Minisat22Api::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "minisat22_mbudget",   Minisat22Api::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "minisat22_interrupt", Minisat22Api::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "minisat22_clearint",  Minisat22Api::py_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "minisat22_core",      Minisat22Api::py_core,      METH_VARARGS,      core_docstring },
+	{ "minisat22_model",     Minisat22Api::py_model,     METH_VARARGS,     model_docstring },
+	{ "minisat22_core_buffer", Minisat22Api::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "minisat22_model_buffer", Minisat22Api::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "minisat22_enum_models",  Minisat22Api::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "minisat22_nof_vars",  Minisat22Api::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "minisat22_nof_cls",   Minisat22Api::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "minisat22_del",       py_minisat22_del,       METH_VARARGS,       del_docstring },
-	{ "minisat22_acc_stats", py_minisat22_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minisat22_acc_stats", Minisat22Api::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minisat22_memory",    Minisat22Api::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "minisat22_reduce",    Minisat22Api::py_reduce,    METH_VARARGS,    reduce_docstring },
+	{ "minisat22_learnts",  Minisat22Api::py_learnts,  METH_VARARGS,  learnts_docstring },
+	{ "minisat22_progress", Minisat22Api::py_progress, METH_VARARGS, progress_docstring },
 #endif
 #ifdef WITH_MINISATGH
 	{ "minisatgh_new",       py_minisatgh_new,       METH_VARARGS,       new_docstring },
-	{ "minisatgh_add_cl",    py_minisatgh_add_cl,    METH_VARARGS,     addcl_docstring },
-	{ "minisatgh_solve",     py_minisatgh_solve,     METH_VARARGS,     solve_docstring },
-	{ "minisatgh_solve_lim", py_minisatgh_solve_lim, METH_VARARGS,       lim_docstring },
-	{ "minisatgh_propagate", py_minisatgh_propagate, METH_VARARGS,      prop_docstring },
-	{ "minisatgh_setphases", py_minisatgh_setphases, METH_VARARGS,    phases_docstring },
-	{ "minisatgh_cbudget",   py_minisatgh_cbudget,   METH_VARARGS,   cbudget_docstring },
-	{ "minisatgh_pbudget",   py_minisatgh_pbudget,   METH_VARARGS,   pbudget_docstring },
-	{ "minisatgh_interrupt", py_minisatgh_interrupt, METH_VARARGS, interrupt_docstring },
-	{ "minisatgh_clearint",  py_minisatgh_clearint,  METH_VARARGS,  clearint_docstring },
-	{ "minisatgh_core",      py_minisatgh_core,      METH_VARARGS,      core_docstring },
-	{ "minisatgh_model",     py_minisatgh_model,     METH_VARARGS,     model_docstring },
-	{ "minisatgh_nof_vars",  py_minisatgh_nof_vars,  METH_VARARGS,     nvars_docstring },
-	{ "minisatgh_nof_cls",   py_minisatgh_nof_cls,   METH_VARARGS,      ncls_docstring },
+	{ "minisatgh_clone",     py_minisatgh_clone,     METH_VARARGS,     clone_docstring },
+	{ "minisatgh_add_cl",    MinisatGHApi::py_add_cl,    METH_VARARGS,     addcl_docstring },
+	{ "minisatgh_add_cls_buffer", MinisatGHApi::py_add_cls_buffer, METH_VARARGS, addbuf_docstring },
+	{ "minisatgh_solve",     MinisatGHApi::py_solve,     METH_VARARGS,     solve_docstring },
+	{ "minisatgh_solve_lim", MinisatGHApi::py_solve_lim, METH_VARARGS,       lim_docstring },
+	{ "minisatgh_solve_batch", MinisatGHApi::py_solve_batch, METH_VARARGS, sbat_docstring },
+	{ "minisatgh_extract_mus", MinisatGHApi::py_extract_mus, METH_VARARGS, musx_docstring },
+	{ "minisatgh_propagate", MinisatGHApi::py_propagate, METH_VARARGS,      prop_docstring },
+	{ "minisatgh_propagate_batch", MinisatGHApi::py_propagate_batch, METH_VARARGS, pbat_docstring },
+	{ "minisatgh_setphases", MinisatGHApi::py_setphases, METH_VARARGS,    phases_docstring },
+	{ "minisatgh_cbudget",   MinisatGHApi::py_cbudget,   METH_VARARGS,   cbudget_docstring },
+	{ "minisatgh_pbudget",   MinisatGHApi::py_pbudget,   METH_VARARGS,   pbudget_docstring },
+	{ "minisatgh_mbudget",   MinisatGHApi::py_mbudget,   METH_VARARGS,   mbudget_docstring },
+	{ "minisatgh_interrupt", MinisatGHApi::py_interrupt, METH_VARARGS, interrupt_docstring },
+	{ "minisatgh_clearint",  MinisatGHApi::py_clearint,  METH_VARARGS,  clearint_docstring },
+	{ "minisatgh_core",      MinisatGHApi::py_core,      METH_VARARGS,      core_docstring },
+	{ "minisatgh_model",     MinisatGHApi::py_model,     METH_VARARGS,     model_docstring },
+	{ "minisatgh_core_buffer", MinisatGHApi::py_core_buffer, METH_VARARGS, cbuf_docstring },
+	{ "minisatgh_model_buffer", MinisatGHApi::py_model_buffer, METH_VARARGS, mbuf_docstring },
+	{ "minisatgh_enum_models",  MinisatGHApi::py_enum_models,  METH_VARARGS, enum_docstring },
+	{ "minisatgh_nof_vars",  MinisatGHApi::py_nof_vars,  METH_VARARGS,     nvars_docstring },
+	{ "minisatgh_nof_cls",   MinisatGHApi::py_nof_cls,   METH_VARARGS,      ncls_docstring },
 	{ "minisatgh_del",       py_minisatgh_del,       METH_VARARGS,       del_docstring },
-	{ "minisatgh_acc_stats", py_minisatgh_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minisatgh_acc_stats", MinisatGHApi::py_acc_stats, METH_VARARGS,  acc_stat_docstring },
+	{ "minisatgh_memory",    MinisatGHApi::py_memory,    METH_VARARGS,    memory_docstring },
+	{ "minisatgh_reduce",    MinisatGHApi::py_reduce,    METH_VARARGS,    reduce_docstring },
 #endif
+	{ "portfolio_solve", py_portfolio_solve, METH_VARARGS, race_docstring },
+	{ "rc2_new",         py_rc2_new,         METH_VARARGS, rc2new_docstring },
+	{ "rc2_add",         py_rc2_add,         METH_VARARGS, rc2add_docstring },
+	{ "rc2_compute",     py_rc2_compute,     METH_VARARGS, rc2cmp_docstring },
+	{ "minimize_core",   py_minimize_core,   METH_VARARGS, minz_docstring },
+	{ "time_calls",      py_time_calls,      METH_VARARGS, timer_docstring },
+	{ "exchange_new",    py_exchange_new,    METH_VARARGS, exnew_docstring },
 	{ NULL, NULL, 0, NULL }
 };
 
@@ -590,7 +1102,28 @@ extern "C" {
 //=============================================================================
 static void sigint_handler(int signum)
 {
-	longjmp(env, -1);
+	SigIntState *state = sigint_state;
+
+	if (state) {
+		state->caught = 1;
+		state->interrupt(state->solver);
+	}
+}
+
+// installing the handler for a solver call made from the main thread
+//=============================================================================
+static PyOS_sighandler_t sigint_install(SigIntState *state)
+{
+	sigint_state = state;
+	return PyOS_setsig(SIGINT, sigint_handler);
+}
+
+// restoring the previous handler once the call is over
+//=============================================================================
+static void sigint_restore(PyOS_sighandler_t handler)
+{
+	PyOS_setsig(SIGINT, handler);
+	sigint_state = NULL;
 }
 
 #if PY_MAJOR_VERSION >= 3
@@ -629,6 +1162,34 @@ static void *pyobj_to_void(PyObject *obj)
 	return PyCapsule_GetPointer(obj, NULL);
 }
 
+// capsule destructor of an RC2 engine
+//=============================================================================
+static void engine_free(PyObject *obj)
+{
+	delete (RC2Engine *)PyCapsule_GetPointer(obj, NULL);
+}
+
+// PyCapsule_New() owning the engine
+//=============================================================================
+static PyObject *engine_to_pyobj(RC2Engine *engine)
+{
+	return PyCapsule_New((void *)engine, NULL, engine_free);
+}
+
+// capsule destructor of a clause exchange pool
+//=============================================================================
+static void exchange_free(PyObject *obj)
+{
+	((ClauseExchange *)PyCapsule_GetPointer(obj, NULL))->release();
+}
+
+// PyCapsule_New() holding a reference to the pool
+//=============================================================================
+static PyObject *exchange_to_pyobj(ClauseExchange *pool)
+{
+	return PyCapsule_New((void *)pool, NULL, exchange_free);
+}
+
 // module initialization
 //=============================================================================
 static struct PyModuleDef module_def = {
@@ -696,6 +1257,34 @@ static void *pyobj_to_void(PyObject *obj)
 	return PyCObject_AsVoidPtr(obj);
 }
 
+// CObject destructor of an RC2 engine
+//=============================================================================
+static void engine_free(void *ptr)
+{
+	delete (RC2Engine *)ptr;
+}
+
+// PyCObject_FromVoidPtr() owning the engine
+//=============================================================================
+static PyObject *engine_to_pyobj(RC2Engine *engine)
+{
+	return PyCObject_FromVoidPtr((void *)engine, engine_free);
+}
+
+// CObject destructor of a clause exchange pool
+//=============================================================================
+static void exchange_free(void *ptr)
+{
+	((ClauseExchange *)ptr)->release();
+}
+
+// PyCObject_FromVoidPtr() holding a reference to the pool
+//=============================================================================
+static PyObject *exchange_to_pyobj(ClauseExchange *pool)
+{
+	return PyCObject_FromVoidPtr((void *)pool, exchange_free);
+}
+
 // module initialization
 //=============================================================================
 PyMODINIT_FUNC initpysolvers(void)
@@ -752,362 +1341,726 @@ static bool pyiter_to_vector(PyObject *obj, vector<int>& vect, int& max_var)
 	return true;
 }
 
-// API for CaDiCaL
+// auxiliary function for converting a sequence of assumption sets into a
+// single vector; set i occupies vect[bounds[i]] .. vect[bounds[i + 1] - 1]
 //=============================================================================
-#ifdef WITH_CADICAL
-static PyObject *py_cadical_new(PyObject *self, PyObject *args)
+static bool pysets_to_vector(PyObject *obj, vector<int>& vect,
+		vector<size_t>& bounds, int& max_var)
 {
-	CaDiCaL::Solver *s = new CaDiCaL::Solver;
+	PyObject *i_obj = PyObject_GetIter(obj);
 
-	if (s == NULL) {
+	if (i_obj == NULL) {
 		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
+				"Object does not seem to be an iterable.");
+		return false;
 	}
 
-	return void_to_pyobj((void *)s);
+	bounds.assign(1, vect.size());
+
+	PyObject *a_obj;
+	while ((a_obj = PyIter_Next(i_obj)) != NULL) {
+		bool ok = pyiter_to_vector(a_obj, vect, max_var);
+		Py_DECREF(a_obj);
+
+		if (!ok) {
+			Py_DECREF(i_obj);
+			return false;
+		}
+
+		bounds.push_back(vect.size());
+	}
+
+	Py_DECREF(i_obj);
+	return !PyErr_Occurred();
 }
 
-//
+// auxiliary function for getting the variables to block models on, which
+// are either the given projection variables or all variables 1..nof_vars
 //=============================================================================
-static PyObject *py_cadical_add_cl(PyObject *self, PyObject *args)
+static bool pyproj_to_vector(PyObject *obj, vector<int>& vars, int& max_var,
+		int nof_vars)
 {
-	PyObject *s_obj;
-	PyObject *c_obj;
+	if (obj == Py_None) {
+		for (int v = 1; v <= nof_vars; ++v)
+			vars.push_back(v);
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
+		return true;
+	}
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	if (pyiter_to_vector(obj, vars, max_var) == false)
+		return false;
 
-	// clause iterator
-	PyObject *i_obj = PyObject_GetIter(c_obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Clause does not seem to be an iterable object.");
-		return NULL;
-	}
+	for (size_t i = 0; i < vars.size(); ++i)
+		vars[i] = abs(vars[i]);
 
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return NULL;
-		}
+	return true;
+}
 
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
+// auxiliary function for accessing a flat zero-terminated int32 buffer
+//=============================================================================
+static bool pybuf_get_int32(PyObject *obj, Py_buffer *view)
+{
+	if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0)
+		return false;
 
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return NULL;
-		}
+	const char *fmt = view->format;
+	if (fmt && (*fmt == '@' || *fmt == '='))
+		++fmt;
 
-		s->add(l);
+	if (view->itemsize != 4 || (fmt && strcmp(fmt, "i") && strcmp(fmt, "l"))) {
+		PyBuffer_Release(view);
+		PyErr_SetString(PyExc_TypeError, "buffer of 32-bit integers expected");
+		return false;
 	}
 
-	s->add(0);
-	Py_DECREF(i_obj);
+	Py_ssize_t size = view->len / view->itemsize;
+	if (size && ((int32_t *)view->buf)[size - 1] != 0) {
+		PyBuffer_Release(view);
+		PyErr_SetString(PyExc_ValueError, "buffer must be zero-terminated");
+		return false;
+	}
 
-	PyObject *ret = PyBool_FromLong((long)true);
-	return ret;
+	return true;
 }
 
-//
+// auxiliary function for returning a vector of literals as a Python list
 //=============================================================================
-static PyObject *py_cadical_tracepr(PyObject *self, PyObject *args)
+static PyObject *pylist_from_vector(const vector<int>& vect)
 {
-	PyObject *s_obj;
-	PyObject *p_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	PyObject *list = PyList_New(vect.size());
+	if (list == NULL)
 		return NULL;
 
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
+	for (size_t i = 0; i < vect.size(); ++i)
+		PyList_SetItem(list, i, pyint_from_cint(vect[i]));
 
-	s->trace_proof(PyFile_AsFile(p_obj), "<py_fobj>");
-	PyFile_IncUseCount((PyFileObject *)p_obj);
-#else
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	return list;
+}
 
-	int fd = PyObject_AsFileDescriptor(p_obj);
-	if (fd == -1) {
-		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
-		return NULL;
-	}
+// auxiliary function for refining an MUS approximation in deletion-based
+// extraction once clause approx[i] is found unnecessary: only the literals
+// in the core are kept, in their original order; as every clause tested
+// before i is either in the core (and so kept) or dropped, the number of
+// clauses left to test is returned as the new position
+//=============================================================================
+static size_t musx_refine(vector<int>& approx, size_t i, const vector<int>& core,
+		vector<char>& mark)
+{
+	for (size_t j = 0; j < core.size(); ++j)
+		mark[abs(core[j])] = 1;
 
-	FILE *cd_trace_fp = fdopen(fd, "w+");
-	if (cd_trace_fp == NULL) {
-		PyErr_SetString(SATError, "Cannot create proof file pointer!");
-		return NULL;
+	size_t k = 0, pos = 0;
+	for (size_t j = 0; j < approx.size(); ++j) {
+		if (j == i || !mark[abs(approx[j])])
+			continue;
+
+		if (j < i)
+			++pos;
+
+		approx[k++] = approx[j];
 	}
 
-	setlinebuf(cd_trace_fp);
-	s->trace_proof(cd_trace_fp, "<py_fobj>");
-	Py_INCREF(p_obj);
-#endif
+	approx.resize(k);
 
-	s->set("binary", 0);
-	Py_RETURN_NONE;
+	for (size_t j = 0; j < core.size(); ++j)
+		mark[abs(core[j])] = 0;
+
+	return pos;
 }
 
-//
+// auxiliary function for adding the call timings of a solver (if they are
+// recorded) to its stats dict as 'calls'; the reference to d_obj is stolen
 //=============================================================================
-static PyObject *py_cadical_solve(PyObject *self, PyObject *args)
+static PyObject *pystats_add_calls(PyObject *d_obj, void *s)
 {
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
+	if (d_obj == NULL)
 		return NULL;
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	unordered_map<void *, CallStats>::iterator it = call_stats.find(s);
+	if (it == call_stats.end())
+		return d_obj;
 
-	// assumptions iterator
-	PyObject *i_obj = PyObject_GetIter(a_obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
+	PyObject *c_obj = PyDict_New();
+	if (c_obj == NULL) {
+		Py_DECREF(d_obj);
 		return NULL;
 	}
 
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return NULL;
-		}
+	CallStats& stats = it->second;
+	for (int i = 0; i < TC_NOF; ++i) {
+		if (stats.calls[i] == 0)
+			continue;
 
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
+		PyObject *e_obj = Py_BuildValue("{s:K,s:K,s:K}",
+			"calls", stats.calls[i],
+			"total_ns", stats.total[i],
+			"solver_ns", stats.solver[i]
+		);
 
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
+		if (e_obj == NULL || PyDict_SetItemString(c_obj, timed_names[i],
+					e_obj) < 0) {
+			Py_XDECREF(e_obj);
+			Py_DECREF(c_obj);
+			Py_DECREF(d_obj);
 			return NULL;
 		}
 
-		s->assume(l);
+		Py_DECREF(e_obj);
 	}
 
-	Py_DECREF(i_obj);
+	int res = PyDict_SetItemString(d_obj, "calls", c_obj);
+	Py_DECREF(c_obj);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+	if (res < 0) {
+		Py_DECREF(d_obj);
+		return NULL;
 	}
 
-	bool res = s->solve() == 10 ? true : false;
+	return d_obj;
+}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+// auxiliary function for turning a bytes object into a typed buffer; the
+// memory is shared (stealing the reference to b_obj)
+//=============================================================================
+static PyObject *pybytes_to_view(PyObject *b_obj, const char *format)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *v_obj = PyMemoryView_FromObject(b_obj);
+	Py_DECREF(b_obj);
 
-	PyObject *ret = PyBool_FromLong((long)res);
+	if (v_obj == NULL)
+		return NULL;
+
+	PyObject *ret = PyObject_CallMethod(v_obj, (char *)"cast", (char *)"s",
+			format);
+	Py_DECREF(v_obj);
 	return ret;
+#else
+	return b_obj;  // a plain string of bytes in Python 2
+#endif
 }
 
-//
+// auxiliary function for returning a batch of enumerated models
 //=============================================================================
-static PyObject *py_cadical_core(PyObject *self, PyObject *args)
+static PyObject *pymodels_to_tuple(vector<int32_t>& models, bool done)
 {
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+			models.size() * sizeof(int32_t));
+	if (b_obj == NULL)
+		return NULL;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &a_obj))
+	if (models.size())
+		memcpy(PyBytes_AS_STRING(b_obj), &models[0],
+				models.size() * sizeof(int32_t));
+
+	PyObject *v_obj = pybytes_to_view(b_obj, "i");
+	if (v_obj == NULL)
 		return NULL;
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	return Py_BuildValue("(NO)", v_obj, done ? Py_True : Py_False);
+}
 
-	int size = (int)PyList_Size(a_obj);
+// auxiliary function for turning a vector into a typed memoryview
+//=============================================================================
+static PyObject *pyvector_to_view(const void *data, size_t size,
+		const char *format)
+{
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL, size);
+	if (b_obj == NULL)
+		return NULL;
 
-	vector<int> c;
-	for (int i = 0; i < size; ++i) {
-		PyObject *l_obj = PyList_GetItem(a_obj, i);
-		int l = pyint_to_cint(l_obj);
+	if (size)
+		memcpy(PyBytes_AS_STRING(b_obj), data, size);
 
-		if (s->failed(l))
-			c.push_back(l);
-	}
+	return pybytes_to_view(b_obj, format);
+}
 
-	PyObject *core = PyList_New(c.size());
-	for (size_t i = 0; i < c.size(); ++i) {
-		PyObject *lit = pyint_from_cint(c[i]);
-		PyList_SetItem(core, i, lit);
-	}
+// auxiliary function for returning the results of a batch of calls as a
+// triple of buffers: statuses (int8), offsets (int64) and literals (int32),
+// such that the literals of query i occupy offs[i] .. offs[i + 1]
+//=============================================================================
+static PyObject *pybatch_to_tuple(vector<int8_t>& status,
+		vector<int64_t>& offs, vector<int32_t>& lits)
+{
+	PyObject *s_obj = pyvector_to_view(status.data(), status.size(), "b");
+	PyObject *o_obj = pyvector_to_view(offs.data(),
+			offs.size() * sizeof(int64_t), "q");
+	PyObject *l_obj = pyvector_to_view(lits.data(),
+			lits.size() * sizeof(int32_t), "i");
 
-	if (c.size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
+	if (s_obj == NULL || o_obj == NULL || l_obj == NULL) {
+		Py_XDECREF(s_obj);
+		Py_XDECREF(o_obj);
+		Py_XDECREF(l_obj);
+		return NULL;
 	}
 
-	Py_DECREF(core);
-	Py_RETURN_NONE;
+	return Py_BuildValue("(NNN)", s_obj, o_obj, l_obj);
 }
 
-//
+// the callbacks of a solver patched for clause exchange; the solver hands
+// every clause it learns over to put(), which passes it on to the pool the
+// solver shares clauses through, if any, and collects the clauses small
+// enough for the learnt-clause callback into a zero-terminated batch; the
+// GIL is taken only once per batch and once per progress report and so the
+// search of the solver never waits for Python otherwise; this is what the
+// 'exchange' pointer of a patched solver points to
 //=============================================================================
-static PyObject *py_cadical_model(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+class SolverCallbacks {
+public:
+	SolverCallbacks(void *solver, void (*interrupt)(void *),
+			PyObject *(*stats)(void *))
+	: solver(solver), interrupt(interrupt), stats(stats), member(NULL),
+	learnt_cb(NULL), max_size(0), max_lbd(0), batch(0), nof_learnts(0),
+	progress_cb(NULL), every(0), ticks(0), failed(false),
+	err_type(NULL), err_value(NULL), err_tb(NULL)
+	{
+	}
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	// the GIL is held here, as the solver is deleted from Python
+	~SolverCallbacks()
+	{
+		delete member;
+		Py_XDECREF(learnt_cb);
+		Py_XDECREF(progress_cb);
+		Py_XDECREF(err_type);
+		Py_XDECREF(err_value);
+		Py_XDECREF(err_tb);
+	}
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	// leaving the previous pool, if any, and joining a new one
+	void share(ClauseExchange *pool, int lbd)
+	{
+		delete member;
+		member = pool ? new ExchangeMember(pool, lbd) : NULL;
+	}
 
-	int maxvar = s->vars();
-	if (maxvar) {
-		PyObject *model = PyList_New(maxvar);
-		for (int i = 1; i <= maxvar; ++i) {
-			int l = s->val(i) > 0 ? i : -i;
+	// the learnt-clause callback, or NULL (a new reference is taken)
+	void learnts(PyObject *cb, int size, int lbd, int nof_clauses)
+	{
+		flush();
 
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
+		Py_XINCREF(cb);
+		Py_XDECREF(learnt_cb);
+		learnt_cb = cb;
+		max_size  = size;
+		max_lbd   = lbd;
+		batch     = nof_clauses > 0 ? nof_clauses : 1;
+	}
+
+	// the progress callback, or NULL (a new reference is taken)
+	void progress(PyObject *cb, int nof_conflicts)
+	{
+		Py_XINCREF(cb);
+		Py_XDECREF(progress_cb);
+		progress_cb = cb;
+		every = nof_conflicts > 0 ? nof_conflicts : 1;
+		ticks = 0;
+	}
+
+	// nothing is left for the solver to call
+	bool idle() const
+	{
+		return member == NULL && learnt_cb == NULL && progress_cb == NULL;
+	}
+
+	// the callback used by a solver to export a learnt clause; it is called
+	// once per conflict and the progress is hence counted in these calls
+	static void put(void *ptr, const int *cl, int size, int lbd)
+	{
+		SolverCallbacks *c = (SolverCallbacks *)ptr;
+
+		if (c->member)
+			ExchangeMember::put(c->member, cl, size, lbd);
+
+		if (c->learnt_cb && size <= c->max_size && lbd <= c->max_lbd) {
+			c->lits.insert(c->lits.end(), cl, cl + size);
+			c->lits.push_back(0);
+
+			if (++c->nof_learnts >= c->batch)
+				c->flush();
 		}
 
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
+		if (c->progress_cb && ++c->ticks >= c->every) {
+			c->ticks = 0;
+			c->report();
+		}
 	}
 
-	Py_RETURN_NONE;
-}
+	// the callback used by a solver to import the next clause
+	static int get(void *ptr, const int **cl, int *lbd)
+	{
+		SolverCallbacks *c = (SolverCallbacks *)ptr;
 
-//
-//=============================================================================
-static PyObject *py_cadical_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+		if (c->member == NULL)
+			return -1;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+		return ExchangeMember::get(c->member, cl, lbd);
+	}
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	// delivering the last batch once the solver stops; returns false and
+	// sets the exception raised by a callback while the solver was running
+	bool finish()
+	{
+		flush();
 
-	int nof_vars = s->vars();
+		if (!failed)
+			return true;
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
+		PyErr_Restore(err_type, err_value, err_tb);
+		err_type = err_value = err_tb = NULL;
+		failed = false;
+		return false;
+	}
+private:
+	void flush()
+	{
+		if (lits.empty())
+			return;
+
+		if (learnt_cb && !failed) {
+			PyGILState_STATE gil = PyGILState_Ensure();
+			call(learnt_cb, pyvector_to_view(lits.data(),
+						lits.size() * sizeof(int), "i"));
+			PyGILState_Release(gil);
+		}
 
-//
+		lits.clear();
+		nof_learnts = 0;
+	}
+
+	void report()
+	{
+		if (failed)
+			return;
+
+		PyGILState_STATE gil = PyGILState_Ensure();
+		call(progress_cb, stats(solver));
+		PyGILState_Release(gil);
+	}
+
+	// an exception stops the solver and it is raised once the solver is
+	// back in Python; the callbacks are not called until then
+	void call(PyObject *cb, PyObject *arg)
+	{
+		PyObject *ret = NULL;
+		if (arg) {
+			ret = PyObject_CallFunctionObjArgs(cb, arg, NULL);
+			Py_DECREF(arg);
+		}
+
+		if (ret) {
+			Py_DECREF(ret);
+			return;
+		}
+
+		PyErr_Fetch(&err_type, &err_value, &err_tb);
+		failed = true;
+		interrupt(solver);
+	}
+
+	void *solver;
+	void (*interrupt)(void *);
+	PyObject *(*stats)(void *);
+
+	ExchangeMember *member;
+
+	PyObject *learnt_cb;
+	int max_size;
+	int max_lbd;
+	int batch;
+	int nof_learnts;
+	vector<int> lits;
+
+	PyObject *progress_cb;
+	int every;
+	int ticks;
+
+	bool failed;
+	PyObject *err_type;
+	PyObject *err_value;
+	PyObject *err_tb;
+};
+
+// default parts of cloning a MiniSat-like solver S: problem constraints are
+// plain clauses and learnt clauses are ranked by their activity only; the
+// solvers storing cardinality constraints or LBDs specialise the template
 //=============================================================================
-static PyObject *py_cadical_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+extern "C++" {
+template <class S>
+struct MinisatHooks {
+	template <class L, class C>
+	static bool add(S *to, L& lits, C& c)
+	{
+		return to->addClause(lits);
+	}
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	template <class C>
+	static void learnt(C& to, C& from)
+	{
+		to.activity() = from.activity();
+	}
 
-	// get pointer to solver
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	static void config(S *from, S *to) {}
+};
 
-	int nof_cls = s->irredundant() + s->redundant();
+// cloning a MiniSat-like solver; the class derives from the solver only to
+// name its protected members, which are then accessed in both the original
+// and the clone through member pointers, and so it is never instantiated
+//=============================================================================
+template <class S>
+struct MinisatClone : public S {
+	typedef decltype(MinisatClone::trail) Lits;
+	typedef decltype(MinisatClone::clauses) CRefs;
+	typedef decltype(MinisatClone::ca) Allocator;
+
+	// the solver is at decision level 0 between the calls, and so its trail
+	// holds nothing but the top-level units, which are added first; the
+	// problem clauses follow and, if warm is set, the learnt clauses (as
+	// learnt), the variable activities and the saved phases are copied too
+	static void clone(S *from, S *to, bool warm)
+	{
+		while (to->nVars() < from->nVars())
+			to->newVar();
+
+		MinisatHooks<S>::config(from, to);
+
+		Lits lits;
+		if (!from->okay()) {
+			to->addClause(lits);
+			return;
+		}
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+		Lits& trail = from->*(&MinisatClone::trail);
+		for (int i = 0; i < trail.size(); ++i) {
+			lits.clear();
+			lits.push(trail[i]);
+			to->addClause(lits);
+		}
+
+		Allocator& ca = from->*(&MinisatClone::ca);
+		CRefs& clauses = from->*(&MinisatClone::clauses);
+		for (int i = 0; i < clauses.size(); ++i) {
+			lits.clear();
+			for (int j = 0; j < ca[clauses[i]].size(); ++j)
+				lits.push(ca[clauses[i]][j]);
+
+			MinisatHooks<S>::add(to, lits, ca[clauses[i]]);
+		}
+
+		if (!warm || !to->okay())
+			return;
+
+		// the literals of a learnt clause assigned at the top level are
+		// dropped, as the watches of a clause must be unassigned
+		Allocator& to_ca = to->*(&MinisatClone::ca);
+		CRefs& learnts = from->*(&MinisatClone::learnts);
+		CRefs& to_learnts = to->*(&MinisatClone::learnts);
+		for (int i = 0; i < learnts.size(); ++i) {
+			bool sat = false;
+
+			lits.clear();
+			for (int j = 0; j < ca[learnts[i]].size(); ++j) {
+				int val = value_to_int(to->value(ca[learnts[i]][j]));
+
+				if (val == 0)
+					sat = true;
+				else if (val == 2)
+					lits.push(ca[learnts[i]][j]);
+			}
+
+			if (sat)
+				continue;
+
+			// a unit clause is implied at the top level
+			if (lits.size() < 2) {
+				to->addClause(lits);
+				continue;
+			}
+
+			to_learnts.push(to_ca.alloc(lits, true));
+			MinisatHooks<S>::learnt(to_ca[to_learnts.last()], ca[learnts[i]]);
+			(to->*(&MinisatClone::attachClause))(to_learnts.last());
+		}
+
+		for (int v = 0; v < from->nVars(); ++v) {
+			(to->*(&MinisatClone::activity))[v] = (from->*(&MinisatClone::activity))[v];
+			(to->*(&MinisatClone::polarity))[v] = (from->*(&MinisatClone::polarity))[v];
+		}
+
+		to->*(&MinisatClone::var_inc) = from->*(&MinisatClone::var_inc);
+		to->*(&MinisatClone::cla_inc) = from->*(&MinisatClone::cla_inc);
+		(to->*(&MinisatClone::rebuildOrderHeap))();
+	}
+private:
+	// l_True, l_False and l_Undef are macros of every solver clashing with
+	// each other, and so a value is compared by its encoding (0, 1 or 2)
+	template <class V>
+	static int value_to_int(V val)
+	{
+		if (val == V((uint8_t)0))
+			return 0;
+		if (val == V((uint8_t)1))
+			return 1;
+
+		return 2;
+	}
+};
+}  // extern "C++"
+
+// API of the MiniSat-like solvers
+//=============================================================================
+extern "C++" {
+// auxiliary function for declaring new variables
+//=============================================================================
+template <class T>
+void MinisatAdapter<T>::declare_vars(Solver *s, const int max_id)
+{
+	while (s->nVars() < max_id + 1)
+		s->newVar();
 }
 
-//
+// interrupting the solver from the SIGINT handler
 //=============================================================================
-static PyObject *py_cadical_del(PyObject *self, PyObject *args)
+template <class T>
+void MinisatAdapter<T>::sigint(void *s)
 {
-	PyObject *s_obj;
-	PyObject *p_obj;
+	((Solver *)s)->interrupt();
+}
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
+// clearing the interrupt flag once a portfolio race is over
+//=============================================================================
+template <class T>
+void MinisatAdapter<T>::clearint(void *s)
+{
+	((Solver *)s)->clearInterrupt();
+}
 
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
+// running the solver in a portfolio thread
+//=============================================================================
+template <class T>
+int MinisatAdapter<T>::race(void *ptr, const vector<int>& assumps, int max_var,
+		volatile sig_atomic_t *stop)
+{
+	Solver *s = (Solver *)ptr;
 
-	if (p_obj != Py_None)
-		PyFile_DecUseCount((PyFileObject *)p_obj);
-#else
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	if (max_var > 0)
+		declare_vars(s, max_var);
 
-	if (p_obj != Py_None)
-		Py_DECREF(p_obj);
-#endif
+	Lits a;
+	for (size_t i = 0; i < assumps.size(); ++i) {
+		int l = assumps[i];
+		a.push((l > 0) ? T::mkLit(l, false) : T::mkLit(-l, true));
+	}
 
-	delete s;
-	Py_RETURN_NONE;
+	// another solver may have won the race already
+	if (*stop)
+		return 0;
+
+	lbool res = s->solveLimited(a);
+
+	if (res == lbool((uint8_t)0))  // l_True
+		return 10;
+	if (res == lbool((uint8_t)1))  // l_False
+		return 20;
+
+	return 0;
 }
 
-//
+// adding a clause on behalf of the RC2 engine
 //=============================================================================
-static PyObject *py_cadical_acc_stats(PyObject *self, PyObject *args)
+template <class T>
+void MinisatAdapter<T>::rc2_add(void *ptr, const vector<int>& cl)
 {
-	PyObject *s_obj;
+	Solver *s = (Solver *)ptr;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	Lits c;
+	int max_var = -1;
+	for (size_t i = 0; i < cl.size(); ++i) {
+		int l = cl[i];
+		c.push((l > 0) ? T::mkLit(l, false) : T::mkLit(-l, true));
 
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
+		if (abs(l) > max_var)
+			max_var = abs(l);
+	}
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->restarts(),
-		"conflicts", s->conflicts(),
-		"decisions", s->decisions(),
-		"propagations", s->propagations()
-	);
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	s->addClause(c);
 }
-#endif  // WITH_CADICAL
 
-// API for Gluecard 3.0
+// a (possibly limited) call made by the RC2 engine
 //=============================================================================
-#ifdef WITH_GLUECARD30
-static PyObject *py_gluecard3_new(PyObject *self, PyObject *args)
+template <class T>
+int MinisatAdapter<T>::rc2_solve(void *ptr, const vector<int>& assumps,
+		int64_t budget)
 {
-	Gluecard30::Solver *s = new Gluecard30::Solver();
+	Solver *s = (Solver *)ptr;
 
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
+	Lits a;
+	int max_var = -1;
+	for (size_t i = 0; i < assumps.size(); ++i) {
+		int l = assumps[i];
+		a.push((l > 0) ? T::mkLit(l, false) : T::mkLit(-l, true));
+
+		if (abs(l) > max_var)
+			max_var = abs(l);
 	}
 
-	return void_to_pyobj((void *)s);
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	// an interrupted call returns l_Undef only if it is limited
+	if (budget > 0)
+		s->setConfBudget(budget);
+	else
+		s->budgetOff();
+
+	lbool res = s->solveLimited(a);
+	s->budgetOff();
+
+	if (res == lbool((uint8_t)0))  // l_True
+		return 10;
+	if (res == lbool((uint8_t)1))  // l_False
+		return 20;
+
+	return 0;
 }
 
-// auxiliary function for declaring new variables
+// the core of the last call made by the RC2 engine
 //=============================================================================
-static inline void gluecard3_declare_vars(Gluecard30::Solver *s, const int max_id)
+template <class T>
+void MinisatAdapter<T>::rc2_core(void *ptr, const vector<int>& assumps,
+		vector<int>& core)
 {
-	while (s->nVars() < max_id + 1)
-		s->newVar();
+	Solver *s = (Solver *)ptr;
+
+	for (int i = 0; i < s->conflict.size(); ++i)
+		core.push_back(T::var(s->conflict[i]) *
+				(T::sign(s->conflict[i]) ? 1 : -1));
+}
+
+// the model of the last call made by the RC2 engine
+//=============================================================================
+template <class T>
+void MinisatAdapter<T>::rc2_model(void *ptr, vector<int>& model)
+{
+	Solver *s = (Solver *)ptr;
+
+	// l_True fails to work
+	lbool True = lbool((uint8_t)0);
+
+	for (int i = 1; i < s->model.size(); ++i)
+		model.push_back(s->model[i] == True ? i : -i);
 }
 
 // translating an iterable to vec<Lit>
 //=============================================================================
-static inline bool gluecard3_iterate(
+template <class T>
+bool MinisatAdapter<T>::iterate(
 	PyObject *obj,
-	Gluecard30::vec<Gluecard30::Lit>& v,
+	Lits& v,
 	int& max_var
 )
 {
@@ -1137,7 +2090,7 @@ static inline bool gluecard3_iterate(
 			return false;
 		}
 
-		v.push((l > 0) ? Gluecard30::mkLit(l, false) : Gluecard30::mkLit(-l, true));
+		v.push((l > 0) ? T::mkLit(l, false) : T::mkLit(-l, true));
 
 		if (abs(l) > max_var)
 			max_var = abs(l);
@@ -1147,56 +2100,137 @@ static inline bool gluecard3_iterate(
 	return true;
 }
 
-//
+// the literals over the variables eliminated by a simplifying solver are
+// refused, as the solver would silently misread them
 //=============================================================================
-static PyObject *py_gluecard3_add_cl(PyObject *self, PyObject *args)
+template <class T>
+bool MinisatAdapter<T>::active(Solver *s, const Lits& v)
 {
-	PyObject *s_obj;
-	PyObject *c_obj;
+	void *simp = T::simp(s);
+	if (simp == NULL)
+		return true;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
+	for (int i = 0; i < v.size(); ++i) {
+		int x = T::var(v[i]);
 
-	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-	Gluecard30::vec<Gluecard30::Lit> cl;
-	int max_var = -1;
+		if (x < s->nVars() && T::eliminated(simp, x)) {
+			PyErr_Format(SATError, "Variable %d has been eliminated", x);
+			return false;
+		}
+	}
 
-	if (gluecard3_iterate(c_obj, cl, max_var) == false)
-		return NULL;
+	return true;
+}
 
-	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+//
+//=============================================================================
+template <class T>
+bool MinisatAdapter<T>::active(Solver *s, const int *lits, size_t size)
+{
+	void *simp = T::simp(s);
+	if (simp == NULL)
+		return true;
 
-	bool res = s->addClause(cl);
+	for (size_t i = 0; i < size; ++i) {
+		int x = abs(lits[i]);
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+		if (x < s->nVars() && T::eliminated(simp, x)) {
+			PyErr_Format(SATError, "Variable %d has been eliminated", x);
+			return false;
+		}
+	}
+
+	return true;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_add_am(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_add_cl(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *c_obj;
-	int64_t rhs;
 
-	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-	Gluecard30::vec<Gluecard30::Lit> cl;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_CL);
+	Lits cl;
 	int max_var = -1;
 
-	if (gluecard3_iterate(c_obj, cl, max_var) == false)
+	if (iterate(c_obj, cl, max_var) == false)
 		return NULL;
 
 	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+		declare_vars(s, max_var);
 
-	bool res = s->addAtMost(cl, rhs);
+	if (!active(s, cl))
+		return NULL;
+
+	timer.enter();
+	bool res = s->addClause(cl);
+	timer.leave();
+
+	PyObject *ret = PyBool_FromLong((long)res);
+	return ret;
+}
+
+//
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_add_cls_buffer(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *b_obj;
+
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &b_obj))
+		return NULL;
+
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_BUF);
+
+	Py_buffer view;
+	if (pybuf_get_int32(b_obj, &view) == false)
+		return NULL;
+
+	const int32_t *lits = (const int32_t *)view.buf;
+	Py_ssize_t size = view.len / view.itemsize;
+	bool res = true;
+
+	if (!active(s, lits, size)) {
+		PyBuffer_Release(&view);
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	Lits cl;
+	int max_var = -1;
+
+	for (Py_ssize_t i = 0; i < size; ++i) {
+		int l = lits[i];
+
+		if (l == 0) {
+			if (max_var > 0)
+				declare_vars(s, max_var);
+
+			res = s->addClause(cl) && res;
+			cl.clear();
+			continue;
+		}
+
+		cl.push((l > 0) ? T::mkLit(l, false) : T::mkLit(-l, true));
+
+		if (abs(l) > max_var)
+			max_var = abs(l);
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&view);
 
 	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
@@ -1204,7 +2238,8 @@ static PyObject *py_gluecard3_add_am(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_solve(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_solve(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *a_obj;  // assumptions
@@ -1214,38 +2249,53 @@ static PyObject *py_gluecard3_solve(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-	Gluecard30::vec<Gluecard30::Lit> a;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE);
+	Lits a;
 	int max_var = -1;
 
-	if (gluecard3_iterate(a_obj, a, max_var) == false)
+	if (iterate(a_obj, a, max_var) == false)
 		return NULL;
 
 	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+		declare_vars(s, max_var);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	if (!active(s, a))
+		return NULL;
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	SigIntState sig_state = { sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-	bool res = s->solve(a);
+	bool res;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	res = s->solve(a);
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
 	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+		sigint_restore(sig_save);
+
+	if (!finish(s))
+		return NULL;
+
+	if (sig_state.caught) {
+		s->clearInterrupt();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
 
 	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
 }
 
+
 //
 //=============================================================================
-static PyObject *py_gluecard3_solve_lim(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_solve_lim(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *a_obj;  // assumptions
@@ -1257,48 +2307,299 @@ static PyObject *py_gluecard3_solve_lim(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-	Gluecard30::vec<Gluecard30::Lit> a;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE_LIM);
+	Lits a;
 	int max_var = -1;
 
-	if (gluecard3_iterate(a_obj, a, max_var) == false)
+	if (iterate(a_obj, a, max_var) == false)
 		return NULL;
 
 	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+		declare_vars(s, max_var);
+
+	if (!active(s, a))
+		return NULL;
+
+	// SIGINT and interrupt() can now be used together, so expect_interrupt
+	// is accepted for backward compatibility only
+	SigIntState sig_state = { sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-	Gluecard30::lbool res = Gluecard30::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	lbool res = lbool((uint8_t)2);  // l_Undef
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	res = s->solveLimited(a);
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (!finish(s))
+		return NULL;
+
+	if (sig_state.caught) {
+		s->clearInterrupt();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	if (res != lbool((uint8_t)2))  // l_Undef
+		return PyBool_FromLong((long)!(T::toInt(res)));
+
+	Py_RETURN_NONE;  // return Python's None if l_Undef
+}
+
+//
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_solve_batch(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *q_obj;  // a sequence of assumption sets
+	int want_models;
+	int want_cores;
+	int64_t budget;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOiiLi", &s_obj, &q_obj, &want_models,
+				&want_cores, &budget, &main_thread))
+		return NULL;
+
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE_BATCH);
+
+	PyObject *i_obj = PyObject_GetIter(q_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return NULL;
+	}
+
+	// all the assumptions are converted at once, before solving
+	Lits all;
+	vector<int> bounds(1, 0);
+	int max_var = -1;
+
+	PyObject *a_obj;
+	while ((a_obj = PyIter_Next(i_obj)) != NULL) {
+		bool ok = iterate(a_obj, all, max_var);
+		Py_DECREF(a_obj);
+
+		if (!ok) {
+			Py_DECREF(i_obj);
+			return NULL;
+		}
+
+		bounds.push_back(all.size());
+	}
+
+	Py_DECREF(i_obj);
+	if (PyErr_Occurred())
+		return NULL;
+
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	if (!active(s, all))
+		return NULL;
+
+	SigIntState sig_state = { sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	vector<int8_t> status;
+	vector<int64_t> offs(1, 0);
+	vector<int32_t> lits;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	// l_True, l_False and l_Undef fail to work
+	lbool True  = lbool((uint8_t)0);
+	lbool False = lbool((uint8_t)1);
+	lbool Undef = lbool((uint8_t)2);
+
+	Lits a;
+	for (size_t i = 0; i + 1 < bounds.size() && !sig_state.caught; ++i) {
+		a.clear();
+		for (int j = bounds[i]; j < bounds[i + 1]; ++j)
+			a.push(all[j]);
+
+		// the budget is counted from the start of each query
+		lbool res;
+		if (budget > 0) {
+			s->setConfBudget(budget);
+			res = s->solveLimited(a);
+		}
+		else
+			res = s->solve(a) ? True : False;
+
+		if (res == Undef)
+			status.push_back(-1);
+		else if (res == True) {
+			status.push_back(1);
+
+			if (want_models)
+				for (int v = 1; v < s->model.size(); ++v)
+					lits.push_back(s->model[v] == True ? v : -v);
 		}
+		else {
+			status.push_back(0);
 
-		res = s->solveLimited(a);
+			if (want_cores)
+				for (int j = 0; j < s->conflict.size(); ++j)
+					lits.push_back(T::var(s->conflict[j]) *
+							(T::sign(s->conflict[j]) ? 1 : -1));
+		}
 
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
+		offs.push_back(lits.size());
 	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
+
+	if (budget > 0)
+		s->budgetOff();
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (!finish(s))
+		return NULL;
+
+	if (sig_state.caught) {
+		s->clearInterrupt();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
 	}
 
-	if (res != Gluecard30::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Gluecard30::toInt(res)));
+	return pybatch_to_tuple(status, offs, lits);
+}
 
-	Py_RETURN_NONE;  // return Python's None if l_Undef
+// auxiliary function for a (possibly limited) call made in MUS extraction:
+// 1 stands for SAT, 0 for UNSAT, and -1 for an exceeded budget
+//=============================================================================
+template <class T>
+int MinisatAdapter<T>::check(Solver *s, Lits& a,
+		int64_t budget)
+{
+	if (budget <= 0)
+		return s->solve(a) ? 1 : 0;
+
+	s->setConfBudget(budget);
+	lbool res = s->solveLimited(a);
+	s->budgetOff();
+
+	if (res == lbool((uint8_t)2))  // l_Undef
+		return -1;
+
+	return T::toInt(res) ? 0 : 1;
+}
+
+//
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_extract_mus(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *l_obj;  // selectors
+	int64_t budget;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOLi", &s_obj, &l_obj, &budget,
+				&main_thread))
+		return NULL;
+
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MUS);
+
+	vector<int> sels;
+	int max_var = -1;
+	if (pyiter_to_vector(l_obj, sels, max_var) == false)
+		return NULL;
+
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	if (!active(s, sels.data(), sels.size()))
+		return NULL;
+
+	SigIntState sig_state = { sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	vector<int> approx, core;
+	bool unsat;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	Lits a;
+	for (size_t i = 0; i < sels.size(); ++i)
+		a.push(T::mkLit(abs(sels[i]), sels[i] < 0));
+
+	// the whole set is checked with no budget
+	unsat = !s->solve(a);
+
+	if (unsat) {
+		vector<char> mark(s->nVars() + 1, 0);
+
+		// the first core is an over-approximation of an MUS
+		for (int j = 0; j < s->conflict.size(); ++j)
+			core.push_back(T::var(s->conflict[j]));
+		approx = sels;
+		musx_refine(approx, approx.size(), core, mark);
+
+		size_t i = 0;
+		while (i < approx.size() && !sig_state.caught) {
+			a.clear();
+			for (size_t j = 0; j < approx.size(); ++j)
+				if (j != i)
+					a.push(T::mkLit(abs(approx[j]), approx[j] < 0));
+
+			if (check(s, a, budget) != 0) {
+				++i;  // necessary or unknown; keeping it
+				continue;
+			}
+
+			// clause-set refinement
+			core.clear();
+			for (int j = 0; j < s->conflict.size(); ++j)
+				core.push_back(T::var(s->conflict[j]));
+			i = musx_refine(approx, i, core, mark);
+		}
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (!finish(s))
+		return NULL;
+
+	if (sig_state.caught) {
+		s->clearInterrupt();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	if (!unsat)
+		Py_RETURN_NONE;
+
+	return pylist_from_vector(approx);
 }
 
+
 //
 //=============================================================================
-static PyObject *py_gluecard3_propagate(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_propagate(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *a_obj;  // assumptions
@@ -1310,39 +2611,38 @@ static PyObject *py_gluecard3_propagate(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-	Gluecard30::vec<Gluecard30::Lit> a;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_PROPAGATE);
+	Lits a;
 	int max_var = -1;
 
-	if (gluecard3_iterate(a_obj, a, max_var) == false)
+	if (iterate(a_obj, a, max_var) == false)
 		return NULL;
 
 	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+		declare_vars(s, max_var);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	if (!active(s, a))
+		return NULL;
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	// propagation is not interruptible but it is bounded by the formula
+	// size; a SIGINT received meanwhile is handled by Python afterwards
+	Lits p;
+	bool res;
 
-	Gluecard30::vec<Gluecard30::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	res = s->prop_check(a, p, save_phases);
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
 	PyObject *propagated = PyList_New(p.size());
 	for (int i = 0; i < p.size(); ++i) {
-		int l = Gluecard30::var(p[i]) * (Gluecard30::sign(p[i]) ? -1 : 1);
+		int l = T::var(p[i]) * (T::sign(p[i]) ? -1 : 1);
 		PyObject *lit = pyint_from_cint(l);
 		PyList_SetItem(propagated, i, lit);
 	}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
 	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
 	Py_DECREF(propagated);
 
@@ -1351,7 +2651,89 @@ static PyObject *py_gluecard3_propagate(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_setphases(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_propagate_batch(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *q_obj;  // a sequence of assumption sets
+	int save_phases;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &q_obj, &save_phases,
+				&main_thread))
+		return NULL;
+
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_PROPAGATE_BATCH);
+
+	PyObject *i_obj = PyObject_GetIter(q_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return NULL;
+	}
+
+	// all the assumptions are converted at once, before propagation
+	Lits all;
+	vector<int> bounds(1, 0);
+	int max_var = -1;
+
+	PyObject *a_obj;
+	while ((a_obj = PyIter_Next(i_obj)) != NULL) {
+		bool ok = iterate(a_obj, all, max_var);
+		Py_DECREF(a_obj);
+
+		if (!ok) {
+			Py_DECREF(i_obj);
+			return NULL;
+		}
+
+		bounds.push_back(all.size());
+	}
+
+	Py_DECREF(i_obj);
+	if (PyErr_Occurred())
+		return NULL;
+
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	if (!active(s, all))
+		return NULL;
+
+	// propagation is not interruptible but it is bounded by the formula
+	// size; a SIGINT received meanwhile is handled by Python afterwards
+	vector<int8_t> status;
+	vector<int64_t> offs(1, 0);
+	vector<int32_t> lits;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	Lits a, p;
+	for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+		a.clear();
+		for (int j = bounds[i]; j < bounds[i + 1]; ++j)
+			a.push(all[j]);
+
+		p.clear();
+		status.push_back((int8_t)s->prop_check(a, p, save_phases));
+
+		for (int j = 0; j < p.size(); ++j)
+			lits.push_back(T::var(p[j]) * (T::sign(p[j]) ? -1 : 1));
+		offs.push_back(lits.size());
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	return pybatch_to_tuple(status, offs, lits);
+}
+
+
+//
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_setphases(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *p_obj;  // polarities given as a list of integer literals
@@ -1360,7 +2742,8 @@ static PyObject *py_gluecard3_setphases(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_PHASES);
 	vector<int> p;
 	int max_var = -1;
 
@@ -1368,17 +2751,18 @@ static PyObject *py_gluecard3_setphases(PyObject *self, PyObject *args)
 		return NULL;
 
 	if (max_var > 0)
-		gluecard3_declare_vars(s, max_var);
+		declare_vars(s, max_var);
 
 	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
+		s->setPolarity(abs(p[i]), Polarity(p[i] < 0));
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_cbudget(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_cbudget(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	int64_t budget;
@@ -1387,7 +2771,7 @@ static PyObject *py_gluecard3_cbudget(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
 	if (budget != 0 && budget != -1)  // it is 0 by default
 		s->setConfBudget(budget);
@@ -1399,7 +2783,8 @@ static PyObject *py_gluecard3_cbudget(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_pbudget(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_pbudget(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	int64_t budget;
@@ -1408,7 +2793,7 @@ static PyObject *py_gluecard3_pbudget(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
 	if (budget != 0 && budget != -1)  // it is 0 by default
 		s->setPropBudget(budget);
@@ -1420,24 +2805,28 @@ static PyObject *py_gluecard3_pbudget(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_interrupt(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_mbudget(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int64_t budget;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	s->interrupt();
+	// unlike the other budgets, this one is an absolute number of bytes
+	s->setMemBudget(budget > 0 ? budget : -1);
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_clearint(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_interrupt(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -1445,16 +2834,17 @@ static PyObject *py_gluecard3_clearint(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	s->clearInterrupt();
+	s->interrupt();
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_setincr(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_clearint(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -1462,73 +2852,34 @@ static PyObject *py_gluecard3_setincr(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	s->setIncrementalMode();
+	s->clearInterrupt();
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_tracepr(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_core(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCObject_AsVoidPtr(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE);
 
-	s->certifiedOutput = PyFile_AsFile(p_obj);
-	PyFile_IncUseCount((PyFileObject *)p_obj);
-#else
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	Conflict *c = &(s->conflict);  // minisat's conflict
 
-	int fd = PyObject_AsFileDescriptor(p_obj);
-	if (fd == -1) {
-		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
-		return NULL;
-	}
-
-	s->certifiedOutput = fdopen(fd, "w+");
-	if (s->certifiedOutput == 0) {
-		PyErr_SetString(SATError, "Cannot create proof file pointer!");
-		return NULL;
-	}
-
-	setlinebuf(s->certifiedOutput);
-	Py_INCREF(p_obj);
-#endif
-
-	s->certifiedUNSAT  = true;
-	s->certifiedPyFile = (void *)p_obj;
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_gluecard3_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-
-	Gluecard30::vec<Gluecard30::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Gluecard30::var((*c)[i]) * (Gluecard30::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
+	PyObject *core = PyList_New(c->size());
+	for (int i = 0; i < c->size(); ++i) {
+		int l = T::var((*c)[i]) * (T::sign((*c)[i]) ? 1 : -1);
+		PyObject *lit = pyint_from_cint(l);
+		PyList_SetItem(core, i, lit);
 	}
 
 	if (c->size()) {
@@ -1543,7 +2894,8 @@ static PyObject *py_gluecard3_core(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_model(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_model(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -1551,14 +2903,15 @@ static PyObject *py_gluecard3_model(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL);
 
 	// minisat's model
-	Gluecard30::vec<Gluecard30::lbool> *m = &(s->model);
+	Model *m = &(s->model);
 
 	if (m->size()) {
 		// l_True fails to work
-		Gluecard30::lbool True = Gluecard30::lbool((uint8_t)0);
+		lbool True = lbool((uint8_t)0);
 
 		PyObject *model = PyList_New(m->size() - 1);
 		for (int i = 1; i < m->size(); ++i) {
@@ -1577,7 +2930,8 @@ static PyObject *py_gluecard3_model(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_nof_vars(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_core_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -1585,35 +2939,27 @@ static PyObject *py_gluecard3_nof_vars(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE_BUF);
 
-//
-//=============================================================================
-static PyObject *py_gluecard3_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+	Conflict *c = &(s->conflict);  // minisat's conflict
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+			c->size() * sizeof(int32_t));
+	if (b_obj == NULL)
 		return NULL;
 
-	// get pointer to solver
-	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
+	int32_t *lits = (int32_t *)PyBytes_AS_STRING(b_obj);
+	for (int i = 0; i < c->size(); ++i)
+		lits[i] = T::var((*c)[i]) * (T::sign((*c)[i]) ? 1 : -1);
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	return pybytes_to_view(b_obj, "i");
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_del(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_model_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -1621,440 +2967,591 @@ static PyObject *py_gluecard3_del(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCObject_AsVoidPtr(s_obj);
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL_BUF);
 
-	if (s->certifiedUNSAT == true)
-		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
-#else
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	// minisat's model
+	Model *m = &(s->model);
 
-	if (s->certifiedUNSAT == true)
-		Py_DECREF((PyObject *)s->certifiedPyFile);
-#endif
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+			m->size() ? m->size() - 1 : 0);
+	if (b_obj == NULL)
+		return NULL;
 
-	delete s;
-	Py_RETURN_NONE;
+	// l_True fails to work
+	lbool True = lbool((uint8_t)0);
+
+	int8_t *vals = (int8_t *)PyBytes_AS_STRING(b_obj);
+	for (int i = 1; i < m->size(); ++i)
+		vals[i - 1] = (*m)[i] == True ? 1 : -1;
+
+	return pybytes_to_view(b_obj, "b");
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard3_acc_stats(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_enum_models(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *a_obj;  // assumptions
+	PyObject *p_obj;  // projection variables
+	int limit;
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOOii", &s_obj, &a_obj, &p_obj, &limit,
+				&main_thread))
+		return NULL;
+
+	if (limit <= 0) {
+		PyErr_SetString(PyExc_ValueError, "positive limit expected");
 		return NULL;
+	}
 
 	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ENUM);
+	Lits a;
+	int max_var = -1;
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_GLUECARD30
+	if (iterate(a_obj, a, max_var) == false)
+		return NULL;
 
-// API for Gluecard 3.0
-//=============================================================================
-#ifdef WITH_GLUECARD41
-static PyObject *py_gluecard41_new(PyObject *self, PyObject *args)
-{
-	Gluecard41::Solver *s = new Gluecard41::Solver();
+	vector<int> vars;
+	if (pyproj_to_vector(p_obj, vars, max_var, s->nVars() - 1) == false)
+		return NULL;
 
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
+	if (max_var > 0)
+		declare_vars(s, max_var);
+
+	if (!active(s, a))
 		return NULL;
-	}
 
-	return void_to_pyobj((void *)s);
-}
+	SigIntState sig_state = { sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void gluecard41_declare_vars(Gluecard41::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
+	vector<int32_t> models;
+	bool done = false;
 
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool gluecard41_iterate(
-	PyObject *obj,
-	Gluecard41::vec<Gluecard41::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	// l_True fails to work
+	lbool True = lbool((uint8_t)0);
 
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
+	Lits cl;  // blocking clause, reused for all models
+	for (int n = 0; n < limit && !done; ++n) {
+		if (!s->solve(a)) {
+			done = true;
+			break;
 		}
 
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
+		cl.clear();
+		for (size_t i = 0; i < vars.size(); ++i) {
+			int v = vars[i];
+			bool value = s->model[v] == True;
 
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
+			models.push_back(value ? v : -v);
+			cl.push(T::mkLit(v, value));
 		}
 
-		v.push((l > 0) ? Gluecard41::mkLit(l, false) : Gluecard41::mkLit(-l, true));
+		models.push_back(0);
+		done = !s->addClause(cl);
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
-		if (abs(l) > max_var)
-			max_var = abs(l);
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (!finish(s))
+		return NULL;
+
+	if (sig_state.caught) {
+		s->clearInterrupt();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
 	}
 
-	Py_DECREF(i_obj);
-	return true;
+	return pymodels_to_tuple(models, done);
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_add_cl(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_nof_vars(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	Gluecard41::vec<Gluecard41::Lit> cl;
-	int max_var = -1;
-
-	if (gluecard41_iterate(c_obj, cl, max_var) == false)
-		return NULL;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
+	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
 
-	PyObject *ret = PyBool_FromLong((long)res);
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
 	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_add_am(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_nof_cls(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
-	int64_t rhs;
 
-	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	Gluecard41::vec<Gluecard41::Lit> cl;
-	int max_var = -1;
-
-	if (gluecard41_iterate(c_obj, cl, max_var) == false)
-		return NULL;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
-
-	bool res = s->addAtMost(cl, rhs);
+	int nof_cls = s->nClauses();
 
-	PyObject *ret = PyBool_FromLong((long)res);
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
 	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_solve(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_acc_stats(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	Gluecard41::vec<Gluecard41::Lit> a;
-	int max_var = -1;
+#if PY_MAJOR_VERSION < 3
+	Solver *s = (Solver *)PyCObject_AsVoidPtr(s_obj);
+#else
+	Solver *s = (Solver *)PyCapsule_GetPointer(s_obj, NULL);
+#endif
 
-	if (gluecard41_iterate(a_obj, a, max_var) == false)
-		return NULL;
+	return stats((void *)s);
+}
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
+// the accumulated statistics of a solver, also reported to the progress
+// callback while the solver is running
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::stats(void *ptr)
+{
+	Solver *s = (Solver *)ptr;
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	PyObject *stats = Py_BuildValue("{s:l,s:l,s:l,s:l}",
+		"restarts", s->starts,
+		"conflicts", s->conflicts,
+		"decisions", s->decisions,
+		"propagations", s->propagations
+	);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	return pystats_add_calls(stats, ptr);
+}
 
-	bool res = s->solve(a);
+// the bytes taken by the clause arena, the learnt clauses and the watches
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_memory(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+
+	uint64_t arena, learnt, watch;
+	s->memoryUsage(arena, learnt, watch);
+
+	return Py_BuildValue("{s:K,s:K,s:K,s:K}",
+		"arena", (unsigned long long)arena,
+		"learnts", (unsigned long long)learnt,
+		"watches", (unsigned long long)watch,
+		"total", (unsigned long long)(arena + watch)
+	);
 }
 
-//
+// dropping learnt clauses and compacting the clause arena
 //=============================================================================
-static PyObject *py_gluecard41_solve_lim(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_reduce(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	Gluecard41::vec<Gluecard41::Lit> a;
-	int max_var = -1;
-
-	if (gluecard41_iterate(a_obj, a, max_var) == false)
-		return NULL;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
+	s->reduceLearnts();
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
+	Py_RETURN_NONE;
+}
 
-	Gluecard41::lbool res = Gluecard41::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
+// the callbacks of a solver, which are created when first needed
+//=============================================================================
+template <class T>
+SolverCallbacks *MinisatAdapter<T>::callbacks(Solver *s)
+{
+	if (s->exchange == NULL) {
+		s->exchange = (void *)new SolverCallbacks((void *)s, sigint, stats);
+		s->exchange_put = SolverCallbacks::put;
+		s->exchange_get = SolverCallbacks::get;
+	}
 
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
+	return (SolverCallbacks *)s->exchange;
+}
 
-		res = s->solveLimited(a);
+// the solver runs without a detour once its callbacks are all gone
+//=============================================================================
+template <class T>
+void MinisatAdapter<T>::release(Solver *s)
+{
+	SolverCallbacks *c = (SolverCallbacks *)s->exchange;
 
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
+	if (c && c->idle()) {
+		delete c;
+		s->exchange = NULL;
+		s->exchange_put = NULL;
+		s->exchange_get = NULL;
 	}
+}
+
+// finishing the callbacks after a call to the solver; false is returned if
+// one of them raised an exception (which then stopped the solver)
+//=============================================================================
+template <class T>
+bool MinisatAdapter<T>::finish(Solver *s)
+{
+	SolverCallbacks *c = (SolverCallbacks *)T::exchange(s);
 
-	if (res != Gluecard41::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Gluecard41::toInt(res)));
+	if (c == NULL || c->finish())
+		return true;
 
-	Py_RETURN_NONE;  // return Python's None if l_Undef
+	s->clearInterrupt();
+	return false;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_propagate(PyObject *self, PyObject *args)
+template <class T>
+PyObject *MinisatAdapter<T>::py_learnts(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
+	PyObject *c_obj;
+	int max_size;
+	int max_lbd;
+	int batch;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OOiii", &s_obj, &c_obj, &max_size, &max_lbd,
+				&batch))
+		return NULL;
+
+	if (c_obj != Py_None && !PyCallable_Check(c_obj)) {
+		PyErr_SetString(PyExc_TypeError, "Callback must be callable.");
 		return NULL;
+	}
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	Gluecard41::vec<Gluecard41::Lit> a;
-	int max_var = -1;
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	if (gluecard41_iterate(a_obj, a, max_var) == false)
-		return NULL;
+	callbacks(s)->learnts(c_obj != Py_None ? c_obj : NULL, max_size,
+			max_lbd, batch);
+	release(s);
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
+	Py_RETURN_NONE;
+}
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+//
+//=============================================================================
+template <class T>
+PyObject *MinisatAdapter<T>::py_progress(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *c_obj;
+	int every;
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &c_obj, &every))
+		return NULL;
+
+	if (c_obj != Py_None && !PyCallable_Check(c_obj)) {
+		PyErr_SetString(PyExc_TypeError, "Callback must be callable.");
+		return NULL;
 	}
 
-	Gluecard41::vec<Gluecard41::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
+	// get pointer to solver
+	Solver *s = (Solver *)pyobj_to_void(s_obj);
 
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Gluecard41::var(p[i]) * (Gluecard41::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
+	callbacks(s)->progress(c_obj != Py_None ? c_obj : NULL, every);
+	release(s);
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	Py_RETURN_NONE;
+}
+}  // extern "C++"
 
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
+// API for CaDiCaL
+//=============================================================================
+#ifdef WITH_CADICAL
+// terminate() cannot serve as an interrupt, as it would also stop the next
+// call if it came after the solver had already finished; instead, a solver
+// carries an interruption flag, which is polled by a terminator attached to
+// a call for its duration only; the flag is reached from the solver with no
+// lookup, and so it can be raised from a signal handler or another thread
+//=============================================================================
+class CadicalSolver : public CaDiCaL::Solver {
+public:
+	CadicalSolver() : interrupted(0) {}
 
-	return ret;
+	volatile sig_atomic_t interrupted;
+};
+
+// the interruption flag of a solver
+//=============================================================================
+static inline volatile sig_atomic_t *cadical_flag(void *s)
+{
+	return &static_cast<CadicalSolver *>((CaDiCaL::Solver *)s)->interrupted;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_setphases(PyObject *self, PyObject *args)
+static PyObject *py_cadical_new(PyObject *self, PyObject *args)
+{
+	CaDiCaL::Solver *s = new CadicalSolver;
+
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
+
+	return void_to_pyobj((void *)s);
+}
+
+// CaDiCaL copies nothing but its irredundant clauses (and what is needed to
+// reconstruct the models), and so warm is ignored
+//=============================================================================
+static PyObject *py_cadical_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *c = new CadicalSolver;
 
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	if (max_var > 0)
-		gluecard41_declare_vars(s, max_var);
+	Py_BEGIN_ALLOW_THREADS
+	c->reserve(s->vars());
+	s->copy(*c);
+	Py_END_ALLOW_THREADS
 
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
+	return void_to_pyobj((void *)c);
+}
 
-	Py_RETURN_NONE;
+// interrupting the solver from the SIGINT handler
+//=============================================================================
+static void cadical_sigint(void *s)
+{
+	*cadical_flag(s) = 1;
 }
 
-//
+// clearing the interruption flag
 //=============================================================================
-static PyObject *py_gluecard41_cbudget(PyObject *self, PyObject *args)
+static void cadical_clearint(void *s)
 {
-	PyObject *s_obj;
-	int64_t budget;
+	*cadical_flag(s) = 0;
+}
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
+// terminator polling a stop flag, i.e. the flag of a portfolio race or the
+// interruption flag of the solver
+//=============================================================================
+class CadicalTerminator : public CaDiCaL::Terminator {
+public:
+	CadicalTerminator(volatile sig_atomic_t *flag) : stop(flag) {}
+	bool terminate() { return *stop != 0; }
 
-	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+private:
+	volatile sig_atomic_t *stop;
+};
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
+// running the solver in a portfolio thread
+//=============================================================================
+static int cadical_race(void *ptr, const vector<int>& assumps, int max_var,
+		volatile sig_atomic_t *stop)
+{
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)ptr;
 
-	Py_RETURN_NONE;
+	for (size_t i = 0; i < assumps.size(); ++i)
+		s->assume(assumps[i]);
+
+	CadicalTerminator term(stop);
+	s->connect_terminator(&term);
+	int status = s->solve();
+	s->disconnect_terminator();
+
+	return status;
 }
 
-//
+// adding a clause on behalf of the RC2 engine
 //=============================================================================
-static PyObject *py_gluecard41_pbudget(PyObject *self, PyObject *args)
+static void cadical_rc2_add(void *ptr, const vector<int>& cl)
 {
-	PyObject *s_obj;
-	int64_t budget;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)ptr;
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
+	for (size_t i = 0; i < cl.size(); ++i)
+		s->add(cl[i]);
+	s->add(0);
+}
 
-	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+// a (possibly limited) call made by the RC2 engine
+//=============================================================================
+static int cadical_rc2_solve(void *ptr, const vector<int>& assumps,
+		int64_t budget)
+{
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)ptr;
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+	// assumptions and limits are dropped after every call
+	for (size_t i = 0; i < assumps.size(); ++i)
+		s->assume(assumps[i]);
 
-	Py_RETURN_NONE;
+	if (budget > 0)
+		s->limit("conflicts", budget > INT_MAX ? INT_MAX : (int)budget);
+
+	CadicalTerminator term(cadical_flag(ptr));
+
+	s->connect_terminator(&term);
+	int status = s->solve();
+	s->disconnect_terminator();
+
+	return status;
 }
 
-//
+// the core of the last call made by the RC2 engine
 //=============================================================================
-static PyObject *py_gluecard41_interrupt(PyObject *self, PyObject *args)
+static void cadical_rc2_core(void *ptr, const vector<int>& assumps,
+		vector<int>& core)
 {
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)ptr;
 
-	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	for (size_t i = 0; i < assumps.size(); ++i)
+		if (s->failed(assumps[i]))
+			core.push_back(assumps[i]);
+}
 
-	s->interrupt();
+// the model of the last call made by the RC2 engine
+//=============================================================================
+static void cadical_rc2_model(void *ptr, vector<int>& model)
+{
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)ptr;
 
-	Py_RETURN_NONE;
+	int maxvar = s->vars();
+	for (int i = 1; i <= maxvar; ++i)
+		model.push_back(s->val(i) > 0 ? i : -i);
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_clearint(PyObject *self, PyObject *args)
+static PyObject *py_cadical_add_cl(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *c_obj;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_CL);
 
-	s->clearInterrupt();
+	// clause iterator
+	PyObject *i_obj = PyObject_GetIter(c_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Clause does not seem to be an iterable object.");
+		return NULL;
+	}
 
-	Py_RETURN_NONE;
+	PyObject *l_obj;
+	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
+		if (!pyint_check(l_obj)) {
+			Py_DECREF(l_obj);
+			Py_DECREF(i_obj);
+			PyErr_SetString(PyExc_TypeError, "integer expected");
+			return NULL;
+		}
+
+		int l = pyint_to_cint(l_obj);
+		Py_DECREF(l_obj);
+
+		if (l == 0) {
+			Py_DECREF(i_obj);
+			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
+			return NULL;
+		}
+
+		s->add(l);
+	}
+
+	s->add(0);
+	Py_DECREF(i_obj);
+
+	PyObject *ret = PyBool_FromLong((long)true);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_setincr(PyObject *self, PyObject *args)
+static PyObject *py_cadical_add_cls_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *b_obj;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &b_obj))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_BUF);
 
-	s->setIncrementalMode();
+	Py_buffer view;
+	if (pybuf_get_int32(b_obj, &view) == false)
+		return NULL;
 
-	Py_RETURN_NONE;
+	const int32_t *lits = (const int32_t *)view.buf;
+	Py_ssize_t size = view.len / view.itemsize;
+
+	// the buffer is zero-terminated, which is exactly how CaDiCaL expects
+	// clauses to be added, literal by literal
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	for (Py_ssize_t i = 0; i < size; ++i)
+		s->add(lits[i]);
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&view);
+
+	PyObject *ret = PyBool_FromLong((long)true);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_tracepr(PyObject *self, PyObject *args)
+static PyObject *py_cadical_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *p_obj;
@@ -2064,12 +3561,12 @@ static PyObject *py_gluecard41_tracepr(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCObject_AsVoidPtr(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	s->certifiedOutput = PyFile_AsFile(p_obj);
+	s->trace_proof(PyFile_AsFile(p_obj), "<py_fobj>");
 	PyFile_IncUseCount((PyFileObject *)p_obj);
 #else
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
 	int fd = PyObject_AsFileDescriptor(p_obj);
 	if (fd == -1) {
@@ -2077,108 +3574,159 @@ static PyObject *py_gluecard41_tracepr(PyObject *self, PyObject *args)
 		return NULL;
 	}
 
-	s->certifiedOutput = fdopen(fd, "w+");
-	if (s->certifiedOutput == 0) {
+	FILE *cd_trace_fp = fdopen(fd, "w+");
+	if (cd_trace_fp == NULL) {
 		PyErr_SetString(SATError, "Cannot create proof file pointer!");
 		return NULL;
 	}
 
-	setlinebuf(s->certifiedOutput);
+	setlinebuf(cd_trace_fp);
+	s->trace_proof(cd_trace_fp, "<py_fobj>");
 	Py_INCREF(p_obj);
 #endif
 
-	s->certifiedUNSAT  = true;
-	s->certifiedPyFile = (void *)p_obj;
-
+	s->set("binary", 0);
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_core(PyObject *self, PyObject *args)
+static PyObject *py_cadical_solve(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *a_obj;  // assumptions
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE);
 
-	Gluecard41::vec<Gluecard41::Lit> *c = &(s->conflict);  // minisat's conflict
+	// assumptions iterator
+	PyObject *i_obj = PyObject_GetIter(a_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return NULL;
+	}
 
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Gluecard41::var((*c)[i]) * (Gluecard41::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
+	PyObject *l_obj;
+	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
+		if (!pyint_check(l_obj)) {
+			Py_DECREF(l_obj);
+			Py_DECREF(i_obj);
+			PyErr_SetString(PyExc_TypeError, "integer expected");
+			return NULL;
+		}
+
+		int l = pyint_to_cint(l_obj);
+		Py_DECREF(l_obj);
+
+		if (l == 0) {
+			Py_DECREF(i_obj);
+			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
+			return NULL;
+		}
+
+		s->assume(l);
 	}
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
+	Py_DECREF(i_obj);
+
+	CadicalTerminator term(cadical_flag((void *)s));
+
+	SigIntState sig_state = { cadical_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	int status;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	s->connect_terminator(&term);
+	status = s->solve();
+	s->disconnect_terminator();
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (sig_state.caught) {
+		cadical_clearint((void *)s);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
 	}
 
-	Py_DECREF(core);
-	Py_RETURN_NONE;
+	bool res = status == 10 ? true : false;
+
+	PyObject *ret = PyBool_FromLong((long)res);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_model(PyObject *self, PyObject *args)
+static PyObject *py_cadical_solve_lim(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *a_obj;  // assumptions
+	int main_thread;
+	int expect_interrupt;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
+				&expect_interrupt))
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE_LIM);
 
-	// minisat's model
-	Gluecard41::vec<Gluecard41::lbool> *m = &(s->model);
+	vector<int> a;
+	int max_var = -1;
+	if (pyiter_to_vector(a_obj, a, max_var) == false)
+		return NULL;
 
-	if (m->size()) {
-		// l_True fails to work
-		Gluecard41::lbool True = Gluecard41::lbool((uint8_t)0);
+	for (size_t i = 0; i < a.size(); ++i)
+		s->assume(a[i]);
 
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
+	// as in cadical_race(), the terminator is attached to this call only;
+	// expect_interrupt is accepted for compatibility with the other solvers
+	CadicalTerminator term(cadical_flag((void *)s));
 
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
+	SigIntState sig_state = { cadical_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-	Py_RETURN_NONE;
-}
+	int status;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	s->connect_terminator(&term);
+	status = s->solve();
+	s->disconnect_terminator();
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
-//
-//=============================================================================
-static PyObject *py_gluecard41_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+	if (main_thread)
+		sigint_restore(sig_save);
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (sig_state.caught) {
+		cadical_clearint((void *)s);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
 		return NULL;
+	}
 
-	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	if (status == 10 || status == 20)
+		return PyBool_FromLong((long)(status == 10));
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
+	Py_RETURN_NONE;  // the call was interrupted
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_nof_cls(PyObject *self, PyObject *args)
+static PyObject *py_cadical_interrupt(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2186,17 +3734,16 @@ static PyObject *py_gluecard41_nof_cls(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	void *s = pyobj_to_void(s_obj);
 
-	int nof_cls = s->nClauses();
+	*cadical_flag(s) = 1;
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_del(PyObject *self, PyObject *args)
+static PyObject *py_cadical_clearint(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2204,361 +3751,423 @@ static PyObject *py_gluecard41_del(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCObject_AsVoidPtr(s_obj);
+	void *s = pyobj_to_void(s_obj);
 
-	if (s->certifiedUNSAT == true)
-		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
-#else
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	if (s->certifiedUNSAT == true)
-		Py_DECREF((PyObject *)s->certifiedPyFile);
-#endif
+	// the flag may be polled by a running call, and so it is kept
+	*cadical_flag(s) = 0;
 
-	delete s;
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_gluecard41_acc_stats(PyObject *self, PyObject *args)
+static PyObject *py_cadical_solve_batch(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *q_obj;  // a sequence of assumption sets
+	int want_models;
+	int want_cores;
+	int64_t budget;
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOiiLi", &s_obj, &q_obj, &want_models,
+				&want_cores, &budget, &main_thread))
 		return NULL;
 
 	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE_BATCH);
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_GLUECARD41
+	vector<int> all;
+	vector<size_t> bounds;
+	int max_var = -1;
+	if (pysets_to_vector(q_obj, all, bounds, max_var) == false)
+		return NULL;
 
-// API for Glucose 3.0
-//=============================================================================
-#ifdef WITH_GLUCOSE30
-static PyObject *py_glucose3_new(PyObject *self, PyObject *args)
-{
-	Glucose30::Solver *s = new Glucose30::Solver();
+	CadicalTerminator term(cadical_flag((void *)s));
 
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
+	SigIntState sig_state = { cadical_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	vector<int8_t> status;
+	vector<int64_t> offs(1, 0);
+	vector<int32_t> lits;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	s->connect_terminator(&term);
+	for (size_t i = 0; i + 1 < bounds.size() && !sig_state.caught; ++i) {
+		// assumptions and limits are dropped after every call
+		for (size_t j = bounds[i]; j < bounds[i + 1]; ++j)
+			s->assume(all[j]);
+
+		if (budget > 0)
+			s->limit("conflicts", budget > INT_MAX ? INT_MAX : (int)budget);
+
+		int res = s->solve();
+		if (res == 10) {
+			status.push_back(1);
+
+			if (want_models)
+				for (int v = 1; v <= s->vars(); ++v)
+					lits.push_back(s->val(v) > 0 ? v : -v);
+		}
+		else if (res == 20) {
+			status.push_back(0);
+
+			if (want_cores)
+				for (size_t j = bounds[i]; j < bounds[i + 1]; ++j)
+					if (s->failed(all[j]))
+						lits.push_back(all[j]);
+		}
+		else
+			status.push_back(-1);
+
+		offs.push_back(lits.size());
 	}
+	s->disconnect_terminator();
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
-	return void_to_pyobj((void *)s);
-}
+	if (main_thread)
+		sigint_restore(sig_save);
 
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void glucose3_declare_vars(Glucose30::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
+	if (sig_state.caught) {
+		cadical_clearint((void *)s);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	return pybatch_to_tuple(status, offs, lits);
 }
 
-// translating an iterable to vec<Lit>
+// auxiliary function for a (possibly limited) call made in MUS extraction:
+// 1 stands for SAT, 0 for UNSAT, and -1 for an exceeded budget; the core is
+// collected from the failed assumptions
 //=============================================================================
-static inline bool glucose3_iterate(
-	PyObject *obj,
-	Glucose30::vec<Glucose30::Lit>& v,
-	int& max_var
-)
+static int cadical_check(CaDiCaL::Solver *s, const vector<int>& a,
+		int64_t budget, vector<int>& core)
 {
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
+	for (size_t i = 0; i < a.size(); ++i)
+		s->assume(a[i]);
 
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
+	if (budget > 0)
+		s->limit("conflicts", budget > INT_MAX ? INT_MAX : (int)budget);
 
-		v.push((l > 0) ? Glucose30::mkLit(l, false) : Glucose30::mkLit(-l, true));
+	int res = s->solve();
+	if (res != 20)
+		return res == 10 ? 1 : -1;
 
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
+	core.clear();
+	for (size_t i = 0; i < a.size(); ++i)
+		if (s->failed(a[i]))
+			core.push_back(a[i]);
 
-	Py_DECREF(i_obj);
-	return true;
+	return 0;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_add_cl(PyObject *self, PyObject *args)
+static PyObject *py_cadical_extract_mus(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
+	PyObject *l_obj;  // selectors
+	int64_t budget;
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
+	if (!PyArg_ParseTuple(args, "OOLi", &s_obj, &l_obj, &budget,
+				&main_thread))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-	Glucose30::vec<Glucose30::Lit> cl;
-	int max_var = -1;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MUS);
 
-	if (glucose3_iterate(c_obj, cl, max_var) == false)
+	vector<int> sels;
+	int max_var = -1;
+	if (pyiter_to_vector(l_obj, sels, max_var) == false)
 		return NULL;
 
-	if (max_var > 0)
-		glucose3_declare_vars(s, max_var);
+	CadicalTerminator term(cadical_flag((void *)s));
 
-	bool res = s->addClause(cl);
+	SigIntState sig_state = { cadical_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	vector<int> approx, core, a;
+	bool unsat;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	s->connect_terminator(&term);
+	// the whole set is checked with no budget
+	unsat = cadical_check(s, sels, 0, core) == 0;
+
+	if (unsat) {
+		vector<char> mark(std::max(max_var, s->vars()) + 1, 0);
+
+		// the first core is an over-approximation of an MUS
+		approx = sels;
+		musx_refine(approx, approx.size(), core, mark);
+
+		size_t i = 0;
+		while (i < approx.size() && !sig_state.caught) {
+			a.clear();
+			for (size_t j = 0; j < approx.size(); ++j)
+				if (j != i)
+					a.push_back(approx[j]);
+
+			if (cadical_check(s, a, budget, core) != 0) {
+				++i;  // necessary or unknown; keeping it
+				continue;
+			}
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+			// clause-set refinement
+			i = musx_refine(approx, i, core, mark);
+		}
+	}
+	s->disconnect_terminator();
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (sig_state.caught) {
+		cadical_clearint((void *)s);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	if (!unsat)
+		Py_RETURN_NONE;
+
+	return pylist_from_vector(approx);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_solve(PyObject *self, PyObject *args)
+static PyObject *py_cadical_core(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *a_obj;  // assumptions
-	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &a_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-	Glucose30::vec<Glucose30::Lit> a;
-	int max_var = -1;
-
-	if (glucose3_iterate(a_obj, a, max_var) == false)
-		return NULL;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE);
 
-	if (max_var > 0)
-		glucose3_declare_vars(s, max_var);
+	int size = (int)PyList_Size(a_obj);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	vector<int> c;
+	for (int i = 0; i < size; ++i) {
+		PyObject *l_obj = PyList_GetItem(a_obj, i);
+		int l = pyint_to_cint(l_obj);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+		if (s->failed(l))
+			c.push_back(l);
 	}
 
-	bool res = s->solve(a);
+	PyObject *core = PyList_New(c.size());
+	for (size_t i = 0; i < c.size(); ++i) {
+		PyObject *lit = pyint_from_cint(c[i]);
+		PyList_SetItem(core, i, lit);
+	}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	if (c.size()) {
+		PyObject *ret = Py_BuildValue("O", core);
+		Py_DECREF(core);
+		return ret;
+	}
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+	Py_DECREF(core);
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_solve_lim(PyObject *self, PyObject *args)
+static PyObject *py_cadical_model(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-	Glucose30::vec<Glucose30::Lit> a;
-	int max_var = -1;
-
-	if (glucose3_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		glucose3_declare_vars(s, max_var);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL);
 
-	Glucose30::lbool res = Glucose30::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	int maxvar = s->vars();
+	if (maxvar) {
+		PyObject *model = PyList_New(maxvar);
+		for (int i = 1; i <= maxvar; ++i) {
+			int l = s->val(i) > 0 ? i : -i;
 
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
+			PyObject *lit = pyint_from_cint(l);
+			PyList_SetItem(model, i - 1, lit);
 		}
 
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
+		PyObject *ret = Py_BuildValue("O", model);
+		Py_DECREF(model);
+		return ret;
 	}
 
-	if (res != Glucose30::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Glucose30::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_propagate(PyObject *self, PyObject *args)
+static PyObject *py_cadical_core_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &a_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-	Glucose30::vec<Glucose30::Lit> a;
-	int max_var = -1;
-
-	if (glucose3_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		glucose3_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE_BUF);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	int size = (int)PyList_Size(a_obj);
 
-	Glucose30::vec<Glucose30::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
+	vector<int32_t> c;
+	for (int i = 0; i < size; ++i) {
+		PyObject *l_obj = PyList_GetItem(a_obj, i);
+		int l = pyint_to_cint(l_obj);
 
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Glucose30::var(p[i]) * (Glucose30::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
+		if (s->failed(l))
+			c.push_back(l);
 	}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+			c.size() * sizeof(int32_t));
+	if (b_obj == NULL)
+		return NULL;
 
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
+	if (c.size())
+		memcpy(PyBytes_AS_STRING(b_obj), &c[0], c.size() * sizeof(int32_t));
 
-	return ret;
+	return pybytes_to_view(b_obj, "i");
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_setphases(PyObject *self, PyObject *args)
+static PyObject *py_cadical_model_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL_BUF);
 
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
+	int maxvar = s->vars();
 
-	if (max_var > 0)
-		glucose3_declare_vars(s, max_var);
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL, maxvar);
+	if (b_obj == NULL)
+		return NULL;
 
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
+	int8_t *vals = (int8_t *)PyBytes_AS_STRING(b_obj);
+	for (int i = 1; i <= maxvar; ++i)
+		vals[i - 1] = s->val(i) > 0 ? 1 : -1;
 
-	Py_RETURN_NONE;
+	return pybytes_to_view(b_obj, "b");
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_cbudget(PyObject *self, PyObject *args)
+static PyObject *py_cadical_enum_models(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	PyObject *a_obj;  // assumptions
+	PyObject *p_obj;  // projection variables
+	int limit;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOOii", &s_obj, &a_obj, &p_obj, &limit,
+				&main_thread))
+		return NULL;
+
+	if (limit <= 0) {
+		PyErr_SetString(PyExc_ValueError, "positive limit expected");
 		return NULL;
+	}
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ENUM);
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
+	vector<int> a;
+	int max_var = -1;
+	if (pyiter_to_vector(a_obj, a, max_var) == false)
+		return NULL;
 
-	Py_RETURN_NONE;
-}
+	vector<int> vars;
+	if (pyproj_to_vector(p_obj, vars, max_var, s->vars()) == false)
+		return NULL;
 
-//
-//=============================================================================
-static PyObject *py_glucose3_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
+	CadicalTerminator term(cadical_flag((void *)s));
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
+	SigIntState sig_state = { cadical_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+
+	vector<int32_t> models;
+	bool done = false;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	s->connect_terminator(&term);
+	for (int n = 0; n < limit && !sig_state.caught; ++n) {
+		// assumptions are dropped after every call
+		for (size_t i = 0; i < a.size(); ++i)
+			s->assume(a[i]);
+
+		int status = s->solve();
+		if (status != 10) {
+			done = status == 20;
+			break;
+		}
 
-	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+		// values are accessible only until a new clause is started
+		size_t start = models.size();
+		for (size_t i = 0; i < vars.size(); ++i)
+			models.push_back(s->val(vars[i]) > 0 ? vars[i] : -vars[i]);
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+		for (size_t i = start; i < models.size(); ++i)
+			s->add(-models[i]);
 
-	Py_RETURN_NONE;
+		models.push_back(0);
+		s->add(0);
+	}
+	s->disconnect_terminator();
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (sig_state.caught) {
+		cadical_clearint((void *)s);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	return pymodels_to_tuple(models, done);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_interrupt(PyObject *self, PyObject *args)
+static PyObject *py_cadical_nof_vars(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2566,16 +4175,17 @@ static PyObject *py_glucose3_interrupt(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
 
-	s->interrupt();
+	int nof_vars = s->vars();
 
-	Py_RETURN_NONE;
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_clearint(PyObject *self, PyObject *args)
+static PyObject *py_cadical_nof_cls(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2583,157 +4193,175 @@ static PyObject *py_glucose3_clearint(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)pyobj_to_void(s_obj);
 
-	s->clearInterrupt();
+	int nof_cls = s->irredundant() + s->redundant();
 
-	Py_RETURN_NONE;
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_setincr(PyObject *self, PyObject *args)
+static PyObject *py_cadical_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+#if PY_MAJOR_VERSION < 3
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	s->setIncrementalMode();
+	if (p_obj != Py_None)
+		PyFile_DecUseCount((PyFileObject *)p_obj);
+#else
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+
+	if (p_obj != Py_None)
+		Py_DECREF(p_obj);
+#endif
 
+	call_stats.erase((void *)s);
+	delete static_cast<CadicalSolver *>(s);
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_tracepr(PyObject *self, PyObject *args)
+static PyObject *py_cadical_acc_stats(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	s->certifiedOutput = PyFile_AsFile(p_obj);
-	PyFile_IncUseCount((PyFileObject *)p_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCObject_AsVoidPtr(s_obj);
 #else
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	int fd = PyObject_AsFileDescriptor(p_obj);
-	if (fd == -1) {
-		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
-		return NULL;
-	}
-
-	s->certifiedOutput = fdopen(fd, "w+");
-	if (s->certifiedOutput == 0) {
-		PyErr_SetString(SATError, "Cannot create proof file pointer!");
-		return NULL;
-	}
-
-	setlinebuf(s->certifiedOutput);
-	Py_INCREF(p_obj);
+	CaDiCaL::Solver *s = (CaDiCaL::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 #endif
 
-	s->certifiedUNSAT  = true;
-	s->certifiedPyFile = (void *)p_obj;
+	PyObject *stats = Py_BuildValue("{s:l,s:l,s:l,s:l}",
+		"restarts", s->restarts(),
+		"conflicts", s->conflicts(),
+		"decisions", s->decisions(),
+		"propagations", s->propagations()
+	);
 
-	Py_RETURN_NONE;
+	return pystats_add_calls(stats, (void *)s);
 }
+#endif  // WITH_CADICAL
 
-//
+// API for Gluecard 3.0
 //=============================================================================
-static PyObject *py_glucose3_core(PyObject *self, PyObject *args)
+#ifdef WITH_GLUECARD30
+static PyObject *py_gluecard3_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	Gluecard30::Solver *s = new Gluecard30::Solver();
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	return void_to_pyobj((void *)s);
+}
 
-	Glucose30::vec<Glucose30::Lit> *c = &(s->conflict);  // minisat's conflict
+// cloning hooks: AtMostK constraints are stored as clauses, learnt clauses
+// are ranked by their LBD, and the clone inherits the incremental mode
+//=============================================================================
+extern "C++" {
+template <>
+struct MinisatHooks<Gluecard30::Solver> : public Gluecard30::Solver {
+	static bool add(Gluecard30::Solver *to,
+			Gluecard30::vec<Gluecard30::Lit>& lits, Gluecard30::Clause& c)
+	{
+		if (!c.is_atmost())
+			return to->addClause(lits);
 
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Glucose30::var((*c)[i]) * (Glucose30::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
+		// an AtMostK constraint over n literals has n - k + 1 watches
+		return to->addAtMost(lits, c.size() - c.atmost_watches() + 1);
 	}
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
+	static void learnt(Gluecard30::Clause& to, Gluecard30::Clause& from)
+	{
+		to.activity() = from.activity();
+		to.setLBD(from.lbd());
 	}
 
-	Py_DECREF(core);
-	Py_RETURN_NONE;
-}
+	static void config(Gluecard30::Solver *from, Gluecard30::Solver *to)
+	{
+		to->*(&MinisatHooks::incremental) = from->*(&MinisatHooks::incremental);
+	}
+};
+}  // extern "C++"
 
 //
 //=============================================================================
-static PyObject *py_glucose3_model(PyObject *self, PyObject *args)
+static PyObject *py_gluecard3_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	Glucose30::vec<Glucose30::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		Glucose30::lbool True = Glucose30::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
+	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	Gluecard30::Solver *c = new Gluecard30::Solver();
 
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
 	}
 
-	Py_RETURN_NONE;
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Gluecard30::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
+
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_nof_vars(PyObject *self, PyObject *args)
+static PyObject *py_gluecard3_add_am(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *c_obj;
+	int64_t rhs;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_AM);
+	Gluecard30::vec<Gluecard30::Lit> cl;
+	int max_var = -1;
 
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	if (Gluecard30Api::iterate(c_obj, cl, max_var) == false)
+		return NULL;
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
+	if (max_var > 0)
+		Gluecard30Api::declare_vars(s, max_var);
+
+	timer.enter();
+	bool res = s->addAtMost(cl, rhs);
+	timer.leave();
+
+	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_nof_cls(PyObject *self, PyObject *args)
+static PyObject *py_gluecard3_setincr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2741,43 +4369,57 @@ static PyObject *py_glucose3_nof_cls(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)pyobj_to_void(s_obj);
 
-	int nof_cls = s->nClauses();
+	s->setIncrementalMode();
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_del(PyObject *self, PyObject *args)
+static PyObject *py_gluecard3_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCObject_AsVoidPtr(s_obj);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	if (s->certifiedUNSAT == true)
-		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
+	s->certifiedOutput = PyFile_AsFile(p_obj);
+	PyFile_IncUseCount((PyFileObject *)p_obj);
 #else
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (s->certifiedUNSAT == true)
-		Py_DECREF((PyObject *)s->certifiedPyFile);
+	int fd = PyObject_AsFileDescriptor(p_obj);
+	if (fd == -1) {
+		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
+		return NULL;
+	}
+
+	s->certifiedOutput = fdopen(fd, "w+");
+	if (s->certifiedOutput == 0) {
+		PyErr_SetString(SATError, "Cannot create proof file pointer!");
+		return NULL;
+	}
+
+	setlinebuf(s->certifiedOutput);
+	Py_INCREF(p_obj);
 #endif
 
-	delete s;
+	s->certifiedUNSAT  = true;
+	s->certifiedPyFile = (void *)p_obj;
+
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose3_acc_stats(PyObject *self, PyObject *args)
+static PyObject *py_gluecard3_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -2786,26 +4428,30 @@ static PyObject *py_glucose3_acc_stats(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCObject_AsVoidPtr(s_obj);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCObject_AsVoidPtr(s_obj);
+
+	if (s->certifiedUNSAT == true)
+		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
 #else
-	Glucose30::Solver *s = (Glucose30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	Gluecard30::Solver *s = (Gluecard30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+
+	if (s->certifiedUNSAT == true)
+		Py_DECREF((PyObject *)s->certifiedPyFile);
 #endif
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
+	call_stats.erase((void *)s);
+	delete s;
+	Py_RETURN_NONE;
 }
-#endif  // WITH_GLUCOSE30
 
-// API for Glucose 4.1
+#endif  // WITH_GLUECARD30
+
+// API for Gluecard 3.0
 //=============================================================================
-#ifdef WITH_GLUCOSE41
-static PyObject *py_glucose41_new(PyObject *self, PyObject *args)
+#ifdef WITH_GLUECARD41
+static PyObject *py_gluecard41_new(PyObject *self, PyObject *args)
 {
-	Glucose41::Solver *s = new Glucose41::Solver();
+	Gluecard41::Solver *s = new Gluecard41::Solver();
 
 	if (s == NULL) {
 		PyErr_SetString(PyExc_RuntimeError,
@@ -2816,121 +4462,88 @@ static PyObject *py_glucose41_new(PyObject *self, PyObject *args)
 	return void_to_pyobj((void *)s);
 }
 
-// auxiliary function for declaring new variables
+// cloning hooks: AtMostK constraints are stored as clauses, learnt clauses
+// are ranked by their LBD, and the clone inherits the incremental mode
 //=============================================================================
-static inline void glucose41_declare_vars(Glucose41::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
+extern "C++" {
+template <>
+struct MinisatHooks<Gluecard41::Solver> : public Gluecard41::Solver {
+	static bool add(Gluecard41::Solver *to,
+			Gluecard41::vec<Gluecard41::Lit>& lits, Gluecard41::Clause& c)
+	{
+		if (!c.is_atmost())
+			return to->addClause(lits);
 
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool glucose41_iterate(
-	PyObject *obj,
-	Glucose41::vec<Glucose41::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
+		// an AtMostK constraint over n literals has n - k + 1 watches
+		return to->addAtMost(lits, c.size() - c.atmost_watches() + 1);
 	}
 
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? Glucose41::mkLit(l, false) : Glucose41::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
+	static void learnt(Gluecard41::Clause& to, Gluecard41::Clause& from)
+	{
+		to.activity() = from.activity();
+		to.setLBD(from.lbd());
 	}
 
-	Py_DECREF(i_obj);
-	return true;
-}
+	static void config(Gluecard41::Solver *from, Gluecard41::Solver *to)
+	{
+		to->*(&MinisatHooks::incremental) = from->*(&MinisatHooks::incremental);
+	}
+};
+}  // extern "C++"
 
 //
 //=============================================================================
-static PyObject *py_glucose41_add_cl(PyObject *self, PyObject *args)
+static PyObject *py_gluecard41_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-	Glucose41::vec<Glucose41::Lit> cl;
-	int max_var = -1;
+	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	Gluecard41::Solver *c = new Gluecard41::Solver();
 
-	if (glucose41_iterate(c_obj, cl, max_var) == false)
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	if (max_var > 0)
-		glucose41_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Gluecard41::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_solve(PyObject *self, PyObject *args)
+static PyObject *py_gluecard41_add_am(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
+	PyObject *c_obj;
+	int64_t rhs;
 
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
+	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-	Glucose41::vec<Glucose41::Lit> a;
+	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_AM);
+	Gluecard41::vec<Gluecard41::Lit> cl;
 	int max_var = -1;
 
-	if (glucose41_iterate(a_obj, a, max_var) == false)
+	if (Gluecard41Api::iterate(c_obj, cl, max_var) == false)
 		return NULL;
 
 	if (max_var > 0)
-		glucose41_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+		Gluecard41Api::declare_vars(s, max_var);
 
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	timer.enter();
+	bool res = s->addAtMost(cl, rhs);
+	timer.leave();
 
 	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
@@ -2938,216 +4551,188 @@ static PyObject *py_glucose41_solve(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_glucose41_solve_lim(PyObject *self, PyObject *args)
+static PyObject *py_gluecard41_setincr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-	Glucose41::vec<Glucose41::Lit> a;
-	int max_var = -1;
-
-	if (glucose41_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		glucose41_declare_vars(s, max_var);
-
-	Glucose41::lbool res = Glucose41::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
+	Gluecard41::Solver *s = (Gluecard41::Solver *)pyobj_to_void(s_obj);
 
-	if (res != Glucose41::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Glucose41::toInt(res)));
+	s->setIncrementalMode();
 
-	Py_RETURN_NONE; // return Python's None if l_Undef
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_propagate(PyObject *self, PyObject *args)
+static PyObject *py_gluecard41_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-	Glucose41::vec<Glucose41::Lit> a;
-	int max_var = -1;
-
-	if (glucose41_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		glucose41_declare_vars(s, max_var);
+#if PY_MAJOR_VERSION < 3
+	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	s->certifiedOutput = PyFile_AsFile(p_obj);
+	PyFile_IncUseCount((PyFileObject *)p_obj);
+#else
+	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+	int fd = PyObject_AsFileDescriptor(p_obj);
+	if (fd == -1) {
+		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
+		return NULL;
 	}
 
-	Glucose41::vec<Glucose41::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Glucose41::var(p[i]) * (Glucose41::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
+	s->certifiedOutput = fdopen(fd, "w+");
+	if (s->certifiedOutput == 0) {
+		PyErr_SetString(SATError, "Cannot create proof file pointer!");
+		return NULL;
 	}
 
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
+	setlinebuf(s->certifiedOutput);
+	Py_INCREF(p_obj);
+#endif
 
-	return ret;
+	s->certifiedUNSAT  = true;
+	s->certifiedPyFile = (void *)p_obj;
+
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_setphases(PyObject *self, PyObject *args)
+static PyObject *py_gluecard41_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
+#if PY_MAJOR_VERSION < 3
+	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	if (max_var > 0)
-		glucose41_declare_vars(s, max_var);
+	if (s->certifiedUNSAT == true)
+		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
+#else
+	Gluecard41::Solver *s = (Gluecard41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
+	if (s->certifiedUNSAT == true)
+		Py_DECREF((PyObject *)s->certifiedPyFile);
+#endif
 
+	call_stats.erase((void *)s);
+	delete s;
 	Py_RETURN_NONE;
 }
 
-//
+#endif  // WITH_GLUECARD41
+
+// API for Glucose 3.0
 //=============================================================================
-static PyObject *py_glucose41_cbudget(PyObject *self, PyObject *args)
+#ifdef WITH_GLUCOSE30
+static PyObject *py_glucose3_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
-	int64_t budget;
+	Glucose30::Solver *s = new Glucose30::Solver();
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
+	return void_to_pyobj((void *)s);
 }
 
-//
+// cloning hooks: learnt clauses are ranked by their LBD, and the clone
+// inherits the incremental mode
 //=============================================================================
-static PyObject *py_glucose41_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+extern "C++" {
+template <>
+struct MinisatHooks<Glucose30::Solver> : public Glucose30::Solver {
+	template <class L, class C>
+	static bool add(Glucose30::Solver *to, L& lits, C& c)
+	{
+		return to->addClause(lits);
+	}
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+	static void learnt(Glucose30::Clause& to, Glucose30::Clause& from)
+	{
+		to.activity() = from.activity();
+		to.setLBD(from.lbd());
+	}
 
-	Py_RETURN_NONE;
-}
+	static void config(Glucose30::Solver *from, Glucose30::Solver *to)
+	{
+		to->*(&MinisatHooks::incremental) = from->*(&MinisatHooks::incremental);
+	}
+};
+}  // extern "C++"
 
 //
 //=============================================================================
-static PyObject *py_glucose41_interrupt(PyObject *self, PyObject *args)
+static PyObject *py_glucose3_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
+	Glucose30::Solver *c = new Glucose30::Solver();
 
-	s->interrupt();
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
 
-	Py_RETURN_NONE;
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Glucose30::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
+
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_clearint(PyObject *self, PyObject *args)
+static PyObject *py_glucose3_share(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
+	int max_lbd;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &p_obj, &max_lbd))
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
 
-	s->clearInterrupt();
+	if (s->certifiedUNSAT) {
+		PyErr_SetString(SATError, "Clause sharing is incompatible with proof tracing");
+		return NULL;
+	}
+
+	Glucose30Api::callbacks(s)->share(p_obj != Py_None ?
+			(ClauseExchange *)pyobj_to_void(p_obj) : NULL, max_lbd);
+	Glucose30Api::release(s);
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_setincr(PyObject *self, PyObject *args)
+static PyObject *py_glucose3_setincr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -3155,7 +4740,7 @@ static PyObject *py_glucose41_setincr(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+	Glucose30::Solver *s = (Glucose30::Solver *)pyobj_to_void(s_obj);
 
 	s->setIncrementalMode();
 
@@ -3164,7 +4749,7 @@ static PyObject *py_glucose41_setincr(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_glucose41_tracepr(PyObject *self, PyObject *args)
+static PyObject *py_glucose3_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *p_obj;
@@ -3174,12 +4759,12 @@ static PyObject *py_glucose41_tracepr(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	Glucose41::Solver *s = (Glucose41::Solver *)PyCObject_AsVoidPtr(s_obj);
+	Glucose30::Solver *s = (Glucose30::Solver *)PyCObject_AsVoidPtr(s_obj);
 
 	s->certifiedOutput = PyFile_AsFile(p_obj);
 	PyFile_IncUseCount((PyFileObject *)p_obj);
 #else
-	Glucose41::Solver *s = (Glucose41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	Glucose30::Solver *s = (Glucose30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
 	int fd = PyObject_AsFileDescriptor(p_obj);
 	if (fd == -1) {
@@ -3205,7 +4790,7 @@ static PyObject *py_glucose41_tracepr(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_glucose41_core(PyObject *self, PyObject *args)
+static PyObject *py_glucose3_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -3213,82 +4798,125 @@ static PyObject *py_glucose41_core(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+#if PY_MAJOR_VERSION < 3
+	Glucose30::Solver *s = (Glucose30::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	Glucose41::vec<Glucose41::Lit> *c = &(s->conflict);  // minisat's conflict
+	if (s->certifiedUNSAT == true)
+		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
+#else
+	Glucose30::Solver *s = (Glucose30::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Glucose41::var((*c)[i]) * (Glucose41::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
+	if (s->certifiedUNSAT == true)
+		Py_DECREF((PyObject *)s->certifiedPyFile);
+#endif
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
+	if (s->exchange)
+		delete (SolverCallbacks *)s->exchange;
 
-	Py_DECREF(core);
+	call_stats.erase((void *)s);
+	delete s;
 	Py_RETURN_NONE;
 }
 
+#endif  // WITH_GLUCOSE30
+
+// API for Glucose 4.1
+//=============================================================================
+#ifdef WITH_GLUCOSE41
+static PyObject *py_glucose41_new(PyObject *self, PyObject *args)
+{
+	Glucose41::Solver *s = new Glucose41::Solver();
+
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
+
+	return void_to_pyobj((void *)s);
+}
+
+// cloning hooks: learnt clauses are ranked by their LBD, and the clone
+// inherits the incremental mode
+//=============================================================================
+extern "C++" {
+template <>
+struct MinisatHooks<Glucose41::Solver> : public Glucose41::Solver {
+	template <class L, class C>
+	static bool add(Glucose41::Solver *to, L& lits, C& c)
+	{
+		return to->addClause(lits);
+	}
+
+	static void learnt(Glucose41::Clause& to, Glucose41::Clause& from)
+	{
+		to.activity() = from.activity();
+		to.setLBD(from.lbd());
+	}
+
+	static void config(Glucose41::Solver *from, Glucose41::Solver *to)
+	{
+		to->*(&MinisatHooks::incremental) = from->*(&MinisatHooks::incremental);
+	}
+};
+}  // extern "C++"
+
 //
 //=============================================================================
-static PyObject *py_glucose41_model(PyObject *self, PyObject *args)
+static PyObject *py_glucose41_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
 	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
+	Glucose41::Solver *c = new Glucose41::Solver();
 
-	// minisat's model
-	Glucose41::vec<Glucose41::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		Glucose41::lbool True = Glucose41::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
 	}
 
-	Py_RETURN_NONE;
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Glucose41::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
+
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_nof_vars(PyObject *self, PyObject *args)
+static PyObject *py_glucose41_share(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
+	int max_lbd;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &p_obj, &max_lbd))
 		return NULL;
 
 	// get pointer to solver
 	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
 
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	if (s->certifiedUNSAT) {
+		PyErr_SetString(SATError, "Clause sharing is incompatible with proof tracing");
+		return NULL;
+	}
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
+	Glucose41Api::callbacks(s)->share(p_obj != Py_None ?
+			(ClauseExchange *)pyobj_to_void(p_obj) : NULL, max_lbd);
+	Glucose41Api::release(s);
+
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_nof_cls(PyObject *self, PyObject *args)
+static PyObject *py_glucose41_setincr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -3298,41 +4926,55 @@ static PyObject *py_glucose41_nof_cls(PyObject *self, PyObject *args)
 	// get pointer to solver
 	Glucose41::Solver *s = (Glucose41::Solver *)pyobj_to_void(s_obj);
 
-	int nof_cls = s->nClauses();
+	s->setIncrementalMode();
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_del(PyObject *self, PyObject *args)
+static PyObject *py_glucose41_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
 	Glucose41::Solver *s = (Glucose41::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	if (s->certifiedUNSAT == true)
-		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
+	s->certifiedOutput = PyFile_AsFile(p_obj);
+	PyFile_IncUseCount((PyFileObject *)p_obj);
 #else
 	Glucose41::Solver *s = (Glucose41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (s->certifiedUNSAT == true)
-		Py_DECREF((PyObject *)s->certifiedPyFile);
+	int fd = PyObject_AsFileDescriptor(p_obj);
+	if (fd == -1) {
+		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
+		return NULL;
+	}
+
+	s->certifiedOutput = fdopen(fd, "w+");
+	if (s->certifiedOutput == 0) {
+		PyErr_SetString(SATError, "Cannot create proof file pointer!");
+		return NULL;
+	}
+
+	setlinebuf(s->certifiedOutput);
+	Py_INCREF(p_obj);
 #endif
 
-	delete s;
+	s->certifiedUNSAT  = true;
+	s->certifiedPyFile = (void *)p_obj;
+
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_glucose41_acc_stats(PyObject *self, PyObject *args)
+static PyObject *py_glucose41_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -3342,17 +4984,24 @@ static PyObject *py_glucose41_acc_stats(PyObject *self, PyObject *args)
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
 	Glucose41::Solver *s = (Glucose41::Solver *)PyCObject_AsVoidPtr(s_obj);
+
+	if (s->certifiedUNSAT == true)
+		PyFile_DecUseCount((PyFileObject *)(s->certifiedPyFile));
 #else
 	Glucose41::Solver *s = (Glucose41::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+
+	if (s->certifiedUNSAT == true)
+		Py_DECREF((PyObject *)s->certifiedPyFile);
 #endif
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
+	if (s->exchange)
+		delete (SolverCallbacks *)s->exchange;
+
+	call_stats.erase((void *)s);
+	delete s;
+	Py_RETURN_NONE;
 }
+
 #endif  // WITH_GLUCOSE41
 
 // API for Lingeling
@@ -3373,6 +5022,58 @@ static PyObject *py_lingeling_new(PyObject *self, PyObject *args)
 	return void_to_pyobj((void *)s);
 }
 
+// nothing to be done in the SIGINT handler; see lingeling_terminate()
+//=============================================================================
+static void lingeling_sigint(void *s)
+{
+}
+
+// termination callback checked by Lingeling during search
+//=============================================================================
+static int lingeling_terminate(void *state)
+{
+	return ((SigIntState *)state)->caught;
+}
+
+// the conditions a limited call is stopped on
+//=============================================================================
+typedef struct {
+	SigIntState *sig;
+	volatile sig_atomic_t *interrupted;
+} LingelingStop;
+
+// termination callback of a limited call
+//=============================================================================
+static int lingeling_terminate_lim(void *state)
+{
+	LingelingStop *stop = (LingelingStop *)state;
+	return stop->sig->caught || *stop->interrupted;
+}
+
+// termination callback checking the stop flag of a portfolio race
+//=============================================================================
+static int lingeling_race_terminate(void *stop)
+{
+	return *(volatile sig_atomic_t *)stop;
+}
+
+// running the solver in a portfolio thread
+//=============================================================================
+static int lingeling_race(void *ptr, const vector<int>& assumps, int max_var,
+		volatile sig_atomic_t *stop)
+{
+	LGL *s = (LGL *)ptr;
+
+	for (size_t i = 0; i < assumps.size(); ++i)
+		lglassume(s, assumps[i]);
+
+	lglseterm(s, lingeling_race_terminate, (void *)stop);
+	int status = lglsat(s);
+	lglseterm(s, NULL, NULL);
+
+	return status;
+}
+
 //
 //=============================================================================
 static PyObject *py_lingeling_add_cl(PyObject *self, PyObject *args)
@@ -3385,6 +5086,7 @@ static PyObject *py_lingeling_add_cl(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_CL);
 
 	// clause iterator
 	PyObject *i_obj = PyObject_GetIter(c_obj);
@@ -3423,6 +5125,46 @@ static PyObject *py_lingeling_add_cl(PyObject *self, PyObject *args)
 	return ret;
 }
 
+//
+//=============================================================================
+static PyObject *py_lingeling_add_cls_buffer(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *b_obj;
+
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &b_obj))
+		return NULL;
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_BUF);
+
+	Py_buffer view;
+	if (pybuf_get_int32(b_obj, &view) == false)
+		return NULL;
+
+	const int32_t *lits = (const int32_t *)view.buf;
+	Py_ssize_t size = view.len / view.itemsize;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	for (Py_ssize_t i = 0; i < size; ++i) {
+		int l = lits[i];
+
+		lgladd(s, l);
+
+		if (l)
+			lglfreeze(s, abs(l));
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&view);
+
+	PyObject *ret = PyBool_FromLong((long)true);
+	return ret;
+}
+
 //
 //=============================================================================
 static PyObject *py_lingeling_tracepr(PyObject *self, PyObject *args)
@@ -3478,6 +5220,7 @@ static PyObject *py_lingeling_solve(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE);
 
 	// assumptions iterator
 	PyObject *i_obj = PyObject_GetIter(a_obj);
@@ -3510,25 +5253,132 @@ static PyObject *py_lingeling_solve(PyObject *self, PyObject *args)
 
 	Py_DECREF(i_obj);
 
-	PyOS_sighandler_t sig_save;
+	// Lingeling polls the termination callback by itself
+	SigIntState sig_state = { lingeling_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
 	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+		sig_save = sigint_install(&sig_state);
+		lglseterm(s, lingeling_terminate, (void *)&sig_state);
+	}
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+	int status;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	status = lglsat(s);
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread) {
+		sigint_restore(sig_save);
+		lglseterm(s, NULL, NULL);
 	}
 
-	bool res = lglsat(s) == 10 ? true : false;
+	if (sig_state.caught) {
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+	bool res = status == 10 ? true : false;
 
 	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
 }
 
+//
+//=============================================================================
+static PyObject *py_lingeling_solve_lim(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *a_obj;  // assumptions
+	int main_thread;
+	int expect_interrupt;
+
+	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
+				&expect_interrupt))
+		return NULL;
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_SOLVE_LIM);
+
+	vector<int> a;
+	int max_var = -1;
+	if (pyiter_to_vector(a_obj, a, max_var) == false)
+		return NULL;
+
+	for (size_t i = 0; i < a.size(); ++i)
+		lglassume(s, a[i]);
+
+	// the callback stops on SIGINT and on interrupt() alike; expect_interrupt
+	// is accepted for compatibility with the other solvers
+	SigIntState sig_state = { lingeling_sigint, (void *)s, 0 };
+	LingelingStop stop = { &sig_state, &interrupt_flags[(void *)s] };
+
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
+	lglseterm(s, lingeling_terminate_lim, (void *)&stop);
+
+	int status;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	status = lglsat(s);
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	lglseterm(s, NULL, NULL);
+	if (main_thread)
+		sigint_restore(sig_save);
+
+	if (sig_state.caught) {
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	if (status == 10 || status == 20)
+		return PyBool_FromLong((long)(status == 10));
+
+	Py_RETURN_NONE;  // the call was interrupted
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_interrupt(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
+
+	// get pointer to solver
+	void *s = pyobj_to_void(s_obj);
+
+	interrupt_flags[s] = 1;
+
+	Py_RETURN_NONE;
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_clearint(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
+
+	// get pointer to solver
+	void *s = pyobj_to_void(s_obj);
+
+	// the flag may be polled by a running call, and so it is kept
+	unordered_map<void *, volatile sig_atomic_t>::iterator it =
+		interrupt_flags.find(s);
+	if (it != interrupt_flags.end())
+		it->second = 0;
+
+	Py_RETURN_NONE;
+}
+
 //
 //=============================================================================
 static PyObject *py_lingeling_setphases(PyObject *self, PyObject *args)
@@ -3541,6 +5391,7 @@ static PyObject *py_lingeling_setphases(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_PHASES);
 
 	// phases iterator
 	PyObject *i_obj = PyObject_GetIter(p_obj);
@@ -3587,6 +5438,7 @@ static PyObject *py_lingeling_core(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE);
 
 	int size = (int)PyList_Size(a_obj);
 
@@ -3626,6 +5478,7 @@ static PyObject *py_lingeling_model(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL);
 
 	int maxvar = lglmaxvar(s);
 	if (maxvar) {
@@ -3647,25 +5500,43 @@ static PyObject *py_lingeling_model(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_lingeling_nof_vars(PyObject *self, PyObject *args)
+static PyObject *py_lingeling_core_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *a_obj;  // assumptions
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &a_obj))
 		return NULL;
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_CORE_BUF);
 
-	int nof_vars = lglmaxvar(s);
+	int size = (int)PyList_Size(a_obj);
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
+	vector<int32_t> c;
+	for (int i = 0; i < size; ++i) {
+		PyObject *l_obj = PyList_GetItem(a_obj, i);
+		int l = pyint_to_cint(l_obj);
+
+		if (lglfailed(s, l))
+			c.push_back(l);
+	}
+
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL,
+			c.size() * sizeof(int32_t));
+	if (b_obj == NULL)
+		return NULL;
+
+	if (c.size())
+		memcpy(PyBytes_AS_STRING(b_obj), &c[0], c.size() * sizeof(int32_t));
+
+	return pybytes_to_view(b_obj, "i");
 }
 
 //
 //=============================================================================
-static PyObject *py_lingeling_nof_cls(PyObject *self, PyObject *args)
+static PyObject *py_lingeling_model_buffer(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -3674,19 +5545,148 @@ static PyObject *py_lingeling_nof_cls(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MODEL_BUF);
 
-	int nof_cls = lglnclauses(s);
+	int maxvar = lglmaxvar(s);
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	PyObject *b_obj = PyBytes_FromStringAndSize(NULL, maxvar);
+	if (b_obj == NULL)
+		return NULL;
+
+	int8_t *vals = (int8_t *)PyBytes_AS_STRING(b_obj);
+	for (int i = 1; i <= maxvar; ++i)
+		vals[i - 1] = lglderef(s, i) > 0 ? 1 : -1;
+
+	return pybytes_to_view(b_obj, "b");
 }
 
 //
 //=============================================================================
-static PyObject *py_lingeling_del(PyObject *self, PyObject *args)
+static PyObject *py_lingeling_enum_models(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *p_obj;
+	PyObject *a_obj;  // assumptions
+	PyObject *p_obj;  // projection variables
+	int limit;
+	int main_thread;
+
+	if (!PyArg_ParseTuple(args, "OOOii", &s_obj, &a_obj, &p_obj, &limit,
+				&main_thread))
+		return NULL;
+
+	if (limit <= 0) {
+		PyErr_SetString(PyExc_ValueError, "positive limit expected");
+		return NULL;
+	}
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ENUM);
+
+	vector<int> a;
+	int max_var = -1;
+	if (pyiter_to_vector(a_obj, a, max_var) == false)
+		return NULL;
+
+	vector<int> vars;
+	if (pyproj_to_vector(p_obj, vars, max_var, lglmaxvar(s)) == false)
+		return NULL;
+
+	// Lingeling polls the termination callback by itself
+	SigIntState sig_state = { lingeling_sigint, (void *)s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread) {
+		sig_save = sigint_install(&sig_state);
+		lglseterm(s, lingeling_terminate, (void *)&sig_state);
+	}
+
+	vector<int32_t> models;
+	bool done = false;
+
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	for (int n = 0; n < limit && !sig_state.caught; ++n) {
+		// assumptions are dropped after every call
+		for (size_t i = 0; i < a.size(); ++i)
+			lglassume(s, a[i]);
+
+		int status = lglsat(s);
+		if (status != 10) {
+			done = status == 20;
+			break;
+		}
+
+		// values are accessible only until a new clause is started
+		size_t start = models.size();
+		for (size_t i = 0; i < vars.size(); ++i)
+			models.push_back(lglderef(s, vars[i]) > 0 ? vars[i] : -vars[i]);
+
+		for (size_t i = start; i < models.size(); ++i) {
+			lgladd(s, -models[i]);
+			lglfreeze(s, vars[i - start]);
+		}
+
+		models.push_back(0);
+		lgladd(s, 0);
+	}
+	timer.leave();
+	Py_END_ALLOW_THREADS
+
+	if (main_thread) {
+		sigint_restore(sig_save);
+		lglseterm(s, NULL, NULL);
+	}
+
+	if (sig_state.caught) {
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
+
+	return pymodels_to_tuple(models, done);
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_nof_vars(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+
+	int nof_vars = lglmaxvar(s);
+
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_nof_cls(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+
+	int nof_cls = lglnclauses(s);
+
+	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
+	return ret;
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_del(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+	PyObject *p_obj;
 
 	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
@@ -3704,6 +5704,8 @@ static PyObject *py_lingeling_del(PyObject *self, PyObject *args)
 		Py_DECREF(p_obj);
 #endif
 
+	call_stats.erase((void *)s);
+	interrupt_flags.erase((void *)s);
 	lglrelease(s);
 	Py_RETURN_NONE;
 }
@@ -3720,12 +5722,29 @@ static PyObject *py_lingeling_acc_stats(PyObject *self, PyObject *args)
 	// get pointer to solver
 	LGL *s = (LGL *)pyobj_to_void(s_obj);
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
+	PyObject *stats = Py_BuildValue("{s:l,s:l,s:l,s:l}",
 		"restarts", lglgetrests(s),
 		"conflicts", lglgetconfs(s),
 		"decisions", lglgetdecs(s),
 		"propagations", lglgetprops(s)
 	);
+
+	return pystats_add_calls(stats, (void *)s);
+}
+
+//
+//=============================================================================
+static PyObject *py_lingeling_memory(PyObject *self, PyObject *args)
+{
+	PyObject *s_obj;
+
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
+		return NULL;
+
+	// get pointer to solver
+	LGL *s = (LGL *)pyobj_to_void(s_obj);
+
+	return Py_BuildValue("{s:K}", "total", (unsigned long long)lglbytes(s));
 }
 #endif  // WITH_LINGELING
 
@@ -3745,341 +5764,206 @@ static PyObject *py_maplechrono_new(PyObject *self, PyObject *args)
 	return void_to_pyobj((void *)s);
 }
 
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void maplechrono_declare_vars(
-	MapleChrono::Solver *s,
-	const int max_id
-)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
+//
 //=============================================================================
-static inline bool maplechrono_iterate(
-	PyObject *obj,
-	MapleChrono::vec<MapleChrono::Lit>& v,
-	int& max_var
-)
+static PyObject *py_maplechrono_share(PyObject *self, PyObject *args)
 {
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
+	PyObject *s_obj;
+	PyObject *p_obj;
+	int max_lbd;
 
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &p_obj, &max_lbd))
+		return NULL;
 
-		v.push((l > 0) ? MapleChrono::mkLit(l, false) : MapleChrono::mkLit(-l, true));
+	// get pointer to solver
+	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
 
-		if (abs(l) > max_var)
-			max_var = abs(l);
+	if (s->drup_file) {
+		PyErr_SetString(SATError, "Clause sharing is incompatible with proof tracing");
+		return NULL;
 	}
 
-	Py_DECREF(i_obj);
-	return true;
+	MapleChronoApi::callbacks(s)->share(p_obj != Py_None ?
+			(ClauseExchange *)pyobj_to_void(p_obj) : NULL, max_lbd);
+	MapleChronoApi::release(s);
+
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_add_cl(PyObject *self, PyObject *args)
+static PyObject *py_maplechrono_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-	MapleChrono::vec<MapleChrono::Lit> cl;
-	int max_var = -1;
+#if PY_MAJOR_VERSION < 3
+	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCObject_AsVoidPtr(s_obj);
+
+	s->drup_file = PyFile_AsFile(p_obj);
+	PyFile_IncUseCount((PyFileObject *)p_obj);
+#else
+	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (maplechrono_iterate(c_obj, cl, max_var) == false)
+	int fd = PyObject_AsFileDescriptor(p_obj);
+	if (fd == -1) {
+		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
 		return NULL;
+	}
 
-	if (max_var > 0)
-		maplechrono_declare_vars(s, max_var);
+	s->drup_file = fdopen(fd, "w+");
+	if (s->drup_file == 0) {
+		PyErr_SetString(SATError, "Cannot create proof file pointer!");
+		return NULL;
+	}
 
-	bool res = s->addClause(cl);
+	setlinebuf(s->drup_file);
+	Py_INCREF(p_obj);
+#endif
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+	s->drup_pyfile = (void *)p_obj;
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_solve(PyObject *self, PyObject *args)
+static PyObject *py_maplechrono_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-	MapleChrono::vec<MapleChrono::Lit> a;
-	int max_var = -1;
+#if PY_MAJOR_VERSION < 3
+	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	if (maplechrono_iterate(a_obj, a, max_var) == false)
-		return NULL;
+	if (s->drup_file)
+		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
+#else
+	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (max_var > 0)
-		maplechrono_declare_vars(s, max_var);
+	if (s->drup_file)
+		Py_DECREF((PyObject *)s->drup_pyfile);
+#endif
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	if (s->exchange)
+		delete (SolverCallbacks *)s->exchange;
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	call_stats.erase((void *)s);
+	delete s;
+	Py_RETURN_NONE;
+}
 
-	bool res = s->solve(a);
+#endif  // WITH_MAPLECHRONO
 
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+// API for Maplesat
+//=============================================================================
+#ifdef WITH_MAPLESAT
+static PyObject *py_maplesat_new(PyObject *self, PyObject *args)
+{
+	Maplesat::Solver *s = new Maplesat::Solver();
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
+
+	return void_to_pyobj((void *)s);
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_solve_lim(PyObject *self, PyObject *args)
+static PyObject *py_maplesat_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
+	PyObject *p_obj;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
+	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-	MapleChrono::vec<MapleChrono::Lit> a;
-	int max_var = -1;
-
-	if (maplechrono_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplechrono_declare_vars(s, max_var);
-
-	MapleChrono::lbool res = MapleChrono::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
+#if PY_MAJOR_VERSION < 3
+	Maplesat::Solver *s = (Maplesat::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-		res = s->solveLimited(a);
+	s->drup_file = PyFile_AsFile(p_obj);
+	PyFile_IncUseCount((PyFileObject *)p_obj);
+#else
+	Maplesat::Solver *s = (Maplesat::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
+	int fd = PyObject_AsFileDescriptor(p_obj);
+	if (fd == -1) {
+		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
+		return NULL;
 	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
+
+	s->drup_file = fdopen(fd, "w+");
+	if (s->drup_file == 0) {
+		PyErr_SetString(SATError, "Cannot create proof file pointer!");
+		return NULL;
 	}
 
-	if (res != MapleChrono::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(MapleChrono::toInt(res)));
+	setlinebuf(s->drup_file);
+	Py_INCREF(p_obj);
+#endif
 
-	Py_RETURN_NONE;  // return Python's None if l_Undef
+	s->drup_pyfile = (void *)p_obj;
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_propagate(PyObject *self, PyObject *args)
+static PyObject *py_maplesat_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-	MapleChrono::vec<MapleChrono::Lit> a;
-	int max_var = -1;
-
-	if (maplechrono_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplechrono_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	MapleChrono::vec<MapleChrono::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = MapleChrono::var(p[i]) * (MapleChrono::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplechrono_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplechrono_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplechrono_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplechrono_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
+#if PY_MAJOR_VERSION < 3
+	Maplesat::Solver *s = (Maplesat::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
+	if (s->drup_file)
+		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
+#else
+	Maplesat::Solver *s = (Maplesat::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+	if (s->drup_file)
+		Py_DECREF((PyObject *)s->drup_pyfile);
+#endif
 
+	call_stats.erase((void *)s);
+	delete s;
 	Py_RETURN_NONE;
 }
 
-//
-//=============================================================================
-static PyObject *py_maplechrono_interrupt(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
-
-	Py_RETURN_NONE;
-}
+#endif  // WITH_MAPLESAT
 
-//
+// API for MapleCM
 //=============================================================================
-static PyObject *py_maplechrono_clearint(PyObject *self, PyObject *args)
+#ifdef WITH_MAPLECM
+static PyObject *py_maplecm_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	MapleCM::Solver *s = new MapleCM::Solver();
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	s->clearInterrupt();
-
-	Py_RETURN_NONE;
+	return void_to_pyobj((void *)s);
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_tracepr(PyObject *self, PyObject *args)
+static PyObject *py_maplecm_tracepr(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 	PyObject *p_obj;
@@ -4089,12 +5973,12 @@ static PyObject *py_maplechrono_tracepr(PyObject *self, PyObject *args)
 
 	// get pointer to solver
 #if PY_MAJOR_VERSION < 3
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCObject_AsVoidPtr(s_obj);
+	MapleCM::Solver *s = (MapleCM::Solver *)PyCObject_AsVoidPtr(s_obj);
 
 	s->drup_file = PyFile_AsFile(p_obj);
 	PyFile_IncUseCount((PyFileObject *)p_obj);
 #else
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+	MapleCM::Solver *s = (MapleCM::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
 	int fd = PyObject_AsFileDescriptor(p_obj);
 	if (fd == -1) {
@@ -4118,7 +6002,7 @@ static PyObject *py_maplechrono_tracepr(PyObject *self, PyObject *args)
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_core(PyObject *self, PyObject *args)
+static PyObject *py_maplecm_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -4126,64 +6010,44 @@ static PyObject *py_maplechrono_core(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	MapleChrono::vec<MapleChrono::Lit> *c = &(s->conflict);  // minisat's conflict
+#if PY_MAJOR_VERSION < 3
+	MapleCM::Solver *s = (MapleCM::Solver *)PyCObject_AsVoidPtr(s_obj);
 
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = MapleChrono::var((*c)[i]) * (MapleChrono::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
+	if (s->drup_file)
+		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
+#else
+	MapleCM::Solver *s = (MapleCM::Solver *)PyCapsule_GetPointer(s_obj, NULL);
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
+	if (s->drup_file)
+		Py_DECREF((PyObject *)s->drup_pyfile);
+#endif
 
-	Py_DECREF(core);
+	call_stats.erase((void *)s);
+	delete s;
 	Py_RETURN_NONE;
 }
 
-//
+#endif  // WITH_MAPLECM
+
+// API for MergeSat 3
 //=============================================================================
-static PyObject *py_maplechrono_model(PyObject *self, PyObject *args)
+#ifdef WITH_MERGESAT3
+static PyObject *py_mergesat3_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	MergeSat3::Solver *s = new MergeSat3::Solver();
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
-
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	MapleChrono::vec<MapleChrono::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		MapleChrono::lbool True = MapleChrono::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
 	}
 
-	Py_RETURN_NONE;
+	return void_to_pyobj((void *)s);
 }
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_nof_vars(PyObject *self, PyObject *args)
+static PyObject *py_mergesat3_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -4191,2477 +6055,117 @@ static PyObject *py_maplechrono_nof_vars(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
+	call_stats.erase((void *)s);
+	delete s;
+	Py_RETURN_NONE;
 }
 
-//
+#endif  // WITH_MERGESAT3
+
+// API for Minicard
 //=============================================================================
-static PyObject *py_maplechrono_nof_cls(PyObject *self, PyObject *args)
+#ifdef WITH_MINICARD
+static PyObject *py_minicard_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	Minicard::Solver *s = new Minicard::Solver();
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
 		return NULL;
+	}
 
-	// get pointer to solver
-	MapleChrono::Solver *s = (MapleChrono::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	return void_to_pyobj((void *)s);
 }
 
-//
+// cloning hooks: AtMostK constraints are stored as clauses
 //=============================================================================
-static PyObject *py_maplechrono_del(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+extern "C++" {
+template <>
+struct MinisatHooks<Minicard::Solver> {
+	static bool add(Minicard::Solver *to,
+			Minicard::vec<Minicard::Lit>& lits, Minicard::Clause& c)
+	{
+		if (!c.is_atmost())
+			return to->addClause(lits);
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	if (s->drup_file)
-		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
-#else
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCapsule_GetPointer(s_obj, NULL);
+		// an AtMostK constraint over n literals has n - k + 1 watches
+		return to->addAtMost(lits, c.size() - c.atmost_watches() + 1);
+	}
 
-	if (s->drup_file)
-		Py_DECREF((PyObject *)s->drup_pyfile);
-#endif
+	template <class C>
+	static void learnt(C& to, C& from)
+	{
+		to.activity() = from.activity();
+	}
 
-	delete s;
-	Py_RETURN_NONE;
-}
+	static void config(Minicard::Solver *from, Minicard::Solver *to) {}
+};
+}  // extern "C++"
 
 //
 //=============================================================================
-static PyObject *py_maplechrono_acc_stats(PyObject *self, PyObject *args)
+static PyObject *py_minicard_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	MapleChrono::Solver *s = (MapleChrono::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_MAPLECHRONO
-
-// API for Maplesat
-//=============================================================================
-#ifdef WITH_MAPLESAT
-static PyObject *py_maplesat_new(PyObject *self, PyObject *args)
-{
-	Maplesat::Solver *s = new Maplesat::Solver();
-
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
-	}
-
-	return void_to_pyobj((void *)s);
-}
-
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void maplesat_declare_vars(
-	Maplesat::Solver *s,
-	const int max_id
-)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool maplesat_iterate(
-	PyObject *obj,
-	Maplesat::vec<Maplesat::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? Maplesat::mkLit(l, false) : Maplesat::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
-
-	Py_DECREF(i_obj);
-	return true;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_add_cl(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-	Maplesat::vec<Maplesat::Lit> cl;
-	int max_var = -1;
-
-	if (maplesat_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplesat_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-	Maplesat::vec<Maplesat::Lit> a;
-	int max_var = -1;
-
-	if (maplesat_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplesat_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_solve_lim(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-	Maplesat::vec<Maplesat::Lit> a;
-	int max_var = -1;
-
-	if (maplesat_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplesat_declare_vars(s, max_var);
-
-	Maplesat::lbool res = Maplesat::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
-
-	if (res != Maplesat::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Maplesat::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_propagate(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-	Maplesat::vec<Maplesat::Lit> a;
-	int max_var = -1;
-
-	if (maplesat_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplesat_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	Maplesat::vec<Maplesat::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Maplesat::var(p[i]) * (Maplesat::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplesat_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_interrupt(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_clearint(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	s->clearInterrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_tracepr(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	s->drup_file = PyFile_AsFile(p_obj);
-	PyFile_IncUseCount((PyFileObject *)p_obj);
-#else
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	int fd = PyObject_AsFileDescriptor(p_obj);
-	if (fd == -1) {
-		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
-		return NULL;
-	}
-
-	s->drup_file = fdopen(fd, "w+");
-	if (s->drup_file == 0) {
-		PyErr_SetString(SATError, "Cannot create proof file pointer!");
-		return NULL;
-	}
-
-	setlinebuf(s->drup_file);
-	Py_INCREF(p_obj);
-#endif
-
-	s->drup_pyfile = (void *)p_obj;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	Maplesat::vec<Maplesat::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Maplesat::var((*c)[i]) * (Maplesat::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
-
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
-
-	Py_DECREF(core);
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_model(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	Maplesat::vec<Maplesat::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		Maplesat::lbool True = Maplesat::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Maplesat::Solver *s = (Maplesat::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_del(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	if (s->drup_file)
-		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
-#else
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	if (s->drup_file)
-		Py_DECREF((PyObject *)s->drup_pyfile);
-#endif
-
-	delete s;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplesat_acc_stats(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	Maplesat::Solver *s = (Maplesat::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_MAPLESAT
-
-// API for MapleCM
-//=============================================================================
-#ifdef WITH_MAPLECM
-static PyObject *py_maplecm_new(PyObject *self, PyObject *args)
-{
-	MapleCM::Solver *s = new MapleCM::Solver();
-
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
-	}
-
-	return void_to_pyobj((void *)s);
-}
-
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void maplecm_declare_vars(
-	MapleCM::Solver *s,
-	const int max_id
-)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool maplecm_iterate(
-	PyObject *obj,
-	MapleCM::vec<MapleCM::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? MapleCM::mkLit(l, false) : MapleCM::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
-
-	Py_DECREF(i_obj);
-	return true;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_add_cl(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-	MapleCM::vec<MapleCM::Lit> cl;
-	int max_var = -1;
-
-	if (maplecm_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplecm_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-	MapleCM::vec<MapleCM::Lit> a;
-	int max_var = -1;
-
-	if (maplecm_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplecm_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_solve_lim(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-	MapleCM::vec<MapleCM::Lit> a;
-	int max_var = -1;
-
-	if (maplecm_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplecm_declare_vars(s, max_var);
-
-	MapleCM::lbool res = MapleCM::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
-
-	if (res != MapleCM::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(MapleCM::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_propagate(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-	MapleCM::vec<MapleCM::Lit> a;
-	int max_var = -1;
-
-	if (maplecm_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplecm_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	MapleCM::vec<MapleCM::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = MapleCM::var(p[i]) * (MapleCM::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		maplecm_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_interrupt(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_clearint(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	s->clearInterrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_tracepr(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	s->drup_file = PyFile_AsFile(p_obj);
-	PyFile_IncUseCount((PyFileObject *)p_obj);
-#else
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	int fd = PyObject_AsFileDescriptor(p_obj);
-	if (fd == -1) {
-		PyErr_SetString(SATError, "Cannot create proof file descriptor!");
-		return NULL;
-	}
-
-	s->drup_file = fdopen(fd, "w+");
-	if (s->drup_file == 0) {
-		PyErr_SetString(SATError, "Cannot create proof file pointer!");
-		return NULL;
-	}
-
-	setlinebuf(s->drup_file);
-	Py_INCREF(p_obj);
-#endif
-
-	s->drup_pyfile = (void *)p_obj;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	MapleCM::vec<MapleCM::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = MapleCM::var((*c)[i]) * (MapleCM::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
-
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
-
-	Py_DECREF(core);
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_model(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	MapleCM::vec<MapleCM::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		MapleCM::lbool True = MapleCM::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MapleCM::Solver *s = (MapleCM::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_del(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCObject_AsVoidPtr(s_obj);
-
-	if (s->drup_file)
-		PyFile_DecUseCount((PyFileObject *)(s->drup_pyfile));
-#else
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-
-	if (s->drup_file)
-		Py_DECREF((PyObject *)s->drup_pyfile);
-#endif
-
-	delete s;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_maplecm_acc_stats(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	MapleCM::Solver *s = (MapleCM::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_MAPLECM
-
-// API for MergeSat 3
-//=============================================================================
-#ifdef WITH_MERGESAT3
-static PyObject *py_mergesat3_new(PyObject *self, PyObject *args)
-{
-	MergeSat3::Solver *s = new MergeSat3::Solver();
-
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
-	}
-
-	return void_to_pyobj((void *)s);
-}
-
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void mergesat3_declare_vars(MergeSat3::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool mergesat3_iterate(
-	PyObject *obj,
-	MergeSat3::vec<MergeSat3::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? MergeSat3::mkLit(l, false) : MergeSat3::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
-
-	Py_DECREF(i_obj);
-	return true;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_add_cl(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-	MergeSat3::vec<MergeSat3::Lit> cl;
-	int max_var = -1;
-
-	if (mergesat3_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		mergesat3_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-	MergeSat3::vec<MergeSat3::Lit> a;
-	int max_var = -1;
-
-	if (mergesat3_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		mergesat3_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_solve_lim(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-	MergeSat3::vec<MergeSat3::Lit> a;
-	int max_var = -1;
-
-	if (mergesat3_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		mergesat3_declare_vars(s, max_var);
-
-	MergeSat3::lbool res = MergeSat3::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
-
-	if (res != MergeSat3::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(MergeSat3::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_propagate(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-	MergeSat3::vec<MergeSat3::Lit> a;
-	int max_var = -1;
-
-	if (mergesat3_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		mergesat3_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	MergeSat3::vec<MergeSat3::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = MergeSat3::var(p[i]) * (MergeSat3::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		mergesat3_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_interrupt(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_clearint(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	s->clearInterrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	MergeSat3::vec<MergeSat3::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = MergeSat3::var((*c)[i]) * (MergeSat3::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
-
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
-
-	Py_DECREF(core);
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_model(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	MergeSat3::vec<MergeSat3::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		MergeSat3::lbool True = MergeSat3::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_del(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	MergeSat3::Solver *s = (MergeSat3::Solver *)pyobj_to_void(s_obj);
-
-	delete s;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_mergesat3_acc_stats(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MergeSat3::Solver *s = (MergeSat3::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	MergeSat3::Solver *s = (MergeSat3::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_MERGESAT3
-
-// API for Minicard
-//=============================================================================
-#ifdef WITH_MINICARD
-static PyObject *py_minicard_new(PyObject *self, PyObject *args)
-{
-	Minicard::Solver *s = new Minicard::Solver();
-
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
-	}
-
-	return void_to_pyobj((void *)s);
-}
-
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void minicard_declare_vars(Minicard::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool minicard_iterate(
-	PyObject *obj,
-	Minicard::vec<Minicard::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? Minicard::mkLit(l, false) : Minicard::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
-
-	Py_DECREF(i_obj);
-	return true;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_add_cl(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	Minicard::vec<Minicard::Lit> cl;
-	int max_var = -1;
-
-	if (minicard_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_add_am(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-	int64_t rhs;
-
-	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	Minicard::vec<Minicard::Lit> cl;
-	int max_var = -1;
-
-	if (minicard_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	bool res = s->addAtMost(cl, rhs);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	Minicard::vec<Minicard::Lit> a;
-	int max_var = -1;
-
-	if (minicard_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_solve_lim(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	Minicard::vec<Minicard::Lit> a;
-	int max_var = -1;
-
-	if (minicard_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	Minicard::lbool res = Minicard::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
-
-	if (res != Minicard::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Minicard::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_propagate(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	Minicard::vec<Minicard::Lit> a;
-	int max_var = -1;
-
-	if (minicard_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	Minicard::vec<Minicard::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Minicard::var(p[i]) * (Minicard::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minicard_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_interrupt(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_clearint(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	s->clearInterrupt();
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	Minicard::vec<Minicard::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Minicard::var((*c)[i]) * (Minicard::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
-	}
-
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
-	}
-
-	Py_DECREF(core);
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_model(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	Minicard::vec<Minicard::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		Minicard::lbool True = Minicard::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
-
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
-
-	int nof_cls = s->nClauses();
-
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_del(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
 	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
+	Minicard::Solver *c = new Minicard::Solver();
 
-	delete s;
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minicard_acc_stats(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Minicard::Solver *s = (Minicard::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	Minicard::Solver *s = (Minicard::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
-#endif  // WITH_MINICARD
-
-// API for MiniSat 2.2
-//=============================================================================
-#ifdef WITH_MINISAT22
-static PyObject *py_minisat22_new(PyObject *self, PyObject *args)
-{
-	Minisat22::Solver *s = new Minisat22::Solver();
-
-	if (s == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Cannot create a new solver.");
-		return NULL;
-	}
-
-	return void_to_pyobj((void *)s);
-}
-
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void minisat22_declare_vars(Minisat22::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
-//=============================================================================
-static inline bool minisat22_iterate(
-	PyObject *obj,
-	Minisat22::vec<Minisat22::Lit>& v,
-	int& max_var
-)
-{
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
-
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
-
-		v.push((l > 0) ? Minisat22::mkLit(l, false) : Minisat22::mkLit(-l, true));
-
-		if (abs(l) > max_var)
-			max_var = abs(l);
-	}
-
-	Py_DECREF(i_obj);
-	return true;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_add_cl(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *c_obj;
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-	Minisat22::vec<Minisat22::Lit> cl;
-	int max_var = -1;
-
-	if (minisat22_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisat22_declare_vars(s, max_var);
-
-	bool res = s->addClause(cl);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-	Minisat22::vec<Minisat22::Lit> a;
-	int max_var = -1;
-
-	if (minisat22_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisat22_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_solve_lim(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-	Minisat22::vec<Minisat22::Lit> a;
-	int max_var = -1;
-
-	if (minisat22_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisat22_declare_vars(s, max_var);
-
-	Minisat22::lbool res = Minisat22::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
-			}
-		}
-
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
-	}
-
-	if (res != Minisat22::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(Minisat22::toInt(res)));
-
-	Py_RETURN_NONE;  // return Python's None if l_Undef
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_propagate(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int save_phases;
-	int main_thread;
-
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-	Minisat22::vec<Minisat22::Lit> a;
-	int max_var = -1;
-
-	if (minisat22_iterate(a_obj, a, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisat22_declare_vars(s, max_var);
-
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
-
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
-
-	Minisat22::vec<Minisat22::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = Minisat22::var(p[i]) * (Minisat22::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
-	}
-
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
-
-	return ret;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_setphases(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
-
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
-
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisat22_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), p[i] < 0);
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisat22_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
-		return NULL;
-
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Minicard::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
 
-	Py_RETURN_NONE;
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_pbudget(PyObject *self, PyObject *args)
+static PyObject *py_minicard_add_am(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	int64_t budget;
+	PyObject *c_obj;
+	int64_t rhs;
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	if (!PyArg_ParseTuple(args, "OOl", &s_obj, &c_obj, &rhs))
 		return NULL;
 
 	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_ADD_AM);
+	Minicard::vec<Minicard::Lit> cl;
+	int max_var = -1;
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+	if (MinicardApi::iterate(c_obj, cl, max_var) == false)
+		return NULL;
 
-	Py_RETURN_NONE;
+	if (max_var > 0)
+		MinicardApi::declare_vars(s, max_var);
+
+	timer.enter();
+	bool res = s->addAtMost(cl, rhs);
+	timer.leave();
+
+	PyObject *ret = PyBool_FromLong((long)res);
+	return ret;
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_interrupt(PyObject *self, PyObject *args)
+static PyObject *py_minicard_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
 
@@ -6669,128 +6173,174 @@ static PyObject *py_minisat22_interrupt(PyObject *self, PyObject *args)
 		return NULL;
 
 	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
-
-	s->interrupt();
+	Minicard::Solver *s = (Minicard::Solver *)pyobj_to_void(s_obj);
 
+	call_stats.erase((void *)s);
+	delete s;
 	Py_RETURN_NONE;
 }
 
-//
+#endif  // WITH_MINICARD
+
+// API for MiniSat 2.2
 //=============================================================================
-static PyObject *py_minisat22_clearint(PyObject *self, PyObject *args)
+#ifdef WITH_MINISAT22
+static PyObject *py_minisat22_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	int simp;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "i", &simp))
 		return NULL;
 
-	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	// a simplifying solver is used through the interface of the core one
+	Minisat22::Solver *s = simp ? new Minisat22::SimpSolver() :
+		new Minisat22::Solver();
 
-	s->clearInterrupt();
+	if (s == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
+	}
 
-	Py_RETURN_NONE;
+	return void_to_pyobj((void *)s);
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_core(PyObject *self, PyObject *args)
+static PyObject *py_minisat22_clone(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int warm;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
 		return NULL;
 
 	// get pointer to solver
 	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
 
-	Minisat22::vec<Minisat22::Lit> *c = &(s->conflict);  // minisat's conflict
-
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = Minisat22::var((*c)[i]) * (Minisat22::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
+	// the elimination state is not part of a clone
+	if (dynamic_cast<Minisat22::SimpSolver *>(s)) {
+		PyErr_SetString(SATError, "Cloning is incompatible with variable elimination");
+		return NULL;
 	}
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
+	Minisat22::Solver *c = new Minisat22::Solver();
+
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
 	}
 
-	Py_DECREF(core);
-	Py_RETURN_NONE;
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<Minisat22::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
+
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_model(PyObject *self, PyObject *args)
+static PyObject *py_minisat22_share(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *p_obj;
+	int max_lbd;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &p_obj, &max_lbd))
 		return NULL;
 
 	// get pointer to solver
 	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
 
-	// minisat's model
-	Minisat22::vec<Minisat22::lbool> *m = &(s->model);
+	// imported clauses may mention eliminated variables
+	if (dynamic_cast<Minisat22::SimpSolver *>(s)) {
+		PyErr_SetString(SATError, "Clause sharing is incompatible with variable elimination");
+		return NULL;
+	}
 
-	if (m->size()) {
-		// l_True fails to work
-		Minisat22::lbool True = Minisat22::lbool((uint8_t)0);
+	Minisat22Api::callbacks(s)->share(p_obj != Py_None ?
+			(ClauseExchange *)pyobj_to_void(p_obj) : NULL, max_lbd);
+	Minisat22Api::release(s);
 
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
+	Py_RETURN_NONE;
+}
 
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
-	}
+// auxiliary function for getting a simplifying solver
+//=============================================================================
+static Minisat22::SimpSolver *minisat22_simp(PyObject *s_obj)
+{
+	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	Minisat22::SimpSolver *ss = dynamic_cast<Minisat22::SimpSolver *>(s);
 
-	Py_RETURN_NONE;
+	if (ss == NULL)
+		PyErr_SetString(SATError, "Variable elimination is not enabled");
+
+	return ss;
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_nof_vars(PyObject *self, PyObject *args)
+static PyObject *py_minisat22_freeze(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	PyObject *v_obj;
+	int frozen;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &v_obj, &frozen))
 		return NULL;
 
 	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	Minisat22::SimpSolver *s = minisat22_simp(s_obj);
+	if (s == NULL)
+		return NULL;
 
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	Minisat22::vec<Minisat22::Lit> v;
+	int max_var = -1;
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
+	if (Minisat22Api::iterate(v_obj, v, max_var) == false)
+		return NULL;
+
+	if (max_var > 0)
+		Minisat22Api::declare_vars(s, max_var);
+
+	// an eliminated variable cannot be brought back
+	for (int i = 0; i < v.size(); ++i) {
+		if (s->isEliminated(Minisat22::var(v[i]))) {
+			PyErr_Format(SATError, "Variable %d has been eliminated",
+					Minisat22::var(v[i]));
+			return NULL;
+		}
+	}
+
+	for (int i = 0; i < v.size(); ++i)
+		s->setFrozen(Minisat22::var(v[i]), frozen);
+
+	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_minisat22_nof_cls(PyObject *self, PyObject *args)
+static PyObject *py_minisat22_eliminate(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int turn_off;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &turn_off))
 		return NULL;
 
 	// get pointer to solver
-	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
+	Minisat22::SimpSolver *s = minisat22_simp(s_obj);
+	if (s == NULL)
+		return NULL;
 
-	int nof_cls = s->nClauses();
+	bool res;
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
+	Py_BEGIN_ALLOW_THREADS
+	res = s->eliminate(turn_off);
+	Py_END_ALLOW_THREADS
+
+	PyObject *ret = PyBool_FromLong((long)res);
 	return ret;
 }
 
@@ -6806,33 +6356,14 @@ static PyObject *py_minisat22_del(PyObject *self, PyObject *args)
 	// get pointer to solver
 	Minisat22::Solver *s = (Minisat22::Solver *)pyobj_to_void(s_obj);
 
+	if (s->exchange)
+		delete (SolverCallbacks *)s->exchange;
+
+	call_stats.erase((void *)s);
 	delete s;
 	Py_RETURN_NONE;
 }
 
-//
-//=============================================================================
-static PyObject *py_minisat22_acc_stats(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
-
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	Minisat22::Solver *s = (Minisat22::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	Minisat22::Solver *s = (Minisat22::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
-
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
-}
 #endif  // WITH_MINISAT22
 
 // API for MiniSat from github
@@ -6851,475 +6382,546 @@ static PyObject *py_minisatgh_new(PyObject *self, PyObject *args)
 	return void_to_pyobj((void *)s);
 }
 
-// auxiliary function for declaring new variables
-//=============================================================================
-static inline void minisatgh_declare_vars(MinisatGH::Solver *s, const int max_id)
-{
-	while (s->nVars() < max_id + 1)
-		s->newVar();
-}
-
-// translating an iterable to vec<Lit>
+//
 //=============================================================================
-static inline bool minisatgh_iterate(
-	PyObject *obj,
-	MinisatGH::vec<MinisatGH::Lit>& v,
-	int& max_var
-)
+static PyObject *py_minisatgh_clone(PyObject *self, PyObject *args)
 {
-	// iterator object
-	PyObject *i_obj = PyObject_GetIter(obj);
-	if (i_obj == NULL) {
-		PyErr_SetString(PyExc_RuntimeError,
-				"Object does not seem to be an iterable.");
-		return false;
-	}
-
-	PyObject *l_obj;
-	while ((l_obj = PyIter_Next(i_obj)) != NULL) {
-		if (!pyint_check(l_obj)) {
-			Py_DECREF(l_obj);
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_TypeError, "integer expected");
-			return false;
-		}
-
-		int l = pyint_to_cint(l_obj);
-		Py_DECREF(l_obj);
+	PyObject *s_obj;
+	int warm;
 
-		if (l == 0) {
-			Py_DECREF(i_obj);
-			PyErr_SetString(PyExc_ValueError, "non-zero integer expected");
-			return false;
-		}
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &warm))
+		return NULL;
 
-		v.push((l > 0) ? MinisatGH::mkLit(l, false) : MinisatGH::mkLit(-l, true));
+	// get pointer to solver
+	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	MinisatGH::Solver *c = new MinisatGH::Solver();
 
-		if (abs(l) > max_var)
-			max_var = abs(l);
+	if (c == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Cannot create a new solver.");
+		return NULL;
 	}
 
-	Py_DECREF(i_obj);
-	return true;
+	Py_BEGIN_ALLOW_THREADS
+	MinisatClone<MinisatGH::Solver>::clone(s, c, warm);
+	Py_END_ALLOW_THREADS
+
+	return void_to_pyobj((void *)c);
 }
 
 //
 //=============================================================================
-static PyObject *py_minisatgh_add_cl(PyObject *self, PyObject *args)
+static PyObject *py_minisatgh_del(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
-	PyObject *c_obj;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &c_obj))
+	if (!PyArg_ParseTuple(args, "O", &s_obj))
 		return NULL;
 
 	// get pointer to solver
 	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-	MinisatGH::vec<MinisatGH::Lit> cl;
-	int max_var = -1;
 
-	if (minisatgh_iterate(c_obj, cl, max_var) == false)
-		return NULL;
-
-	if (max_var > 0)
-		minisatgh_declare_vars(s, max_var);
+	call_stats.erase((void *)s);
+	delete s;
+	Py_RETURN_NONE;
+}
 
-	bool res = s->addClause(cl);
+#endif  // WITH_MINISATGH
 
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
-}
+// API for Portfolio
+//=============================================================================
+static RaceBackend race_backends[] = {
+#ifdef WITH_CADICAL
+	{ "cadical",     cadical_race,          NULL,                    NULL                      },
+#endif
+#ifdef WITH_GLUECARD30
+	{ "gluecard3",   Gluecard30Api::race,   Gluecard30Api::sigint,   Gluecard30Api::clearint   },
+#endif
+#ifdef WITH_GLUECARD41
+	{ "gluecard41",  Gluecard41Api::race,   Gluecard41Api::sigint,   Gluecard41Api::clearint   },
+#endif
+#ifdef WITH_GLUCOSE30
+	{ "glucose3",    Glucose30Api::race,    Glucose30Api::sigint,    Glucose30Api::clearint    },
+#endif
+#ifdef WITH_GLUCOSE41
+	{ "glucose41",   Glucose41Api::race,    Glucose41Api::sigint,    Glucose41Api::clearint    },
+#endif
+#ifdef WITH_LINGELING
+	{ "lingeling",   lingeling_race,        NULL,                    NULL                      },
+#endif
+#ifdef WITH_MAPLECHRONO
+	{ "maplechrono", MapleChronoApi::race,  MapleChronoApi::sigint,  MapleChronoApi::clearint  },
+#endif
+#ifdef WITH_MAPLECM
+	{ "maplecm",     MapleCMApi::race,      MapleCMApi::sigint,      MapleCMApi::clearint      },
+#endif
+#ifdef WITH_MAPLESAT
+	{ "maplesat",    MaplesatApi::race,     MaplesatApi::sigint,     MaplesatApi::clearint     },
+#endif
+#ifdef WITH_MERGESAT3
+	{ "mergesat3",   MergeSat3Api::race,    MergeSat3Api::sigint,    MergeSat3Api::clearint    },
+#endif
+#ifdef WITH_MINICARD
+	{ "minicard",    MinicardApi::race,     MinicardApi::sigint,     MinicardApi::clearint     },
+#endif
+#ifdef WITH_MINISAT22
+	{ "minisat22",   Minisat22Api::race,    Minisat22Api::sigint,    Minisat22Api::clearint    },
+#endif
+#ifdef WITH_MINISATGH
+	{ "minisatgh",   MinisatGHApi::race,    MinisatGHApi::sigint,    MinisatGHApi::clearint    },
+#endif
+	{ NULL, NULL, NULL, NULL }
+};
 
-//
+// API for RC2
 //=============================================================================
-static PyObject *py_minisatgh_solve(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
+static RC2Oracle rc2_backends[] = {
+#ifdef WITH_CADICAL
+	{ "cadical", cadical_rc2_add, cadical_rc2_solve, cadical_rc2_core,
+		cadical_rc2_model, cadical_sigint, cadical_clearint },
+#endif
+#ifdef WITH_GLUCOSE30
+	{ "glucose3", Glucose30Api::rc2_add, Glucose30Api::rc2_solve, Glucose30Api::rc2_core,
+		Glucose30Api::rc2_model, Glucose30Api::sigint, Glucose30Api::clearint },
+#endif
+#ifdef WITH_GLUCOSE41
+	{ "glucose41", Glucose41Api::rc2_add, Glucose41Api::rc2_solve, Glucose41Api::rc2_core,
+		Glucose41Api::rc2_model, Glucose41Api::sigint, Glucose41Api::clearint },
+#endif
+#ifdef WITH_MAPLECHRONO
+	{ "maplechrono", MapleChronoApi::rc2_add, MapleChronoApi::rc2_solve, MapleChronoApi::rc2_core,
+		MapleChronoApi::rc2_model, MapleChronoApi::sigint, MapleChronoApi::clearint },
+#endif
+#ifdef WITH_MAPLECM
+	{ "maplecm", MapleCMApi::rc2_add, MapleCMApi::rc2_solve, MapleCMApi::rc2_core,
+		MapleCMApi::rc2_model, MapleCMApi::sigint, MapleCMApi::clearint },
+#endif
+#ifdef WITH_MAPLESAT
+	{ "maplesat", MaplesatApi::rc2_add, MaplesatApi::rc2_solve, MaplesatApi::rc2_core,
+		MaplesatApi::rc2_model, MaplesatApi::sigint, MaplesatApi::clearint },
+#endif
+#ifdef WITH_MERGESAT3
+	{ "mergesat3", MergeSat3Api::rc2_add, MergeSat3Api::rc2_solve, MergeSat3Api::rc2_core,
+		MergeSat3Api::rc2_model, MergeSat3Api::sigint, MergeSat3Api::clearint },
+#endif
+#ifdef WITH_MINISAT22
+	{ "minisat22", Minisat22Api::rc2_add, Minisat22Api::rc2_solve, Minisat22Api::rc2_core,
+		Minisat22Api::rc2_model, Minisat22Api::sigint, Minisat22Api::clearint },
+#endif
+#ifdef WITH_MINISATGH
+	{ "minisatgh", MinisatGHApi::rc2_add, MinisatGHApi::rc2_solve, MinisatGHApi::rc2_core,
+		MinisatGHApi::rc2_model, MinisatGHApi::sigint, MinisatGHApi::clearint },
+#endif
+	{ NULL, NULL, NULL, NULL, NULL, NULL, NULL }
+};
 
-	if (!PyArg_ParseTuple(args, "OOi", &s_obj, &a_obj, &main_thread))
-		return NULL;
+// state shared by the threads of a portfolio race
+//=============================================================================
+struct PortfolioRace {
+	vector<RaceBackend *> backends;
+	vector<void *> solvers;
+	volatile sig_atomic_t stop;
+	atomic<int> winner;
+	int status;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-	MinisatGH::vec<MinisatGH::Lit> a;
-	int max_var = -1;
+	PortfolioRace() : stop(0), winner(-1), status(0) {}
+};
 
-	if (minisatgh_iterate(a_obj, a, max_var) == false)
-		return NULL;
+// stopping all the solvers; also called from the SIGINT handler
+//=============================================================================
+static void portfolio_stop(void *ptr)
+{
+	PortfolioRace *race = (PortfolioRace *)ptr;
 
-	if (max_var > 0)
-		minisatgh_declare_vars(s, max_var);
+	race->stop = 1;
+	for (size_t i = 0; i < race->solvers.size(); ++i)
+		if (race->backends[i]->interrupt)
+			race->backends[i]->interrupt(race->solvers[i]);
+}
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+// a thread running one of the solvers; the first one to answer wins
+//=============================================================================
+static void portfolio_run(PortfolioRace *race, size_t id,
+		const vector<int> *assumps, int max_var)
+{
+	int status = race->backends[id]->solve(race->solvers[id], *assumps,
+			max_var, &race->stop);
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
+	int none = -1;
+	if (status != 0 && race->winner.compare_exchange_strong(none, (int)id)) {
+		race->status = status;
+		portfolio_stop(race);
 	}
-
-	bool res = s->solve(a);
-
-	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
-
-	PyObject *ret = PyBool_FromLong((long)res);
-	return ret;
 }
 
-//
+// translating a list of (backend name, solver object) pairs
 //=============================================================================
-static PyObject *py_minisatgh_solve_lim(PyObject *self, PyObject *args)
+static bool portfolio_members(PyObject *obj, PortfolioRace& race)
 {
-	PyObject *s_obj;
-	PyObject *a_obj;  // assumptions
-	int main_thread;
-	int expect_interrupt;
+	PyObject *i_obj = PyObject_GetIter(obj);
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &main_thread,
-				&expect_interrupt))
-		return NULL;
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return false;
+	}
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-	MinisatGH::vec<MinisatGH::Lit> a;
-	int max_var = -1;
+	PyObject *m_obj;
+	while ((m_obj = PyIter_Next(i_obj)) != NULL) {
+		const char *name;
+		PyObject *s_obj;
 
-	if (minisatgh_iterate(a_obj, a, max_var) == false)
-		return NULL;
+		if (!PyArg_ParseTuple(m_obj, "sO", &name, &s_obj)) {
+			Py_DECREF(m_obj);
+			Py_DECREF(i_obj);
+			return false;
+		}
 
-	if (max_var > 0)
-		minisatgh_declare_vars(s, max_var);
+		RaceBackend *backend = race_backends;
+		while (backend->name && strcmp(backend->name, name) != 0)
+			++backend;
 
-	MinisatGH::lbool res = MinisatGH::lbool((uint8_t)2);  // l_Undef
-	if (expect_interrupt == 0) {
-		PyOS_sighandler_t sig_save;
-		if (main_thread) {
-			sig_save = PyOS_setsig(SIGINT, sigint_handler);
+		if (backend->name == NULL) {
+			PyErr_Format(PyExc_ValueError, "unknown portfolio solver '%s'",
+					name);
+			Py_DECREF(m_obj);
+			Py_DECREF(i_obj);
+			return false;
+		}
+
+		void *s = pyobj_to_void(s_obj);
+		Py_DECREF(m_obj);
 
-			if (setjmp(env) != 0) {
-				PyErr_SetString(SATError, "Caught keyboard interrupt");
-				return NULL;
+		for (size_t i = 0; i < race.solvers.size(); ++i) {
+			if (race.solvers[i] == s) {
+				Py_DECREF(i_obj);
+				PyErr_SetString(PyExc_ValueError,
+						"solver object used twice in a portfolio");
+				return false;
 			}
 		}
 
-		res = s->solveLimited(a);
-
-		if (main_thread)
-			PyOS_setsig(SIGINT, sig_save);
-	}
-	else {
-		Py_BEGIN_ALLOW_THREADS
-		res = s->solveLimited(a);
-		Py_END_ALLOW_THREADS
+		race.backends.push_back(backend);
+		race.solvers.push_back(s);
 	}
 
-	if (res != MinisatGH::lbool((uint8_t)2))  // l_Undef
-		return PyBool_FromLong((long)!(MinisatGH::toInt(res)));
+	Py_DECREF(i_obj);
+
+	if (race.solvers.empty()) {
+		PyErr_SetString(PyExc_ValueError, "empty portfolio");
+		return false;
+	}
 
-	Py_RETURN_NONE;  // return Python's None if l_Undef
+	return true;
 }
 
 //
 //=============================================================================
-static PyObject *py_minisatgh_propagate(PyObject *self, PyObject *args)
+static PyObject *py_portfolio_solve(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	PyObject *m_obj;  // members
 	PyObject *a_obj;  // assumptions
-	int save_phases;
 	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "OOii", &s_obj, &a_obj, &save_phases,
-				&main_thread))
+	if (!PyArg_ParseTuple(args, "OOi", &m_obj, &a_obj, &main_thread))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-	MinisatGH::vec<MinisatGH::Lit> a;
-	int max_var = -1;
+	PortfolioRace race;
+	if (portfolio_members(m_obj, race) == false)
+		return NULL;
 
-	if (minisatgh_iterate(a_obj, a, max_var) == false)
+	vector<int> assumps;
+	int max_var = -1;
+	if (pyiter_to_vector(a_obj, assumps, max_var) == false)
 		return NULL;
 
-	if (max_var > 0)
-		minisatgh_declare_vars(s, max_var);
+	SigIntState sig_state = { portfolio_stop, (void *)&race, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-	PyOS_sighandler_t sig_save;
-	if (main_thread) {
-		sig_save = PyOS_setsig(SIGINT, sigint_handler);
+	Py_BEGIN_ALLOW_THREADS
+	vector<thread> threads;
+	for (size_t i = 0; i < race.solvers.size(); ++i)
+		threads.push_back(thread(portfolio_run, &race, i, &assumps, max_var));
 
-		if (setjmp(env) != 0) {
-			PyErr_SetString(SATError, "Caught keyboard interrupt");
-			return NULL;
-		}
-	}
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
 
-	MinisatGH::vec<MinisatGH::Lit> p;
-	bool res = s->prop_check(a, p, save_phases);
+	// the losers must be able to solve again
+	for (size_t i = 0; i < race.solvers.size(); ++i)
+		if (race.backends[i]->clear)
+			race.backends[i]->clear(race.solvers[i]);
+	Py_END_ALLOW_THREADS
 
 	if (main_thread)
-		PyOS_setsig(SIGINT, sig_save);
+		sigint_restore(sig_save);
 
-	PyObject *propagated = PyList_New(p.size());
-	for (int i = 0; i < p.size(); ++i) {
-		int l = MinisatGH::var(p[i]) * (MinisatGH::sign(p[i]) ? -1 : 1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(propagated, i, lit);
+	if (sig_state.caught) {
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
 	}
 
-	PyObject *ret = Py_BuildValue("nO", (Py_ssize_t)res, propagated);
-	Py_DECREF(propagated);
+	int winner = race.winner.load();
+	if (winner < 0)
+		Py_RETURN_NONE;  // no solver could give an answer
 
-	return ret;
+	return Py_BuildValue("(iO)", winner,
+			race.status == 10 ? Py_True : Py_False);
 }
 
+
 //
 //=============================================================================
-static PyObject *py_minisatgh_setphases(PyObject *self, PyObject *args)
+static PyObject *py_rc2_new(PyObject *self, PyObject *args)
 {
+	const char *name;
 	PyObject *s_obj;
-	PyObject *p_obj;  // polarities given as a list of integer literals
+	PyObject *l_obj;  // selectors
+	PyObject *w_obj;  // their weights
+	int top;
+	int exhaust;
+	int minz;
+	int trim;
 
-	if (!PyArg_ParseTuple(args, "OO", &s_obj, &p_obj))
+	if (!PyArg_ParseTuple(args, "sOOOiiii", &name, &s_obj, &l_obj, &w_obj,
+				&top, &exhaust, &minz, &trim))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-	vector<int> p;
-	int max_var = -1;
+	RC2Oracle *backend = rc2_backends;
+	while (backend->name && strcmp(backend->name, name) != 0)
+		++backend;
 
-	if (pyiter_to_vector(p_obj, p, max_var) == false)
+	if (backend->name == NULL) {
+		PyErr_Format(PyExc_NotImplementedError,
+				"RC2 engine is not available for '%s'", name);
 		return NULL;
+	}
 
-	if (max_var > 0)
-		minisatgh_declare_vars(s, max_var);
-
-	for (size_t i = 0; i < p.size(); ++i)
-		s->setPolarity(abs(p[i]), MinisatGH::lbool(p[i] < 0));
-
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisatgh_cbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
-
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	vector<int> sels;
+	int max_var = -1;
+	if (pyiter_to_vector(l_obj, sels, max_var) == false)
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	PyObject *i_obj = PyObject_GetIter(w_obj);
+	if (i_obj == NULL) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"Object does not seem to be an iterable.");
+		return NULL;
+	}
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setConfBudget(budget);
-	else
-		s->budgetOff();
+	vector<int64_t> wghts;
+	PyObject *e_obj;
+	while ((e_obj = PyIter_Next(i_obj)) != NULL) {
+		wghts.push_back(PyLong_AsLongLong(e_obj));
+		Py_DECREF(e_obj);
 
-	Py_RETURN_NONE;
-}
+		if (PyErr_Occurred())
+			break;
+	}
 
-//
-//=============================================================================
-static PyObject *py_minisatgh_pbudget(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-	int64_t budget;
+	Py_DECREF(i_obj);
+	if (PyErr_Occurred())
+		return NULL;
 
-	if (!PyArg_ParseTuple(args, "Ol", &s_obj, &budget))
+	if (wghts.size() != sels.size()) {
+		PyErr_SetString(PyExc_ValueError,
+				"numbers of selectors and weights differ");
 		return NULL;
+	}
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	RC2Engine *engine = new RC2Engine(backend, pyobj_to_void(s_obj),
+			std::max(top, max_var), exhaust, minz, trim);
 
-	if (budget != 0 && budget != -1)  // it is 0 by default
-		s->setPropBudget(budget);
-	else
-		s->budgetOff();
+	for (size_t i = 0; i < sels.size(); ++i)
+		engine->add_soft(sels[i], wghts[i]);
 
-	Py_RETURN_NONE;
+	return engine_to_pyobj(engine);
 }
 
 //
 //=============================================================================
-static PyObject *py_minisatgh_interrupt(PyObject *self, PyObject *args)
+static PyObject *py_rc2_add(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	PyObject *e_obj;
+	int sel;
+	long long weight;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "OiL", &e_obj, &sel, &weight))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	RC2Engine *engine = (RC2Engine *)pyobj_to_void(e_obj);
 
-	s->interrupt();
+	engine->add_soft(sel, weight);
+	engine->topv = std::max(engine->topv, abs(sel));
 
 	Py_RETURN_NONE;
 }
 
 //
 //=============================================================================
-static PyObject *py_minisatgh_clearint(PyObject *self, PyObject *args)
+static PyObject *py_rc2_compute(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	PyObject *e_obj;
+	int top;  // variables may have been introduced by the caller
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oii", &e_obj, &top, &main_thread))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	RC2Engine *engine = (RC2Engine *)pyobj_to_void(e_obj);
+	engine->topv = std::max(engine->topv, top);
+	RC2Oracle *backend = engine->backend();
 
-	s->clearInterrupt();
+	SigIntState sig_state = { backend->interrupt, engine->solver(), 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-	Py_RETURN_NONE;
-}
+	int res;
+	vector<int> model;
 
-//
-//=============================================================================
-static PyObject *py_minisatgh_core(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+	Py_BEGIN_ALLOW_THREADS
+	res = engine->compute(&sig_state.caught);
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	if (res == 1)
+		engine->get_model(model);
+	Py_END_ALLOW_THREADS
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	if (main_thread)
+		sigint_restore(sig_save);
 
-	MinisatGH::LSet *c = &(s->conflict);  // minisat's conflict
+	if (sig_state.caught) {
+		if (backend->clear)
+			backend->clear(engine->solver());
 
-	PyObject *core = PyList_New(c->size());
-	for (int i = 0; i < c->size(); ++i) {
-		int l = MinisatGH::var((*c)[i]) * (MinisatGH::sign((*c)[i]) ? 1 : -1);
-		PyObject *lit = pyint_from_cint(l);
-		PyList_SetItem(core, i, lit);
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
 	}
 
-	if (c->size()) {
-		PyObject *ret = Py_BuildValue("O", core);
-		Py_DECREF(core);
-		return ret;
+	if (res < 0) {
+		PyErr_SetString(SATError, "RC2 engine was interrupted previously");
+		return NULL;
 	}
 
-	Py_DECREF(core);
-	Py_RETURN_NONE;
+	PyObject *m_obj;
+	if (res == 1)
+		m_obj = pylist_from_vector(model);
+	else {
+		m_obj = Py_None;
+		Py_INCREF(m_obj);
+	}
+
+	if (m_obj == NULL)
+		return NULL;
+
+	return Py_BuildValue("(NLi)", m_obj, (long long)engine->cost,
+			engine->topv);
 }
 
-//
+// core trimming and minimization of the RC2 engine applied to any core of
+// a solver; only the reduced core is returned to Python
 //=============================================================================
-static PyObject *py_minisatgh_model(PyObject *self, PyObject *args)
+static PyObject *py_minimize_core(PyObject *self, PyObject *args)
 {
+	const char *name;
 	PyObject *s_obj;
+	PyObject *c_obj;  // core
+	int64_t budget;
+	int trim;
+	int minz;
+	int main_thread;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "sOOLiii", &name, &s_obj, &c_obj, &budget,
+				&trim, &minz, &main_thread))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-
-	// minisat's model
-	MinisatGH::vec<MinisatGH::lbool> *m = &(s->model);
-
-	if (m->size()) {
-		// l_True fails to work
-		MinisatGH::lbool True = MinisatGH::lbool((uint8_t)0);
-
-		PyObject *model = PyList_New(m->size() - 1);
-		for (int i = 1; i < m->size(); ++i) {
-			int l = i * ((*m)[i] == True ? 1 : -1);
-			PyObject *lit = pyint_from_cint(l);
-			PyList_SetItem(model, i - 1, lit);
-		}
+	RC2Oracle *backend = rc2_backends;
+	while (backend->name && strcmp(backend->name, name) != 0)
+		++backend;
 
-		PyObject *ret = Py_BuildValue("O", model);
-		Py_DECREF(model);
-		return ret;
+	if (backend->name == NULL) {
+		PyErr_Format(PyExc_NotImplementedError,
+				"Core minimization is not available for '%s'", name);
+		return NULL;
 	}
 
-	Py_RETURN_NONE;
-}
-
-//
-//=============================================================================
-static PyObject *py_minisatgh_nof_vars(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
-
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	vector<int> core;
+	int max_var = -1;
+	if (pyiter_to_vector(c_obj, core, max_var) == false)
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
-
-	int nof_vars = s->nVars() - 1;  // 0 is a dummy variable
+	void *s = pyobj_to_void(s_obj);
+	CallTimer timer(s, TC_MINZ);
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_vars);
-	return ret;
-}
+	SigIntState sig_state = { backend->interrupt, s, 0 };
+	PyOS_sighandler_t sig_save = NULL;
+	if (main_thread)
+		sig_save = sigint_install(&sig_state);
 
-//
-//=============================================================================
-static PyObject *py_minisatgh_nof_cls(PyObject *self, PyObject *args)
-{
-	PyObject *s_obj;
+	Py_BEGIN_ALLOW_THREADS
+	timer.enter();
+	// a negative number of rounds trims the core until a fixed point
+	if (rc2_trim_core(backend, s, core, trim < 0 ? UINT_MAX : (unsigned)trim)
+			&& minz && core.size() > 1)
+		rc2_minimize_core(backend, s, core, budget, &sig_state.caught);
+	timer.leave();
+	Py_END_ALLOW_THREADS
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
-		return NULL;
+	if (main_thread)
+		sigint_restore(sig_save);
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	if (sig_state.caught) {
+		if (backend->clear)
+			backend->clear(s);
 
-	int nof_cls = s->nClauses();
+		PyErr_SetString(SATError, "Caught keyboard interrupt");
+		return NULL;
+	}
 
-	PyObject *ret = Py_BuildValue("n", (Py_ssize_t)nof_cls);
-	return ret;
+	return pylist_from_vector(core);
 }
 
-//
+// timing is enabled per solver; the counters are kept until the solver is
+// deleted or timing is disabled
 //=============================================================================
-static PyObject *py_minisatgh_del(PyObject *self, PyObject *args)
+static PyObject *py_time_calls(PyObject *self, PyObject *args)
 {
 	PyObject *s_obj;
+	int on;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "Oi", &s_obj, &on))
 		return NULL;
 
-	// get pointer to solver
-	MinisatGH::Solver *s = (MinisatGH::Solver *)pyobj_to_void(s_obj);
+	void *s = pyobj_to_void(s_obj);
+
+	if (on)
+		call_stats.insert(make_pair(s, CallStats()));
+	else
+		call_stats.erase(s);
 
-	delete s;
 	Py_RETURN_NONE;
 }
 
-//
+
+// a pool holds up to 'capacity' clauses of at most 'max_size' literals each;
+// the oldest clauses are overwritten by the new ones
 //=============================================================================
-static PyObject *py_minisatgh_acc_stats(PyObject *self, PyObject *args)
+static PyObject *py_exchange_new(PyObject *self, PyObject *args)
 {
-	PyObject *s_obj;
+	int capacity;
+	int max_size;
 
-	if (!PyArg_ParseTuple(args, "O", &s_obj))
+	if (!PyArg_ParseTuple(args, "ii", &capacity, &max_size))
 		return NULL;
 
-	// get pointer to solver
-#if PY_MAJOR_VERSION < 3
-	MinisatGH::Solver *s = (MinisatGH::Solver *)PyCObject_AsVoidPtr(s_obj);
-#else
-	MinisatGH::Solver *s = (MinisatGH::Solver *)PyCapsule_GetPointer(s_obj, NULL);
-#endif
+	if (capacity <= 0 || max_size <= 0) {
+		PyErr_SetString(PyExc_ValueError,
+				"capacity and clause size must be positive");
+		return NULL;
+	}
 
-	return Py_BuildValue("{s:l,s:l,s:l,s:l}",
-		"restarts", s->starts,
-		"conflicts", s->conflicts,
-		"decisions", s->decisions,
-		"propagations", s->propagations
-	);
+	return exchange_to_pyobj(new ClauseExchange(capacity, max_size));
 }
-#endif  // WITH_MINISATGH
 
 }  // extern "C"
@@ -0,0 +1,492 @@
+/*
+ * rc2.hh
+ *
+ *  Created on: Oct 14, 2026
+ */
+
+#ifndef RC2_HH_
+#define RC2_HH_
+
+#include <algorithm>
+#include <csignal>
+#include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "itot.hh"
+
+using namespace std;
+
+// a SAT oracle the engine works with; solve() returns 10 (SAT), 20 (UNSAT),
+// or 0 if the conflict budget (unless it is non-positive) is exceeded or
+// the call is interrupted
+//=============================================================================
+typedef struct {
+	const char *name;  // the prefix of the backend's functions
+	void (*add_clause)(void *, const vector<int>&);
+	int  (*solve)(void *, const vector<int>&, int64_t);
+	void (*core)(void *, const vector<int>&, vector<int>&);
+	void (*model)(void *, vector<int>&);
+	void (*interrupt)(void *);
+	void (*clear)(void *);  // NULL if there is nothing to clear
+} RC2Oracle;
+
+// trimming an unsatisfiable core of assumptions, i.e. replacing it with the
+// core of a call made under it, at most a given number of times or until it
+// stops shrinking; false is returned if a call is interrupted
+//=============================================================================
+static bool rc2_trim_core(RC2Oracle *oracle, void *s, vector<int>& core,
+		unsigned rounds)
+{
+	vector<int> new_core;
+
+	for (unsigned i = 0; i < rounds; ++i) {
+		int res = oracle->solve(s, core, 0);
+		if (res == 0)
+			return false;
+
+		// the assumptions turn out not to be a core
+		if (res == 10)
+			break;
+
+		new_core.clear();
+		oracle->core(s, core, new_core);
+
+		// CaDiCaL reports no failed literals if the core has
+		// complementary assumptions; the core is kept then
+		if (new_core.empty() || new_core.size() == core.size())
+			break;
+
+		core.swap(new_core);
+	}
+
+	return true;
+}
+
+// deletion-based minimization of an unsatisfiable core of assumptions,
+// which are tried one by one in their order; the assumptions whose check
+// exceeds the conflict budget are kept, and false is returned if a check
+// is interrupted
+//=============================================================================
+static bool rc2_minimize_core(RC2Oracle *oracle, void *s, vector<int>& core,
+		int64_t budget, volatile sig_atomic_t *stop)
+{
+	vector<int> to_test;
+	size_t i = 0;
+	while (i < core.size()) {
+		to_test.assign(core.begin(), core.begin() + i);
+		to_test.insert(to_test.end(), core.begin() + i + 1, core.end());
+
+		if (oracle->solve(s, to_test, budget) == 20)
+			core.swap(to_test);
+		else if (*stop)
+			return false;
+		else
+			++i;
+	}
+
+	return true;
+}
+
+// a totalizer sum over relaxation literals, encoded up to ubound
+//=============================================================================
+typedef struct {
+	TotTree *tree;
+	unsigned nof_lits;
+	unsigned ubound;
+} RC2Sum;
+
+// the core-guided loop of pysat.examples.rc2.RC2, step by step, i.e. with
+// the same order of oracle calls and the same totalizer clauses; all the
+// state of the algorithm lives here across calls to compute()
+//=============================================================================
+class RC2Engine {
+public:
+	RC2Engine(RC2Oracle *backend, void *solver, int top, bool exhaust,
+			bool minz, unsigned trim)
+	: cost(0), topv(top), oracle(backend), s(solver), stop(NULL),
+	broken(false), exhaust(exhaust), minz(minz), trim(trim), minw(0)
+	{
+	}
+
+	~RC2Engine()
+	{
+		for (size_t i = 0; i < sums.size(); ++i)
+			itot_destroy(sums[i].tree);
+	}
+
+	// a new soft clause, or more weight for an existing one
+	void add_soft(int sel, int64_t weight)
+	{
+		if (wght.count(sel) == 0) {
+			sels.push_back(sel);
+			wght[sel] = weight;
+		}
+		else
+			wght[sel] += weight;
+
+		sels_set.insert(sel);
+	}
+
+	// 1 if an optimal model is found, 0 if the hard clauses are
+	// unsatisfiable, and -1 if the oracle was interrupted (after which
+	// the state is inconsistent and the engine cannot be used anymore)
+	int compute(volatile sig_atomic_t *flag)
+	{
+		if (broken)
+			return -1;
+
+		stop = flag;
+
+		for (;;) {
+			assumps = sels;
+			assumps.insert(assumps.end(), bounds.begin(), bounds.end());
+
+			int res = oracle->solve(s, assumps, 0);
+			if (res == 10)
+				return 1;
+			if (res != 20)
+				return fail();
+
+			get_core();
+			if (broken)
+				return -1;
+
+			if (core.empty())
+				return 0;
+
+			process_core();
+			if (broken)
+				return -1;
+		}
+	}
+
+	void get_model(vector<int>& model)
+	{
+		oracle->model(s, model);
+	}
+
+	RC2Oracle *backend()
+	{
+		return oracle;
+	}
+
+	void *solver()
+	{
+		return s;
+	}
+
+	int64_t cost;
+	int topv;
+private:
+	int fail()
+	{
+		broken = true;
+		return -1;
+	}
+
+	int rhs(size_t t, unsigned i)
+	{
+		return itot_outputs(sums[t].tree, sums[t].tree->root)[i];
+	}
+
+	unsigned nof_rhs(size_t t)
+	{
+		return sums[t].tree->nodes[sums[t].tree->root].nof_vars;
+	}
+
+	void add_clauses(ClauseSet& dest)
+	{
+		vector<int> cl;
+
+		for (size_t i = 0; i < dest.size(); ++i) {
+			cl.assign(dest[i].begin(), dest[i].end());
+			oracle->add_clause(s, cl);
+		}
+	}
+
+	void add_unit(int l)
+	{
+		vector<int> cl(1, l);
+		oracle->add_clause(s, cl);
+	}
+
+	void get_core()
+	{
+		core.clear();
+		oracle->core(s, assumps, core);
+
+		if (core.empty())
+			return;
+
+		trim_core();
+		if (broken)
+			return;
+
+		minimize_core();
+		if (broken || core.empty())
+			return;
+
+		minw = wght[core[0]];
+		for (size_t i = 1; i < core.size(); ++i)
+			minw = std::min(minw, wght[core[i]]);
+
+		core_sels.clear();
+		core_sums.clear();
+		for (size_t i = 0; i < core.size(); ++i) {
+			if (sels_set.count(core[i]))
+				core_sels.push_back(core[i]);
+			else
+				core_sums.push_back(core[i]);
+		}
+	}
+
+	void trim_core()
+	{
+		if (!rc2_trim_core(oracle, s, core, trim))
+			fail();
+	}
+
+	// all the calls are dropped after 1000 conflicts
+	void minimize_core()
+	{
+		if (!minz || core.size() <= 1)
+			return;
+
+		std::stable_sort(core.begin(), core.end(), WeightLess(wght));
+
+		if (!rc2_minimize_core(oracle, s, core, 1000, stop))
+			fail();
+	}
+
+	void process_core()
+	{
+		cost += minw;
+		garbage.clear();
+
+		if (core_sels.size() != 1 || !core_sums.empty()) {
+			process_sels();
+			process_sums();
+
+			if (rels.size() > 1) {
+				size_t t = create_sum();
+				unsigned b = exhaust ? exhaust_core(t) : 1;
+
+				if (broken)
+					return;
+
+				if (b)
+					set_bound(t, b);
+				else {
+					// none of these clauses can be satisfied
+					for (size_t i = 0; i < rels.size(); ++i)
+						add_unit(rels[i]);
+				}
+			}
+		}
+		else {
+			// the negation of a unit core becomes hard
+			add_unit(-core_sels[0]);
+			garbage.insert(core_sels[0]);
+		}
+
+		filter_assumps();
+	}
+
+	void process_sels()
+	{
+		rels.clear();
+
+		for (size_t i = 0; i < core_sels.size(); ++i) {
+			int l = core_sels[i];
+
+			if (wght[l] == minw) {
+				garbage.insert(l);
+				rels.push_back(-l);
+			}
+			else {
+				// splitting the clause
+				wght[l] -= minw;
+
+				vector<int> cl(1, l);
+				cl.push_back(++topv);
+				oracle->add_clause(s, cl);
+
+				rels.push_back(topv);
+			}
+		}
+	}
+
+	void process_sums()
+	{
+		for (size_t i = 0; i < core_sums.size(); ++i) {
+			int l = core_sums[i];
+
+			if (wght[l] == minw)
+				garbage.insert(l);
+			else
+				wght[l] -= minw;
+
+			// increasing the bound of the sum
+			size_t t = tobj[l];
+			unsigned b = update_sum(l);
+
+			if (b < nof_rhs(t)) {
+				int lnew = -rhs(t, b);
+
+				if (garbage.count(lnew)) {
+					garbage.erase(lnew);
+					wght[lnew] = 0;
+				}
+
+				if (wght.count(lnew) == 0)
+					set_bound(t, b);
+				else
+					wght[lnew] += minw;
+			}
+
+			rels.push_back(-l);
+		}
+	}
+
+	size_t create_sum()
+	{
+		ClauseSet dest;
+
+		RC2Sum sum;
+		sum.tree     = itot_new(dest, rels, 1, topv);
+		sum.nof_lits = rels.size();
+		sum.ubound   = 1;
+		sums.push_back(sum);
+
+		add_clauses(dest);
+		return sums.size() - 1;
+	}
+
+	unsigned update_sum(int assump)
+	{
+		size_t t = tobj[assump];
+		unsigned b = bnds[assump] + 1;
+
+		RC2Sum& sum = sums[t];
+		if (b > sum.ubound && sum.ubound < sum.nof_lits) {
+			ClauseSet dest;
+
+			sum.ubound = b;
+			itot_increase(sum.tree, dest, b, topv);
+
+			add_clauses(dest);
+		}
+
+		return b;
+	}
+
+	// 0 means the core cannot be satisfied with any bound
+	unsigned exhaust_core(size_t t)
+	{
+		vector<int> a(1, -rhs(t, 1));
+
+		int res = oracle->solve(s, a, 0);
+		if (res == 0) {
+			fail();
+			return 0;
+		}
+		if (res == 10)
+			return 1;
+
+		cost += minw;
+
+		for (unsigned i = 2; i < rels.size(); ++i) {
+			int l = -rhs(t, i - 1);
+
+			tobj[l] = t;
+			bnds[l] = i - 1;
+			update_sum(l);
+
+			a[0] = -rhs(t, i);
+
+			res = oracle->solve(s, a, 0);
+			if (res == 0) {
+				fail();
+				return 0;
+			}
+			if (res == 10)
+				return i;
+
+			cost += minw;
+		}
+
+		return 0;
+	}
+
+	void set_bound(size_t t, unsigned b)
+	{
+		int l = -rhs(t, b);
+
+		tobj[l] = t;
+		bnds[l] = b;
+		wght[l] = minw;
+
+		bounds.push_back(l);
+	}
+
+	void filter_assumps()
+	{
+		size_t k = 0;
+		for (size_t i = 0; i < sels.size(); ++i)
+			if (!garbage.count(sels[i]))
+				sels[k++] = sels[i];
+		sels.resize(k);
+
+		k = 0;
+		for (size_t i = 0; i < bounds.size(); ++i)
+			if (!garbage.count(bounds[i]))
+				bounds[k++] = bounds[i];
+		bounds.resize(k);
+
+		for (unordered_set<int>::iterator it = garbage.begin();
+				it != garbage.end(); ++it) {
+			bnds.erase(*it);
+			wght.erase(*it);
+			sels_set.erase(*it);
+		}
+
+		garbage.clear();
+	}
+
+	struct WeightLess {
+		WeightLess(unordered_map<int, int64_t>& w) : wght(w) {}
+
+		bool operator()(int l1, int l2) const
+		{
+			return wght[l1] < wght[l2];
+		}
+
+		unordered_map<int, int64_t>& wght;
+	};
+
+	RC2Oracle *oracle;
+	void *s;
+	volatile sig_atomic_t *stop;
+	bool broken;
+
+	bool exhaust;
+	bool minz;
+	unsigned trim;
+
+	vector<int> sels;                     // clause selectors
+	vector<int> bounds;                   // sum assumptions
+	unordered_set<int> sels_set;
+	unordered_map<int, int64_t> wght;     // weights of both
+	unordered_map<int, unsigned> bnds;    // sum assumptions to bounds
+	unordered_map<int, size_t> tobj;      // sum assumptions to sums
+	vector<RC2Sum> sums;
+
+	vector<int> assumps;
+	vector<int> core, core_sels, core_sums;
+	vector<int> rels;
+	unordered_set<int> garbage;
+	int64_t minw;
+};
+
+#endif // RC2_HH_
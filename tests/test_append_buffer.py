@@ -0,0 +1,45 @@
+from array import array
+from pysat.solvers import Solver
+from pysat.formula import CNF
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    cnf = CNF(from_clauses=[[1, 2, 3], [-1, 2], [-2]])
+    buf = array('i', [l for cl in cnf.clauses for l in cl + [0]])
+
+    for name in solvers:
+        with Solver(name=name) as solver:
+            solver.append_buffer(buf)
+            assert solver.nof_clauses() <= 3, 'wrong number of clauses by {0}'.format(name)
+            assert solver.solve(), 'wrong outcome by {0}'.format(name)
+            assert solver.get_model() == [-1, -2, 3], 'wrong model by {0}'.format(name)
+
+            solver.append_buffer(memoryview(array('i', [-3, 0])))
+            assert not solver.solve(), 'wrong outcome by {0}'.format(name)
+
+def test_malformed():
+    with Solver(name='m22') as solver:
+        try:
+            solver.append_buffer(array('i', [1, 2]))
+            assert False, 'non-terminated buffer accepted'
+        except ValueError:
+            pass
+
+        try:
+            solver.append_buffer(array('d', [1.0, 0.0]))
+            assert False, 'buffer of doubles accepted'
+        except TypeError:
+            pass
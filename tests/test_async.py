@@ -0,0 +1,83 @@
+from pysat.examples.genhard import PHP
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'mergesat3',
+           'minicard',
+           'minisat22',
+           'minisat-gh']
+
+def test_cancel():
+    cnf = PHP(nof_holes=12)
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=cnf) as s:
+            call = s.solve_async()
+            call.wait(timeout=0.1)
+            call.cancel()
+
+            assert call.wait(timeout=10), 'not cancelled by {0}'.format(name)
+            assert call.result() in (None, False)
+
+            # the solver can be used again (pigeons 1 and 2 in hole 1)
+            assert s.solve_limited(assumptions=[1, 13]) == False
+            assert s.solve_async(assumptions=[1, 13]).result() == False
+
+def test_result():
+    clauses = [[-1, 2], [-2, 3], [-3, 4], [1, 5, -6]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            call = s.solve_async(assumptions=[1])
+            assert call.result(timeout=10) == True, 'wrong result by {0}'.format(name)
+            assert call.done() and call.poll() == True
+            assert call.cancel() == False
+            assert 4 in s.get_model()
+
+            seen = []
+            call = s.solve_async(assumptions=[1, -4])
+            call.add_done_callback(seen.append)
+            assert call.result() == False and seen == [call]
+            assert s.solve() == True
+
+def test_asyncio():
+    try:
+        import asyncio
+    except ImportError:
+        return
+
+    names = ['cadical', 'lingeling', 'glucose41']
+    easy = [Solver(name=name, bootstrap_with=[[1, 2], [-1, 2]]) for name in names]
+    hard = [Solver(name=name, bootstrap_with=PHP(nof_holes=12)) for name in names]
+
+    async def gather(calls, timeout):
+        try:
+            return await asyncio.wait_for(asyncio.gather(*calls), timeout)
+        except asyncio.TimeoutError:
+            return None
+
+    def race(team, timeout):
+        calls = [s.solve_async() for s in team]
+        res = loop.run_until_complete(gather(calls, timeout))
+
+        # the calls are cancelled on timeout
+        assert all(call.wait(timeout=10) for call in calls)
+        return res
+
+    loop = asyncio.new_event_loop()
+    try:
+        assert race(easy, 10) == [True] * len(names)
+        assert race(hard, 0.1) in (None, [False] * len(names))
+    finally:
+        loop.close()
+
+    for s in easy + hard:
+        s.delete()
@@ -0,0 +1,50 @@
+import random
+from pysat.card import *
+from pysat.formula import IDPool
+from pysat.solvers import Solver
+
+encs = [EncType.seqcounter, EncType.sortnetwrk, EncType.cardnetwrk,
+        EncType.totalizer, EncType.mtotalizer, EncType.kmtotalizer]
+
+def random_constraints(seed):
+    rng = random.Random(seed)
+
+    constraints = []
+    for i in range(200):
+        lits = rng.sample(range(1, 60), rng.randint(2, 12))
+        lits = [l if rng.random() < 0.5 else -l for l in lits]
+        constraints.append((lits, rng.randint(1, len(lits))))
+
+    return constraints
+
+def test_atmost_many():
+    constraints = random_constraints(1)
+
+    for enc in encs:
+        # encoding the constraints one by one
+        top, clauses = 59, []
+        for lits, bound in constraints:
+            cnf = CardEnc.atmost(lits=lits, bound=bound, top_id=top, encoding=enc)
+            top = max(top, cnf.nv)
+            clauses.extend(cnf.clauses)
+
+        for threads in (1, 2, 0):
+            cnf = CardEnc.atmost_many(constraints, encoding=enc, threads=threads)
+            assert cnf.clauses == clauses, (enc, threads)
+            assert cnf.nv == top
+
+def test_atmost_many_solver():
+    # the constraints are over disjoint sets of variables here
+    constraints = [(list(range(10 * i + 1, 10 * i + 11)), i % 9 + 1) for i in range(50)]
+    vpool = IDPool(start_from=501)
+
+    with Solver(name='m22') as s:
+        cnf = CardEnc.atmost_many(constraints, vpool=vpool, solver=s,
+                encoding=EncType.totalizer)
+
+        assert not cnf.clauses and vpool.top == cnf.nv
+        assert s.nof_clauses() > 0
+
+        for lits, bound in constraints:
+            assert s.solve(assumptions=lits[:bound]) == True
+            assert s.solve(assumptions=lits[:bound + 1]) == False
@@ -0,0 +1,81 @@
+from pysat.examples.genhard import PHP
+from pysat.formula import ClauseBuffer
+from pysat.solvers import Solver
+
+solvers = ['glucose30', 'glucose41', 'maplechrono', 'minisat22']
+
+def test_learnts():
+    for name in solvers:
+        batches = []
+
+        with Solver(name=name, bootstrap_with=PHP(nof_holes=6)) as s:
+            s.export_learnts(batches.append, max_size=6, batch=50)
+            assert s.solve() == False
+
+            assert batches, name
+            assert all(isinstance(b, ClauseBuffer) for b in batches)
+            assert all(len(b) <= 50 for b in batches)
+
+            learnts = [cl for b in batches for cl in b]
+            assert learnts and all(0 < len(cl) <= 6 for cl in learnts), name
+            assert all(abs(l) <= s.nof_vars() for cl in learnts for l in cl)
+
+            # learnt clauses are implied by the formula
+            with Solver(name='minisat22', bootstrap_with=PHP(nof_holes=6)) as c:
+                for cl in learnts[:20]:
+                    assert c.solve(assumptions=[-l for l in cl]) == False, name
+
+def test_progress():
+    for name in solvers:
+        reports = []
+
+        with Solver(name=name, bootstrap_with=PHP(nof_holes=7)) as s:
+            s.report_progress(reports.append, every=100)
+            assert s.solve() == False
+
+            assert len(reports) > 1, name
+            assert all(sorted(r) == sorted(s.accum_stats()) for r in reports)
+
+            conflicts = [r['conflicts'] for r in reports]
+            assert conflicts == sorted(conflicts)
+            assert conflicts[-1] <= s.accum_stats()['conflicts']
+
+            # no more reports
+            s.report_progress(None)
+            del reports[:]
+            s.add_clause([1, 2])
+            s.solve()
+            assert reports == []
+
+class Stop(Exception):
+    pass
+
+def test_stop():
+    def stop(stats):
+        if stats['conflicts'] >= 200:
+            raise Stop()
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=PHP(nof_holes=8)) as s:
+            s.report_progress(stop, every=10)
+            try:
+                s.solve()
+                assert False, 'not stopped'
+            except Stop:
+                pass
+
+            # the solver can be used again
+            s.report_progress(None)
+            s.conf_budget(100)
+            assert s.solve_limited() is None
+            assert s.solve(assumptions=[1, -1]) == False
+
+def test_unsupported():
+    for name in ['cadical', 'lingeling', 'minicard']:
+        with Solver(name=name, bootstrap_with=[[1, 2]]) as s:
+            for call in (s.export_learnts, s.report_progress):
+                try:
+                    call(print)
+                    assert False, 'callback set by {0}'.format(name)
+                except NotImplementedError:
+                    pass
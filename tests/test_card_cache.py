@@ -0,0 +1,54 @@
+import random
+from pysat.card import *
+
+encs = [EncType.pairwise, EncType.seqcounter, EncType.sortnetwrk,
+        EncType.cardnetwrk, EncType.bitwise, EncType.ladder,
+        EncType.totalizer, EncType.mtotalizer, EncType.kmtotalizer]
+
+def random_constraints(seed):
+    rng = random.Random(seed)
+
+    # few shapes, so that most of the constraints hit the cache
+    constraints = []
+    for i in range(100):
+        lits = rng.sample(range(1, 40), rng.choice([3, 5, 8]))
+        lits = [l if rng.random() < 0.5 else -l for l in lits]
+        constraints.append((lits, rng.choice([1, 2])))
+
+    return constraints
+
+def encode_all(constraints, enc):
+    top, res = 39, []
+    for lits, bound in constraints:
+        for method in (CardEnc.atmost, CardEnc.atleast, CardEnc.equals):
+            cnf = method(lits=lits, bound=bound, top_id=top, encoding=enc)
+            top = max(top, cnf.nv)
+            res.append(cnf.clauses)
+
+    return res, top
+
+def test_cache():
+    constraints = random_constraints(1)
+
+    try:
+        for enc in encs:
+            CardEnc.set_cache(0)
+            plain = encode_all(constraints, enc)
+
+            # the cache is empty at first and warm afterwards
+            CardEnc.set_cache()
+            assert encode_all(constraints, enc) == plain, enc
+            assert encode_all(constraints, enc) == plain, enc
+
+            cnf1 = CardEnc.atmost_many(constraints, top_id=39, encoding=enc)
+            CardEnc.set_cache(0)
+            cnf2 = CardEnc.atmost_many(constraints, top_id=39, encoding=enc)
+            assert cnf1.clauses == cnf2.clauses and cnf1.nv == cnf2.nv, enc
+
+        # a cache too small for any template
+        CardEnc.set_cache(0)
+        plain = encode_all(constraints, EncType.totalizer)
+        CardEnc.set_cache(1)
+        assert encode_all(constraints, EncType.totalizer) == plain
+    finally:
+        CardEnc.set_cache(0)
@@ -0,0 +1,63 @@
+from pysat.card import CardEnc, EncType, ITotalizer
+from pysat.formula import IDPool
+from pysat.solvers import Solver
+
+encs = ['seqcounter', 'sortnetwrk', 'cardnetwrk', 'totalizer', 'mtotalizer',
+        'kmtotalizer']
+
+def count(solver, n):
+    num = 0
+    while solver.solve():
+        num += 1
+        solver.add_clause([-l for l in solver.get_model()[:n]])
+
+    return num
+
+def test_cardenc():
+    lits = list(range(1, 8))
+
+    for e in encs:
+        cnf = CardEnc.equals(lits=lits, bound=3, encoding=getattr(EncType, e))
+
+        with Solver(name='m22', bootstrap_with=cnf) as s1, Solver(name='m22') as s2:
+            res = CardEnc.equals(lits=lits, bound=3,
+                    encoding=getattr(EncType, e), solver=s2)
+
+            assert res.clauses == [] and res.nv == cnf.nv, 'wrong result for {0}'.format(e)
+            assert count(s1, len(lits)) == count(s2, len(lits)) == 35, 'wrong number of models for {0}'.format(e)
+
+def test_vpool():
+    pool = IDPool(occupied=[[8, 10]])
+
+    with Solver(name='g4') as s:
+        res = CardEnc.atmost(lits=list(range(1, 7)), bound=2, vpool=pool,
+                solver=s, encoding=EncType.seqcounter)
+
+        assert res.clauses == []
+        assert count(s, 6) == 22
+
+def test_native():
+    with Solver(name='mc') as s:
+        CardEnc.atleast(lits=[1, 2, 3], bound=2, encoding=EncType.native,
+                solver=s)
+
+        assert s.solve(assumptions=[-1, -2]) == False
+        assert s.solve(assumptions=[-1]) == True
+
+def test_itotalizer():
+    with Solver(name='g3') as s:
+        with ITotalizer(lits=[1, 2, 3], ubound=1, top_id=7, solver=s) as t:
+            assert t.cnf.clauses == [] and t.nof_new > 0
+            assert s.solve(assumptions=[1, 2, -t.rhs[1]]) == False
+
+            t.increase(ubound=2)
+            assert s.solve(assumptions=[1, 2, -t.rhs[2]]) == True
+            assert s.solve(assumptions=[1, 2, 3, -t.rhs[2]]) == False
+
+            t.extend(lits=[4, 5], ubound=3)
+            assert s.solve(assumptions=[1, 2, 4, -t.rhs[3]]) == True
+            assert s.solve(assumptions=[1, 2, 4, 5, -t.rhs[3]]) == False
+
+            with ITotalizer(lits=[6, 7], ubound=1, top_id=t.top_id, solver=s) as t2:
+                t.merge_with(t2)
+                assert s.solve(assumptions=[1, 6, 7, -t.rhs[2]]) == False
@@ -0,0 +1,110 @@
+import io
+from pysat.card import CardEnc, EncType
+from pysat.examples.genhard import PHP
+from pysat.formula import CNF, CNFPlus, ClauseBuffer, WCNF
+from pysat.solvers import Solver
+
+def test_buffer():
+    clauses = [[-1, 2], [-2, 3], [1], [-3, 4, -5]]
+
+    cb = ClauseBuffer(from_clauses=clauses[:2])
+    cb.append(clauses[2])
+    cb.extend(ClauseBuffer(from_clauses=clauses[3:]))
+
+    assert len(cb) == 4 and cb.nv == 5
+    assert cb == clauses and list(cb) == clauses
+    assert cb[-1] == clauses[-1]
+    assert cb.buffer().tolist() == [-1, 2, 0, -2, 3, 0, 1, 0, -3, 4, -5, 0]
+
+    # views share the storage and are read-only
+    view = cb[1:3]
+    assert view == clauses[1:3] and view.nv == 3
+    assert view.copy() == clauses[1:3]
+
+    try:
+        view.append([1])
+        assert False, 'modified a view'
+    except TypeError:
+        pass
+
+    try:
+        cb.append([1, 0])
+        assert False, 'added a zero literal'
+    except ValueError:
+        pass
+
+    assert cb == clauses
+
+def test_weights():
+    cb = ClauseBuffer(weights=True)
+    cb.append([1], weight=3)
+    cb.extend([[2], [3]], weights=[1, 2])
+
+    assert list(cb.weights()) == [3, 1, 2]
+    assert list(cb[1:].weights()) == [1, 2]
+
+    # non-integral weights are kept in a list
+    cb.append([4], weight=1.5)
+    assert cb.weights() == [3, 1, 2, 1.5]
+
+    try:
+        cb.append([5])
+        assert False, 'added a clause with no weight'
+    except ValueError:
+        pass
+
+    assert len(cb) == 4
+
+def test_compact():
+    cnf = PHP(nof_holes=5)
+    string = io.StringIO()
+    cnf.to_fp(string)
+
+    compact = CNF(from_string=string.getvalue(), compact=True)
+    assert isinstance(compact.clauses, ClauseBuffer)
+    assert compact.clauses == cnf.clauses and compact.nv == cnf.nv
+
+    copied = compact.copy()
+    copied.append([-1, -2])
+    assert len(copied.clauses) == len(cnf.clauses) + 1
+    assert compact.clauses == cnf.clauses
+
+    assert compact.negate().clauses == cnf.negate().clauses
+    assert compact.weighted().soft == cnf.clauses
+
+    written = io.StringIO()
+    compact.to_fp(written)
+    assert written.getvalue() == string.getvalue()
+
+    wcnf = WCNF(from_string='p wcnf 3 3 10\n10 -1 2 0\n3 -2 3 0\n1 -3 0\n',
+            compact=True)
+    assert wcnf.hard == [[-1, 2]] and wcnf.soft == [[-2, 3], [-3]]
+
+    written = io.StringIO()
+    wcnf.to_fp(written)
+    assert written.getvalue() == 'p wcnf 3 3 10\n3 -2 3 0\n1 -3 0\n10 -1 2 0\n'
+
+    cnfp = CNFPlus(from_string='p cnf+ 7 2\n1 -2 3 <= 1\n3 5 7 0\n', compact=True)
+    assert cnfp.clauses == [[3, 5, 7]] and cnfp.atmosts == [[[1, -2, 3], 1]]
+
+def test_solvers():
+    cnf = CNF(from_clauses=PHP(nof_holes=4).clauses, compact=True)
+
+    for name in ['cadical', 'glucose30', 'lingeling', 'maplechrono', 'minicard', 'minisat22']:
+        with Solver(name=name, bootstrap_with=cnf) as s:
+            assert s.solve() == False
+
+        # a view of all but the last pigeon's clause is satisfiable
+        with Solver(name=name, bootstrap_with=cnf.clauses[1:]) as s:
+            assert s.solve() == True
+
+def test_encoders():
+    sink = ClauseBuffer()
+    res1 = CardEnc.atmost([1, 2, 3], bound=1, encoding=EncType.seqcounter, solver=sink)
+    res2 = CardEnc.atleast([1, 2, 3], bound=2, top_id=res1.nv, solver=sink)
+
+    plain1 = CardEnc.atmost([1, 2, 3], bound=1, encoding=EncType.seqcounter)
+    plain2 = CardEnc.atleast([1, 2, 3], bound=2, top_id=plain1.nv)
+
+    assert sink == plain1.clauses + plain2.clauses
+    assert res2.nv == plain2.nv
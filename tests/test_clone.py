@@ -0,0 +1,61 @@
+from pysat.examples.genhard import PHP
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'minicard',
+           'minisat22',
+           'minisat-gh']
+
+def test_clone():
+    cnf = PHP(nof_holes=4)
+    clauses = [[-1, 2], [-2, 3], [-3, 4], [1, 5, -6], [7]]
+    queries = [[1, -4], [1, 2, 3], [], [-4, 1], [-7], [6, -5]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            s.solve()
+
+            for warm in (False, True):
+                with s.clone(warm=warm) as c:
+                    assert c.nof_vars() == s.nof_vars(), 'wrong variables by {0}'.format(name)
+
+                    for a in queries:
+                        assert c.solve(assumptions=a) == s.solve(assumptions=a), 'wrong clone by {0}'.format(name)
+
+                    # the clone is independent of the original solver
+                    c.add_clause([-5])
+                    c.add_clause([-1])
+                    assert c.solve(assumptions=[6]) == False
+                    assert s.solve(assumptions=[6]) == True
+
+        with Solver(name=name, bootstrap_with=cnf) as s:
+            assert s.solve() == False
+
+            with s.clone(warm=True) as c:
+                assert c.solve() == False, 'wrong clone by {0}'.format(name)
+
+def test_clone_atmost():
+    lits = list(range(1, 7))
+
+    for name in ['gluecard30', 'gluecard41', 'minicard']:
+        with Solver(name=name) as s:
+            s.add_atmost(lits, 2)
+            s.add_clause([1, 2])
+
+            with s.clone() as c:
+                assert c.solve(assumptions=[3, 4]) == False, 'atmost lost by {0}'.format(name)
+                assert c.solve(assumptions=[3]) == True
+                assert len([l for l in c.get_model() if 0 < l <= 6]) <= 2
+
+def test_clone_unsupported():
+    for name in ['lingeling', 'maplechrono', 'mergesat3']:
+        with Solver(name=name, bootstrap_with=[[1, 2]]) as s:
+            try:
+                s.clone()
+                assert False, 'cloned {0}'.format(name)
+            except NotImplementedError:
+                pass
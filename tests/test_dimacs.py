@@ -0,0 +1,72 @@
+import gzip
+import io
+import os
+import tempfile
+from decimal import Decimal
+from pysat.formula import CNF, CNFPlus, WCNF, WCNFPlus
+from pysat.solvers import Solver
+
+cnf_text = 'c header\np cnf 3 3\n1 -2 0\n  2 3 0\n\n-1 0'
+
+def test_cnf():
+    cnf = CNF(from_string=cnf_text)
+    assert cnf.nv == 3 and cnf.clauses == [[1, -2], [2, 3], [-1]]
+    assert cnf.comments == ['c header']
+
+    # the same from plain and compressed files
+    fd, name = tempfile.mkstemp(suffix='.cnf')
+    with os.fdopen(fd, 'w') as fp:
+        fp.write(cnf_text)
+    with gzip.open(name + '.gz', 'wt') as fp:
+        fp.write(cnf_text)
+
+    for fname in (name, name + '.gz'):
+        assert CNF(from_file=fname).clauses == cnf.clauses
+
+        with Solver(name='m22') as solver:
+            loaded = CNF()
+            loaded.from_file(fname, solver=solver)
+
+            assert loaded.nv == 3 and loaded.clauses == []
+            assert solver.solve() and solver.get_model() == [-1, -2, 3]
+
+    os.remove(name)
+    os.remove(name + '.gz')
+
+def test_weighted():
+    wcnf = WCNF(from_string='p wcnf 3 4 10\n10 1 2 0\n3 -1 0\n2.5 -2 0\n-4 3 0\n')
+    assert wcnf.topw == 10 and wcnf.hard == [[1, 2]]
+    assert wcnf.soft == [[-1], [-2], [-3]]
+    assert wcnf.wght == [3, Decimal('2.5'), 4]
+
+def test_cardinality():
+    cnfp = CNFPlus(from_string='p cnf+ 4 3\n1 2 3 <= 1\n1 2 4 >= 2\n3 4 0\n')
+    assert cnfp.clauses == [[3, 4]]
+    assert cnfp.atmosts == [[[1, 2, 3], 1], [[-1, -2, -4], 1]]
+
+    wcnfp = WCNFPlus(from_string='p wcnf+ 3 2 5\n5 1 2 3 <= 1\n2 -1 0\n')
+    assert wcnfp.atms == [[[1, 2, 3], 1]] and wcnfp.soft == [[-1]]
+
+def test_errors():
+    try:
+        CNF(from_string='p cnf 2 1\n1 x 0\n')
+    except ValueError:
+        pass
+    else:
+        assert False, 'invalid literal accepted'
+
+def test_write():
+    cnf = CNF(from_clauses=[[1, -2], [3]])
+    cnf.comments = ['c header']
+
+    fd, name = tempfile.mkstemp(suffix='.cnf.gz')
+    os.close(fd)
+
+    cnf.to_file(name)
+    assert CNF(from_file=name).clauses == cnf.clauses
+    os.remove(name)
+
+    wcnf = WCNFPlus(from_string='p wcnf+ 3 3 5\n5 1 2 3 <= 1\n2.5 -1 0\n5 2 0\n')
+    fp = io.StringIO()
+    wcnf.to_fp(fp)
+    assert fp.getvalue() == 'p wcnf+ 3 3 5\n2.5 -1 0\n5 2 0\n5 1 2 3 <= 1\n'
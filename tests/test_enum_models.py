@@ -0,0 +1,48 @@
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def split(models):
+    res, model = [], []
+    for l in models:
+        if l == 0:
+            res.append(model)
+            model = []
+        else:
+            model.append(l)
+    return res
+
+def test_enum():
+    clauses = [[1, 2, 3], [-1, -2], [-2, -3], [4, -1]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            expected = sorted(s.enum_models())
+
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            batches = [split(b) for b in s.enum_models_buffer(batch=2)]
+
+            assert max(len(b) for b in batches) == 2
+            assert sorted(m for b in batches for m in b) == expected, 'wrong models by {0}'.format(name)
+            assert s.get_status() == False
+
+def test_projection():
+    clauses = [[1, 2, 3], [-1, -2], [-2, -3], [4, -1]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            models = [m for b in s.enum_models_buffer(assumptions=[-3],
+                projection=[1, 2]) for m in split(b)]
+            assert sorted(models) == [[-1, 2], [1, -2]], 'wrong models by {0}'.format(name)
@@ -0,0 +1,54 @@
+from pysat.examples.musx import MUSX
+from pysat.formula import WCNF
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    # pigeonhole formula with 4 pigeons and 3 holes, each clause selected
+    var = lambda i, j: i * 3 + j + 1
+    clauses = [[var(i, j) for j in range(3)] for i in range(4)]
+    for j in range(3):
+        for i1 in range(4):
+            for i2 in range(i1 + 1, 4):
+                clauses.append([-var(i1, j), -var(i2, j)])
+
+    # a few redundant clauses
+    clauses += [[1, 2], [-1, -5], [4, 5, 6, 7]]
+
+    sels = list(range(13, 13 + len(clauses)))
+
+    for name in solvers:
+        with Solver(name=name) as s:
+            for cl, sel in zip(clauses, sels):
+                s.add_clause(cl + [-sel])
+
+            mus = s.extract_mus(sels)
+            assert mus and all(l in sels for l in mus), 'wrong MUS by {0}'.format(name)
+            assert s.solve(assumptions=mus) == False, 'satisfiable MUS by {0}'.format(name)
+
+            for i in range(len(mus)):
+                assert s.solve(assumptions=mus[:i] + mus[i + 1:]) == True, 'non-minimal MUS by {0}'.format(name)
+
+            assert s.extract_mus(sels[:4]) is None
+
+def test_musx():
+    wcnf = WCNF()
+    for cl in [[-1, -2], [-1, -3], [-2, -3]]:
+        wcnf.append(cl)
+    for cl in [[1], [2], [3]]:
+        wcnf.append(cl, weight=1)
+
+    with MUSX(wcnf, verbosity=0) as musx:
+        assert musx.compute() == [1, 2]
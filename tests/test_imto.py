@@ -0,0 +1,48 @@
+import itertools
+from pysat.card import IModTotalizer
+from pysat.solvers import Solver
+
+def check(t, lits, ubound):
+    nv = max(abs(l) for l in lits)
+
+    with Solver(name='g3', bootstrap_with=t.cnf.clauses) as s:
+        for values in itertools.product([False, True], repeat=nv):
+            assumps = [v + 1 if val else -v - 1 for v, val in enumerate(values)]
+            count = sum(1 for l in lits if (l > 0) == values[abs(l) - 1])
+
+            for k in range(min(ubound + 1, len(lits))):
+                assert s.solve(assumptions=assumps + [-t.rhs[k]]) == (count <= k), \
+                        (lits, t.modulo, ubound, k)
+
+def test_imto_bounds():
+    for n, p in itertools.product(range(1, 10), range(2, 5)):
+        lits = [l if l % 3 else -l for l in range(1, n + 1)]
+
+        with IModTotalizer(lits=lits, ubound=1, modulo=p) as t:
+            check(t, lits, 1)
+
+            for ubound in (2, 4, n):
+                t.increase(ubound=ubound)
+                check(t, lits, ubound)
+
+def test_imto_extend_merge():
+    for p in range(2, 5):
+        with IModTotalizer(lits=[1, 2, 3], ubound=1, top_id=8, modulo=p) as t:
+            t.extend(lits=[4, -5], ubound=2)
+            check(t, [1, 2, 3, 4, -5], 2)
+
+            t2 = IModTotalizer(lits=[6, 7, 8], ubound=3, top_id=t.top_id, modulo=p)
+            t.merge_with(t2, ubound=4)
+            t2.delete()
+            check(t, [1, 2, 3, 4, -5, 6, 7, 8], 4)
+
+            t.increase(ubound=7)
+            check(t, [1, 2, 3, 4, -5, 6, 7, 8], 7)
+
+def test_imto_size():
+    # for large bounds, the encoding is smaller than the iterative totalizer
+    from pysat.card import ITotalizer
+
+    with IModTotalizer(lits=list(range(1, 501)), ubound=200) as t1:
+        with ITotalizer(lits=list(range(1, 501)), ubound=200) as t2:
+            assert len(t1.cnf.clauses) * 5 < len(t2.cnf.clauses)
@@ -0,0 +1,31 @@
+from pysat.card import ITotalizer
+from pysat.solvers import Solver
+
+def test_itot_lifetime():
+    # trees are freed with their objects even if delete() is never called
+    for i in range(100):
+        t = ITotalizer(lits=list(range(1, 101)), ubound=10)
+        t.increase(ubound=20)
+
+    # a merged totalizer can safely be deleted before the one it joined
+    t1 = ITotalizer(lits=[1, 2, 3], ubound=1)
+    t2 = ITotalizer(lits=[4, 5, 6], ubound=1, top_id=t1.top_id)
+    t1.merge_with(t2, ubound=2)
+    t2.delete()
+    t1.increase(ubound=3)
+
+    assert len(t1.rhs) == 4
+    t1.delete()
+
+def test_itot_deep():
+    # a long chain of extensions gives a deep tree
+    t = ITotalizer(lits=[1], ubound=1, top_id=2000)
+    for l in range(2, 2001):
+        t.extend(lits=[l])
+    t.increase(ubound=2)
+
+    with Solver(name='m22', bootstrap_with=t.cnf.clauses) as s:
+        assert s.solve(assumptions=[1, 2, -t.rhs[2]]) == True
+        assert s.solve(assumptions=[1, 2, 3, -t.rhs[2]]) == False
+
+    t.delete()
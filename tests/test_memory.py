@@ -0,0 +1,70 @@
+from pysat.card import *
+from pysat.examples.genhard import PHP
+from pysat.solvers import Solver
+
+solvers = ['gluecard3', 'gluecard4', 'glucose3', 'glucose4', 'maplechrono',
+           'maplecm', 'maplesat', 'mergesat3', 'minicard', 'minisat22',
+           'minisat-gh']
+
+def test_memory():
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=PHP(nof_holes=5)) as s:
+            assert s.solve() == False, name
+
+            mem = s.memory_usage()
+            assert mem['arena'] > 0 and mem['watches'] > 0, name
+            assert 0 < mem['learnts'] <= mem['arena'], name
+            assert mem['total'] == mem['arena'] + mem['watches'], name
+
+    with Solver(name='lingeling', bootstrap_with=PHP(nof_holes=5)) as s:
+        assert s.solve() == False
+        assert s.memory_usage()['total'] > 0
+
+def test_mem_budget():
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=PHP(nof_holes=7)) as s:
+            # the learnt clauses must fit in a few kilobytes
+            s.mem_budget(s.memory_usage()['arena'] + 4096)
+            assert s.solve_limited() == None, name
+            assert s.memory_usage()['arena'] >= s.memory_usage()['learnts'] > 0, name
+
+            # the tiered solvers may keep all of their learnt clauses
+            before = s.memory_usage()
+            s.reduce_learnts()
+            after = s.memory_usage()
+            assert after['learnts'] <= before['learnts'], name
+            assert after['arena'] <= before['arena'], name
+
+            # the budget is lifted by a complete call
+            assert s.solve() == False, name
+
+def test_card_memory():
+    with ITotalizer(lits=list(range(1, 21)), ubound=2) as t:
+        small = t.memory_usage()
+        assert small > 0
+
+        t.increase(ubound=6)
+        assert t.memory_usage() >= small
+
+    with IModTotalizer(lits=list(range(1, 21)), ubound=2) as t:
+        assert t.memory_usage() > 0
+
+    try:
+        CardEnc.set_cache()
+        CardEnc.atmost(lits=list(range(1, 11)), bound=3, encoding=EncType.seqcounter)
+        assert CardEnc.cache_memory() > 0
+
+        CardEnc.set_cache(0)
+        assert CardEnc.cache_memory() == 0
+    finally:
+        CardEnc.set_cache(0)
+
+def test_unsupported():
+    for name in ['cadical', 'lingeling']:
+        with Solver(name=name, bootstrap_with=[[1, 2]]) as s:
+            for call in [lambda: s.mem_budget(1024), s.reduce_learnts]:
+                try:
+                    call()
+                    assert False, 'supported by {0}'.format(name)
+                except NotImplementedError:
+                    pass
@@ -0,0 +1,69 @@
+from pysat.examples.genhard import PHP
+from pysat.solvers import Solver
+
+solvers = ['cadical', 'glucose30', 'glucose41', 'maplechrono', 'maplecm',
+        'maplesat', 'mergesat3', 'minisat22', 'minisat-gh']
+
+def pigeons(nof_holes):
+    # PHP with a selector for each of the clauses placing a pigeon
+    cnf = PHP(nof_holes=nof_holes)
+    top = cnf.nv
+
+    clauses, sels = [], []
+    for cl in cnf.clauses:
+        if cl[0] > 0:
+            top += 1
+            sels.append(top)
+            cl = cl + [-top]
+        clauses.append(cl)
+
+    return clauses, sels
+
+def test_minimize():
+    clauses, sels = pigeons(4)
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            assert s.solve(assumptions=sels) == False
+            core = s.get_core()
+
+            # any four pigeons fit in the holes but five do not
+            for trim in (0, 1, -1):
+                mus = s.minimize_core(core, trim=trim)
+                assert sorted(mus) == sorted(sels), name
+
+            assert s.minimize_core([sels[0], 1, -1]) in ([1, -1], [-1, 1])
+
+            # the selectors of the MUS in their order
+            s.add_clause([-sels[2]])
+            assert s.minimize_core(sels) == [sels[2]]
+
+def test_trim():
+    clauses, sels = pigeons(4)
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses + [[-sels[0]]]) as s:
+            core = s.minimize_core(sels, trim=-1, minimize=False)
+            assert core == [sels[0]] or sorted(core) == sorted(sels), name
+
+            assert s.solve(assumptions=core) == False
+
+def test_budget():
+    clauses, sels = pigeons(7)
+
+    with Solver(name='m22', bootstrap_with=clauses) as s:
+        # every check gives up and so nothing is dropped
+        assert s.minimize_core(sels, conf_budget=1) == sels
+
+        s.time_calls()
+        s.minimize_core(sels[:2], conf_budget=1)
+        assert s.accum_stats()['calls']['minimize_core']['calls'] == 1
+
+def test_unsupported():
+    for name in ['gluecard3', 'lingeling', 'minicard']:
+        with Solver(name=name, bootstrap_with=[[1], [-1, -2]]) as s:
+            try:
+                s.minimize_core([2])
+                assert False, 'minimized by {0}'.format(name)
+            except NotImplementedError:
+                pass
@@ -0,0 +1,32 @@
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    clauses = [[-1, 2], [-2, 3], [-3, 4], [1, 5, -6]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            assert s.solve(assumptions=[1, -6]) == True
+            model = s.get_model()
+            values = s.get_model_buffer()
+            assert len(values) == len(model)
+            assert [(i + 1) * v for i, v in enumerate(values)] == model, 'wrong model by {0}'.format(name)
+            assert s.get_core_buffer() is None
+
+            assert s.solve(assumptions=[1, 2, 3, -4]) == False
+            core = s.get_core_buffer()
+            assert sorted(core) == sorted(s.get_core()), 'wrong core by {0}'.format(name)
+            assert s.get_model_buffer() is None
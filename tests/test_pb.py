@@ -0,0 +1,55 @@
+import itertools
+from pysat.formula import IDPool
+from pysat.pb import *
+from pysat.solvers import Solver
+
+encs = [EncType.best, EncType.bdd, EncType.seqcounter, EncType.adder,
+        EncType.gtotalizer]
+
+constraints = [([1, 2, 3, 4], [1, 2, 3, 4]),
+               ([1, -2, 3, 4, -5], [3, 5, 2, 7, 4]),
+               ([1, 2, -1, 3, 4], [2, 4, 3, -1, 5]),
+               ([-1, 2, 3], [-3, 2, 6])]
+
+def holds(lits, weights, bound, cmp, assignment):
+    total = sum(w for l, w in zip(lits, weights) if (l > 0) == assignment[abs(l) - 1])
+
+    if cmp == '<':
+        return total <= bound
+    elif cmp == '>':
+        return total >= bound
+    return total == bound
+
+def test_pb():
+    methods = {'<': PBEnc.atmost, '>': PBEnc.atleast, '=': PBEnc.equals}
+
+    for lits, weights in constraints:
+        nv = max(abs(l) for l in lits)
+
+        for enc, (cmp, method), bound in itertools.product(encs,
+                sorted(methods.items()), range(-2, 14)):
+            cnf = method(lits=lits, weights=weights, bound=bound, encoding=enc)
+
+            with Solver(name='g3', bootstrap_with=cnf.clauses) as s:
+                for assignment in itertools.product([False, True], repeat=nv):
+                    assumps = [v + 1 if val else -v - 1 for v, val in enumerate(assignment)]
+
+                    assert s.solve(assumptions=assumps) == holds(lits,
+                            weights, bound, cmp, assignment), \
+                            (lits, weights, bound, cmp, enc)
+
+def test_vpool():
+    vpool = IDPool(start_from=10)
+
+    cnf1 = PBEnc.atmost(lits=[1, 2, 3], weights=[1, 2, 3], bound=3,
+            vpool=vpool, encoding=EncType.gtotalizer)
+    cnf2 = PBEnc.atleast(lits=[1, 2, 3], weights=[1, 2, 3], bound=3,
+            vpool=vpool, encoding=EncType.adder)
+
+    assert vpool.top == cnf2.nv
+    assert min(abs(l) for cl in cnf2.clauses for l in cl if abs(l) > 3) > cnf1.nv
+
+    # trivially satisfied constraints do not occupy any variables
+    top = vpool.top
+    assert not PBEnc.atmost(lits=[1, 2, 3], weights=[1, 2, 3], bound=6, vpool=vpool).clauses
+    assert vpool.top == top
@@ -0,0 +1,50 @@
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def php(holes):
+    var = lambda i, j: i * holes + j + 1
+    clauses = [[var(i, j) for j in range(holes)] for i in range(holes + 1)]
+
+    for j in range(holes):
+        for i in range(holes + 1):
+            for k in range(i + 1, holes + 1):
+                clauses.append([-var(i, j), -var(k, j)])
+
+    return clauses
+
+def test_portfolio():
+    with Solver(name='portfolio', bootstrap_with=php(6), solvers=solvers) as s:
+        assert s.solve() == False
+        assert s.solver.get_winner() in s.solver.members
+        assert s.accum_stats()['conflicts'] > 0
+
+        # all the losers remain usable after being interrupted
+        for member in s.solver.members:
+            assert member.solve(assumptions=[1]) == False
+
+def test_model_core():
+    with Solver(name='pf', bootstrap_with=[[-1, 2], [-2, 3]]) as s:
+        assert s.solve() == True
+        model = s.get_model()
+        assert -1 in model or 2 in model
+
+        assert s.solve(assumptions=[1, -3]) == False
+        assert sorted(s.get_core()) == [-3, 1]
+
+        # the same portfolio can be used incrementally
+        s.add_clause([-3])
+        assert s.solve(assumptions=[1]) == False
+        assert s.get_core() == [1]
@@ -0,0 +1,34 @@
+from pysat.card import *
+from pysat.solvers import Solver
+
+solvers = ['gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    cnf = CardEnc.atmost(lits=range(1, 6), bound=1, encoding=EncType.pairwise)
+    queries = [[1], [1, 2], [], [5], [-1, -2, -3, -4]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=cnf.clauses) as s:
+            status, offs, lits = s.propagate_batch(queries)
+            assert len(status) == len(queries)
+            assert len(offs) == len(queries) + 1
+
+            for i, a in enumerate(queries):
+                st, props = s.propagate(assumptions=a)
+                assert bool(status[i]) == st, 'wrong status by {0}'.format(name)
+                assert list(lits[offs[i]:offs[i + 1]]) == props, 'wrong literals by {0}'.format(name)
+
+def test_empty():
+    with Solver(name='glucose3', bootstrap_with=[[-1, 2]]) as s:
+        status, offs, lits = s.propagate_batch([])
+        assert len(status) == 0 and list(offs) == [0] and len(lits) == 0
@@ -0,0 +1,80 @@
+from pysat.examples.rc2 import RC2
+from pysat.formula import WCNF
+
+solvers = ['cadical',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def wcnf():
+    formula = WCNF()
+
+    # pigeonhole-like: pigeons 1..4 and holes 1..3 as soft preferences
+    var = lambda i, j: i * 3 + j + 1
+    for i in range(4):
+        formula.append([var(i, j) for j in range(3)], weight=i + 1)
+
+    for j in range(3):
+        for i in range(4):
+            for k in range(i + 1, 4):
+                formula.append([-var(i, j), -var(k, j)])
+
+    for v in range(1, 13):
+        formula.append([-v], weight=v % 3 + 1)
+
+    return formula
+
+def enumerate_models(name, native, **kwargs):
+    with RC2(wcnf(), solver=name, **kwargs) as rc2:
+        rc2.native = native
+
+        result = []
+        for model in rc2.enumerate():
+            result.append((model, rc2.cost))
+            if len(result) == 5:
+                break
+
+        return result, rc2.engine is not None
+
+def test_native_engine():
+    for name in solvers:
+        for exhaust in (False, True):
+            for minz in (False, True):
+                if name in ('cadical', 'lingeling') and minz:
+                    continue  # limited calls are unsupported by these two
+
+                opts = dict(exhaust=exhaust, minz=minz)
+                native, used = enumerate_models(name, True, **opts)
+                python, _ = enumerate_models(name, False, **opts)
+
+                # the same oracle calls give the same models, except
+                # for MapleChrono, whose runs are not reproducible
+                if name == 'maplechrono':
+                    native = [(None, c) for m, c in native]
+                    python = [(None, c) for m, c in python]
+
+                assert native == python
+                assert used == (name not in ('lingeling', 'minicard'))
+                assert native[0][1] == 6
+
+def test_incremental():
+    with RC2(wcnf(), solver='g4') as rc2:
+        assert rc2.compute() is not None
+        assert rc2.engine is not None and rc2.cost == 6
+
+        # new soft clauses go to the engine as well
+        rc2.add_clause([1], weight=5)
+        rc2.add_clause([-1, -2])
+        assert rc2.compute() is not None
+        assert rc2.cost == 8
+
+        rc2.add_clause([-1])
+        assert rc2.compute() is not None
+        assert rc2.cost == 11
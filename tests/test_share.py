@@ -0,0 +1,61 @@
+from threading import Thread
+from pysat.examples.genhard import PHP
+from pysat.formula import CNF
+from pysat.solvers import ClauseExchange, Solver
+
+solvers = ['glucose30', 'glucose41', 'maplechrono', 'minisat22']
+
+def solve_all(team):
+    threads = [Thread(target=s.solve) for s in team]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    return [s.get_status() for s in team]
+
+def test_share():
+    cnf = PHP(nof_holes=6)
+    pool = ClauseExchange(capacity=256, max_size=10)
+
+    team = [Solver(name=name, bootstrap_with=cnf) for name in solvers * 2]
+    for s in team:
+        s.share_clauses(pool, max_lbd=6)
+
+    # the solvers keep the pool alive
+    del pool
+
+    assert solve_all(team) == [False] * len(team)
+
+    for s in team:
+        s.delete()
+
+def test_share_sat():
+    cnf = CNF(from_clauses=[[1, 2, 3], [-1, -2], [-2, -3], [-1, -3], [2, 3], [4, -1]])
+    pool = ClauseExchange()
+
+    team = [Solver(name=name, bootstrap_with=cnf) for name in solvers]
+    for s in team:
+        s.share_clauses(pool)
+
+    assert solve_all(team) == [True] * len(team)
+
+    for s in team:
+        model = s.get_model()
+        assert all(any(l in model for l in cl) for cl in cnf)
+
+        # leaving the pool
+        s.share_clauses(None)
+        assert s.solve(assumptions=[1]) == False
+        s.delete()
+
+def test_share_unsupported():
+    pool = ClauseExchange()
+
+    for name in ['cadical', 'lingeling', 'minicard']:
+        with Solver(name=name, bootstrap_with=[[1, 2]]) as s:
+            try:
+                s.share_clauses(pool)
+                assert False, 'shared by {0}'.format(name)
+            except NotImplementedError:
+                pass
@@ -0,0 +1,96 @@
+from array import array
+from pysat.examples.genhard import PHP
+from pysat.solvers import Solver
+
+def test_eliminate():
+    chain = [[-1, 2], [-2, 3], [-3, 4], [-4, 5], [1, 6, -5], [2, 6]]
+
+    with Solver(name='m22', bootstrap_with=chain, simplify=True) as s:
+        s.freeze([1, 5, 6])
+        assert s.eliminate() == True
+        assert s.nof_clauses() < len(chain)
+
+        assert s.solve(assumptions=[1, -5]) == False
+        assert s.solve(assumptions=[-6]) == True
+
+        # the model is complete and satisfies the original formula
+        model = s.get_model()
+        assert model == [1, 2, 3, 4, 5, -6]
+        assert all(any(l in model for l in cl) for cl in chain)
+
+        # frozen variables can be used by new clauses
+        s.add_clause([-1])
+        assert s.solve() == True
+        assert -1 in s.get_model() and 6 in s.get_model()
+        assert s.solve(assumptions=[-6]) == False
+
+def test_frozen():
+    with Solver(name='m22', bootstrap_with=[[-1, 2], [-2, 3]], simplify=True) as s:
+        assert s.solve() == True
+
+        # the variable is gone and cannot be frozen anymore
+        try:
+            s.freeze([2])
+            assert False, 'froze an eliminated variable'
+        except Exception:
+            pass
+
+def test_eliminated():
+    with Solver(name='m22', bootstrap_with=[[-1, 2], [-2, 3]], simplify=True) as s:
+        s.freeze([1, 3])
+        assert s.solve() == True
+
+        # variable 2 is eliminated and it cannot be used anymore
+        for call in (lambda: s.solve(assumptions=[1, -2]),
+                lambda: s.solve_limited(assumptions=[-2]),
+                lambda: s.propagate(assumptions=[2]),
+                lambda: s.add_clause([-2]),
+                lambda: s.append_buffer(array('i', [4, 2, 0]))):
+            try:
+                call()
+                assert False, 'used an eliminated variable'
+            except Exception:
+                pass
+
+        # the refused clauses are not added
+        s.add_clause([1])
+        assert s.solve() == True
+        assert s.get_model()[:3] == [1, 2, 3]
+        assert s.solve(assumptions=[-3]) == False
+
+    # nothing is frozen and so everything is eliminated
+    with Solver(name='m22', bootstrap_with=[[-1, 2], [-2, 3]], simplify=True) as s:
+        assert s.solve() == True
+        try:
+            s.add_clause([1])
+            assert False, 'used an eliminated variable'
+        except Exception:
+            pass
+
+def test_unsat():
+    with Solver(name='m22', bootstrap_with=PHP(nof_holes=5), simplify=True) as s:
+        assert s.eliminate(turn_off=True) == True
+        assert s.solve() == False
+
+def test_unsupported():
+    with Solver(name='m22', bootstrap_with=[[1, 2]]) as s:
+        try:
+            s.freeze([1])
+            assert False, 'froze without simplification'
+        except Exception:
+            pass
+
+    with Solver(name='m22', bootstrap_with=[[1, 2]], simplify=True) as s:
+        try:
+            s.clone()
+            assert False, 'cloned a simplifying solver'
+        except Exception:
+            pass
+
+    for name in ['cadical', 'glucose30', 'lingeling', 'minicard', 'minisat-gh']:
+        with Solver(name=name, bootstrap_with=[[1, 2]]) as s:
+            try:
+                s.eliminate()
+                assert False, 'eliminated by {0}'.format(name)
+            except NotImplementedError:
+                pass
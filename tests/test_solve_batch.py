@@ -0,0 +1,50 @@
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    clauses = [[-1, 2], [-2, 3], [-3, 4], [1, 5, -6]]
+    queries = [[1, -6], [1, 2, 3, -4], [], [-4, 1]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            status, offs, lits = s.solve_batch(queries, models=True, cores=True)
+            assert list(status) == [1, 0, 1, 0], 'wrong statuses by {0}'.format(name)
+
+            for i, a in enumerate(queries):
+                res = list(lits[offs[i]:offs[i + 1]])
+                assert s.solve(assumptions=a) == bool(status[i])
+
+                if status[i]:
+                    assert len(res) == 6 and all(l in res for l in a), 'wrong model by {0}'.format(name)
+                    assert all(any(l in res for l in cl) for cl in clauses), 'wrong model by {0}'.format(name)
+                else:
+                    assert sorted(res) == sorted(s.get_core()), 'wrong core by {0}'.format(name)
+
+            status, offs, lits = s.solve_batch(queries)
+            assert list(status) == [1, 0, 1, 0] and list(offs) == [0] * 5
+
+def test_budget():
+    # pigeonhole formula with 8 pigeons and 7 holes
+    var = lambda i, j: i * 7 + j + 1
+    clauses = [[var(i, j) for j in range(7)] for i in range(8)]
+    for j in range(7):
+        for i1 in range(8):
+            for i2 in range(i1 + 1, 8):
+                clauses.append([-var(i1, j), -var(i2, j)])
+
+    for name in ['cadical', 'glucose3', 'minisat22']:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            status, offs, lits = s.solve_batch([[], [-1]], conf_budget=10)
+            assert list(status) == [-1, -1], 'budget ignored by {0}'.format(name)
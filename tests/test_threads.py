@@ -0,0 +1,46 @@
+from threading import Thread
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def php(holes):
+    var = lambda i, j: i * holes + j + 1
+    clauses = [[var(i, j) for j in range(holes)] for i in range(holes + 1)]
+
+    for j in range(holes):
+        for i in range(holes + 1):
+            for k in range(i + 1, holes + 1):
+                clauses.append([-var(i, j), -var(k, j)])
+
+    return clauses
+
+def test_threads():
+    clauses = php(6)
+    results = {}
+
+    def run(name):
+        with Solver(name=name, bootstrap_with=clauses) as solver:
+            results[name] = solver.solve()
+
+    threads = [Thread(target=run, args=(name,)) for name in solvers]
+
+    for t in threads:
+        t.start()
+
+    for t in threads:
+        t.join()
+
+    for name in solvers:
+        assert results[name] == False, 'wrong outcome by {0}'.format(name)
@@ -0,0 +1,40 @@
+from pysat.solvers import Solver
+
+solvers = ['cadical',
+           'gluecard30',
+           'gluecard41',
+           'glucose30',
+           'glucose41',
+           'lingeling',
+           'maplechrono',
+           'maplecm',
+           'maplesat',
+           'minicard',
+           'mergesat3',
+           'minisat22',
+           'minisat-gh']
+
+def test_solvers():
+    clauses = [[-1, 2], [-2, 3], [-3, 4], [1, 5, -6]]
+
+    for name in solvers:
+        with Solver(name=name, bootstrap_with=clauses) as s:
+            assert 'calls' not in s.accum_stats()
+
+            s.time_calls()
+            s.add_clause([-4, 7])
+            assert s.solve(assumptions=[1]) == True
+            assert s.get_model() is not None
+            assert s.solve(assumptions=[1, -7]) == False
+            assert s.get_core() is not None
+
+            calls = s.accum_stats()['calls']
+            assert sorted(calls.keys()) == ['add_clause', 'get_core', 'get_model', 'solve'], name
+            assert calls['solve']['calls'] == 2
+            assert calls['add_clause']['calls'] == 1
+
+            for entry in calls.values():
+                assert 0 <= entry['solver_ns'] <= entry['total_ns'], name
+
+            s.time_calls(False)
+            assert 'calls' not in s.accum_stats()